@@ -0,0 +1,281 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_02.ino
+ *
+ * @brief Code example file to measure the ClickCounter_ESP32 library counting modes performance
+ *
+ * @details The example runs the same counting workload against ClickCounter objects set in each of the available counting modes and reports through the serial port:
+ * - The average time taken by each counting method invocation when executed by a single task.
+ * - The counting methods throughput (operations per second) when the same counter is used simultaneously by two tasks, one running in each core of the MCU.
+ *
+ * The counting modes measured are:
+ * - Mutex protected counting, immediate display refresh (default mode).
+ * - Lock-free counting, immediate display refresh.
+ * - Lock-free counting, deferred display refresh handled by the refresh task.
+ * - Lock-free counting without display.
+ * - ShardedClickCounter, one count shard per core, without display.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <SevenSegDisplays.h>
+#include <ClickCounter_Esp32.h>
+#include <ShardedClickCounter_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define WrkrTskPrrtyLvl 3 // Workload tasks priority level
+#define OpsPerWrkr 2000 // countUp() + countDown() pairs executed by each workload task
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+struct bnchTrgt_t{
+   void* cntrPtr;
+   bool (*countUpFn)(void*);
+   bool (*countDownFn)(void*);
+   int32_t (*getCountFn)(void*);
+};
+
+struct wrkrTskPrm_t{
+   bnchTrgt_t* trgtPtr;
+   TaskHandle_t ntfyTskHndl;
+};
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void runBenchmark(const char* modeName, bnchTrgt_t &target);
+void runBenchmark(const char* modeName, ClickCounter &counter);
+void runBenchmark(const char* modeName, ShardedClickCounter &counter);
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void wrkrTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nBenchmark started"); //FTPO
+   Serial.println("================="); //FTPO
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   const uint8_t dio {GPIO_NUM_17};  // Pin connected to DIO of TM1637
+   const uint8_t clk {GPIO_NUM_16}; // Pin connected to CLK of TM1637
+
+   static uint8_t myDispIOPins[2] {clk, dio}; // Pins set as an array as required by hw constructor
+
+   uint8_t theNewOrder [4] {3, 2, 1, 0};
+
+   SevenSegDispHw* myLedDispHwPtr {new SevenSegTM1637(myDispIOPins, 4, false)};
+   myLedDispHwPtr -> setDigitsOrder(theNewOrder);
+   SevenSegDisplays myLedDisp(myLedDispHwPtr);
+   SevenSegDisplays* myLedDispPtr {&myLedDisp};
+
+   myLedDisp.begin();
+   Serial.println("Display Service Started");
+
+   for(;;){
+      {
+         //Mutex protected counting, immediate display refresh
+         ClickCounter myClickCounter(myLedDispPtr, true, false);
+         myClickCounter.begin(0);
+         runBenchmark("Mutex, immediate refresh", myClickCounter);
+         myClickCounter.end();
+      }
+
+      {
+         //Lock-free counting, immediate display refresh
+         ClickCounter myClickCounter(myLedDispPtr, true, false);
+         myClickCounter.setLockFree(true);
+         myClickCounter.begin(0);
+         runBenchmark("Lock-free, immediate refresh", myClickCounter);
+         myClickCounter.end();
+      }
+
+      {
+         //Lock-free counting, deferred display refresh by the refresh task
+         ClickCounter myClickCounter(myLedDispPtr, true, false);
+         myClickCounter.setLockFree(true);
+         myClickCounter.begin(0);
+         myClickCounter.startRefreshTask(25);
+         runBenchmark("Lock-free, refresh task", myClickCounter);
+         myClickCounter.stopRefreshTask();
+         myClickCounter.end();
+      }
+
+      {
+         //Lock-free counting without display
+         ClickCounter myClickCounter(-9999, 9999);
+         myClickCounter.setLockFree(true);
+         myClickCounter.begin(0);
+         runBenchmark("Lock-free, no display", myClickCounter);
+         myClickCounter.end();
+      }
+
+      {
+         //Sharded counting without display
+         ShardedClickCounter myShrdClickCounter(-9999, 9999);
+         myShrdClickCounter.begin(0);
+         runBenchmark("Sharded, no display", myShrdClickCounter);
+         myShrdClickCounter.end();
+      }
+
+      vTaskDelay(10000);
+   }
+}
+
+void wrkrTsk(void *pvParameters){
+   wrkrTskPrm_t* prmPtr = static_cast<wrkrTskPrm_t*>(pvParameters);
+   bnchTrgt_t* trgtPtr = prmPtr->trgtPtr;
+
+   for(int i{0}; i < OpsPerWrkr; i++){
+      trgtPtr->countUpFn(trgtPtr->cntrPtr);
+      trgtPtr->countDownFn(trgtPtr->cntrPtr);
+   }
+   xTaskNotifyGive(prmPtr->ntfyTskHndl);
+   vTaskDelete(NULL);
+}
+//=================================>> User Tasks Implementations END
+
+//================================================>> General use functions BEGIN
+void runBenchmark(const char* modeName, ClickCounter &counter){
+   bnchTrgt_t target{
+      &counter,
+      [](void* cntrPtr) -> bool {return static_cast<ClickCounter*>(cntrPtr)->countUp();},
+      [](void* cntrPtr) -> bool {return static_cast<ClickCounter*>(cntrPtr)->countDown();},
+      [](void* cntrPtr) -> int32_t {return static_cast<ClickCounter*>(cntrPtr)->getCount();}
+   };
+
+   runBenchmark(modeName, target);
+
+   return;
+}
+
+void runBenchmark(const char* modeName, ShardedClickCounter &counter){
+   bnchTrgt_t target{
+      &counter,
+      [](void* cntrPtr) -> bool {return static_cast<ShardedClickCounter*>(cntrPtr)->countUp();},
+      [](void* cntrPtr) -> bool {return static_cast<ShardedClickCounter*>(cntrPtr)->countDown();},
+      [](void* cntrPtr) -> int32_t {return static_cast<ShardedClickCounter*>(cntrPtr)->getCount();}
+   };
+
+   runBenchmark(modeName, target);
+
+   return;
+}
+
+void runBenchmark(const char* modeName, bnchTrgt_t &target){
+   int64_t startTm{0};
+   int64_t elapsedTm{0};
+   wrkrTskPrm_t wrkrPrm{&target, xTaskGetCurrentTaskHandle()};
+
+   Serial.print("\n");
+   Serial.println(modeName);
+
+   //Single task latency
+   startTm = esp_timer_get_time();
+   for(int i{0}; i < OpsPerWrkr; i++){
+      target.countUpFn(target.cntrPtr);
+      target.countDownFn(target.cntrPtr);
+   }
+   elapsedTm = esp_timer_get_time() - startTm;
+   Serial.print("   Single task, average microseconds per operation: ");
+   Serial.println((double)elapsedTm / (2 * OpsPerWrkr), 3);
+
+   startTm = esp_timer_get_time();
+   for(int i{0}; i < OpsPerWrkr; i++)
+      target.getCountFn(target.cntrPtr);
+   elapsedTm = esp_timer_get_time() - startTm;
+   Serial.print("   Single task, average microseconds per getCount(): ");
+   Serial.println((double)elapsedTm / OpsPerWrkr, 3);
+
+   //Two tasks throughput, one task in each core
+   startTm = esp_timer_get_time();
+   for(int core{0}; core < portNUM_PROCESSORS; core++){
+      xReturned = xTaskCreatePinnedToCore(wrkrTsk, "WorkloadTask", 2048, &wrkrPrm, WrkrTskPrrtyLvl, NULL, core);
+      if(xReturned != pdPASS)
+         Error_Handler();
+   }
+   for(int core{0}; core < portNUM_PROCESSORS; core++)
+      ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+   elapsedTm = esp_timer_get_time() - startTm;
+   Serial.print("   ");
+   Serial.print(portNUM_PROCESSORS);
+   Serial.print(" tasks, operations per second: ");
+   Serial.println((double)(2 * OpsPerWrkr * portNUM_PROCESSORS) * 1000000.0 / elapsedTm, 0);
+
+   Serial.print("   Final count (must be 0): ");
+   Serial.println(target.getCountFn(target.cntrPtr));
+
+   return;
+}
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
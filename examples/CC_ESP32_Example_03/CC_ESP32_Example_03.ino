@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_03.ino
+ *
+ * @brief Code example file to compare a ClickCounterBank against individual ClickCounter objects
+ *
+ * @details The example builds the same quantity of counters as individual ClickCounter objects and as the slots of a ClickCounterBank object, and reports through the serial port:
+ * - The heap memory used by each of the alternatives.
+ * - The average time taken to add a vector of deltas to all the counters.
+ * - The average time taken to copy all the counters values.
+ * - The average time taken to reset all the counters.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ClickCounter_Esp32.h>
+#include <ClickCounterBank_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define CntrsQty 256 // Quantity of counters to build in each alternative
+#define RptsQty 100 // Repetitions of each bulk operation measured
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+int32_t deltas[CntrsQty];
+int32_t counts[CntrsQty];
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void printAvgTm(const char* label, const int64_t &elapsedTm);
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nBenchmark started"); //FTPO
+   Serial.println("================="); //FTPO
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint32_t freeHeapBfr{0};
+   int64_t startTm{0};
+
+   for(int i{0}; i < CntrsQty; i++)
+      deltas[i] = (i % 2)?1:-1;
+
+   for(;;){
+      {
+         //Individual ClickCounter objects
+         ClickCounter* cntrsPtrArr[CntrsQty];
+
+         Serial.print("\n");
+         Serial.print(CntrsQty);
+         Serial.println(" ClickCounter objects");
+         freeHeapBfr = ESP.getFreeHeap();
+         for(int i{0}; i < CntrsQty; i++){
+            cntrsPtrArr[i] = new ClickCounter(-9999, 9999);
+            cntrsPtrArr[i]->setLockFree(true);
+            cntrsPtrArr[i]->begin(0);
+         }
+         Serial.print("   Heap bytes used: ");
+         Serial.println(freeHeapBfr - ESP.getFreeHeap());
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++){
+            for(int i{0}; i < CntrsQty; i++){
+               if(deltas[i] > 0)
+                  cntrsPtrArr[i]->countUp(deltas[i]);
+               else
+                  cntrsPtrArr[i]->countDown(deltas[i]);
+            }
+         }
+         printAvgTm("add deltas", esp_timer_get_time() - startTm);
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++){
+            for(int i{0}; i < CntrsQty; i++)
+               counts[i] = cntrsPtrArr[i]->getCount();
+         }
+         printAvgTm("copy counts", esp_timer_get_time() - startTm);
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++){
+            for(int i{0}; i < CntrsQty; i++)
+               cntrsPtrArr[i]->countReset();
+         }
+         printAvgTm("reset all", esp_timer_get_time() - startTm);
+
+         for(int i{0}; i < CntrsQty; i++)
+            delete cntrsPtrArr[i];
+      }
+
+      {
+         //ClickCounterBank object
+         Serial.print("\n");
+         Serial.print("ClickCounterBank object, ");
+         Serial.print(CntrsQty);
+         Serial.println(" slots");
+         freeHeapBfr = ESP.getFreeHeap();
+         ClickCounterBank* bankPtr {new ClickCounterBank(CntrsQty, -9999, 9999)};
+         bankPtr->begin(0);
+         Serial.print("   Heap bytes used: ");
+         Serial.println(freeHeapBfr - ESP.getFreeHeap());
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++)
+            bankPtr->addDeltas(deltas, 0, CntrsQty);
+         printAvgTm("add deltas", esp_timer_get_time() - startTm);
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++)
+            bankPtr->snapshot(counts);
+         printAvgTm("copy counts", esp_timer_get_time() - startTm);
+
+         startTm = esp_timer_get_time();
+         for(int rpt{0}; rpt < RptsQty; rpt++)
+            bankPtr->countResetAll();
+         printAvgTm("reset all", esp_timer_get_time() - startTm);
+
+         delete bankPtr;
+      }
+
+      vTaskDelay(10000);
+   }
+}
+//=================================>> User Tasks Implementations END
+
+//================================================>> General use functions BEGIN
+void printAvgTm(const char* label, const int64_t &elapsedTm){
+   Serial.print("   Average microseconds to ");
+   Serial.print(label);
+   Serial.print(": ");
+   Serial.println((double)elapsedTm / RptsQty, 3);
+
+   return;
+}
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
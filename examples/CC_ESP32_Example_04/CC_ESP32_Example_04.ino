@@ -0,0 +1,151 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_04.ino
+ *
+ * @brief Code example file to measure the QuadraturePulseSource decoding throughput
+ *
+ * @details The example feeds a QuadraturePulseSource object with a synthetic phases states sequence, as the phases interrupts would, and reports through the serial port:
+ * - The average time taken to decode each phase edge, and the equivalent maximum edge rate.
+ * - The average time taken to deliver the accumulated pulses to a ClickCounter by each pollPulseSource() call.
+ * - The quantity of pulses counted for each resolution, and the undecodable transitions registered.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ClickCounter_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define EdgesQty 1000000 // Quantity of phase edges decoded in each measure
+#define EdgesPerPoll 1000 // Quantity of phase edges decoded between counter polls
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+const uint8_t fwdStates[4] {0b10, 0b11, 0b01, 0b00};  // Phase A leading phase B, as (A << 1) | B
+const char* resNames[3] {"x1", "x2", "x4"};
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nBenchmark started"); //FTPO
+   Serial.println("================="); //FTPO
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   int64_t decodeTm{0};
+   int64_t pollTm{0};
+   int64_t startTm{0};
+
+   for(;;){
+      for(int res{ccQdrtrX1}; res <= ccQdrtrX4; res++){
+         QuadraturePulseSource qdrtrSrc(static_cast<ccQdrtrRes_t>(res));
+         ClickCounter qdrtrCntr(INT32_MIN, INT32_MAX);
+
+         qdrtrCntr.setLockFree(true);
+         qdrtrCntr.setPulseSource(&qdrtrSrc);
+         qdrtrCntr.begin(0);
+         decodeTm = 0;
+         pollTm = 0;
+         for(int edge{0}; edge < EdgesQty; edge += EdgesPerPoll){
+            startTm = esp_timer_get_time();
+            for(int i{0}; i < EdgesPerPoll; i++)
+               qdrtrSrc.pushState(fwdStates[(edge + i) & 0x03]);
+            decodeTm += esp_timer_get_time() - startTm;
+            startTm = esp_timer_get_time();
+            qdrtrCntr.pollPulseSource();
+            pollTm += esp_timer_get_time() - startTm;
+         }
+
+         Serial.print("\nResolution ");
+         Serial.println(resNames[res]);
+         Serial.print("   Average nanoseconds to decode an edge: ");
+         Serial.println((double)decodeTm * 1000 / EdgesQty, 3);
+         Serial.print("   Equivalent maximum edge rate (MHz): ");
+         Serial.println((double)EdgesQty / decodeTm, 3);
+         Serial.print("   Average microseconds per poll: ");
+         Serial.println((double)pollTm / (EdgesQty / EdgesPerPoll), 3);
+         Serial.print("   Pulses counted: ");
+         Serial.print(qdrtrCntr.getCount());
+         Serial.print(", undecodable transitions: ");
+         Serial.println(qdrtrSrc.getErrorQty());
+      }
+
+      vTaskDelay(10000);
+   }
+}
+//=================================>> User Tasks Implementations END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
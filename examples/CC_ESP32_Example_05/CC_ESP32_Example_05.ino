@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_05.ino
+ *
+ * @brief Code example file to compare the ClickCounter state reading throughput with several reader tasks
+ *
+ * @details The example runs a writer task incrementing a counter as fast as it can, while several reader tasks, spread over both cores, read the counter state. The measure is made once for each reading method, and the results are reported through the serial port:
+ * - Reading the count with getCount(), that takes the same mutex the counting methods take.
+ * - Reading the complete counter state with snapshot(), that retries the reading instead of locking.
+ * For each method the total readings per second of all the readers, and the count increments per second made by the writer while being read, are reported.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ClickCounter_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define BnchTskPrrtyLvl 1 // Readers and writer tasks priority level
+#define ReadersQty 4 // Quantity of reader tasks
+#define MeasureMs 2000 // Duration of each measure
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+ClickCounter bnchCntr(INT32_MIN, INT32_MAX);
+volatile bool useSnapshot{false};
+volatile bool bnchRun{false};
+std::atomic<uint32_t> readsQty{0};
+std::atomic<uint32_t> writesQty{0};
+std::atomic<uint8_t> endedQty{0};
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void readerTsk(void *pvParameters);
+void writerTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nBenchmark started"); //FTPO
+   Serial.println("================="); //FTPO
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   bnchCntr.begin(0);
+
+   for(;;){
+      for(int mode{0}; mode < 2; mode++){
+         useSnapshot = (mode == 1);
+         readsQty = 0;
+         writesQty = 0;
+         endedQty = 0;
+         bnchRun = true;
+         for(int rdr{0}; rdr < ReadersQty; rdr++){
+            xReturned = xTaskCreatePinnedToCore(readerTsk, "ReaderTask", 2048, NULL, BnchTskPrrtyLvl, NULL, rdr % portNUM_PROCESSORS);
+            if(xReturned != pdPASS)
+               Error_Handler();
+         }
+         xReturned = xTaskCreatePinnedToCore(writerTsk, "WriterTask", 2048, NULL, BnchTskPrrtyLvl, NULL, ssdExecTskCore);
+         if(xReturned != pdPASS)
+            Error_Handler();
+         vTaskDelay(pdMS_TO_TICKS(MeasureMs));
+         bnchRun = false;
+         while(endedQty < (ReadersQty + 1))
+            vTaskDelay(1);
+
+         Serial.print(useSnapshot?"\nsnapshot()":"\ngetCount()");
+         Serial.print(" with ");
+         Serial.print(ReadersQty);
+         Serial.println(" readers");
+         Serial.print("   Readings per second: ");
+         Serial.println((uint32_t)((uint64_t)readsQty * 1000 / MeasureMs));
+         Serial.print("   Writer increments per second: ");
+         Serial.println((uint32_t)((uint64_t)writesQty * 1000 / MeasureMs));
+      }
+
+      vTaskDelay(10000);
+   }
+}
+
+void readerTsk(void *pvParameters){
+   uint32_t locReads{0};
+   ccCntSnap_t cntSnap{};
+
+   while(bnchRun){
+      if(useSnapshot)
+         cntSnap = bnchCntr.snapshot();
+      else
+         cntSnap.count = bnchCntr.getCount();
+      locReads++;
+      if((locReads & 0x3FF) == 0)
+         taskYIELD();   // Lets the other tasks in the same core and priority run
+   }
+   readsQty += locReads;
+   endedQty++;
+
+   vTaskDelete(NULL);
+}
+
+void writerTsk(void *pvParameters){
+   uint32_t locWrites{0};
+
+   while(bnchRun){
+      bnchCntr.countUp();
+      locWrites++;
+      if((locWrites & 0x3FF) == 0)
+         taskYIELD();
+   }
+   writesQty += locWrites;
+   endedQty++;
+
+   vTaskDelete(NULL);
+}
+//=================================>> User Tasks Implementations END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,252 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_06.ino
+ *
+ * @brief Code example file to check the counters use no heap memory
+ *
+ * @details The example repeats cycles of construction, begin(), counting, end() and destruction of ClickCounter and ClickCounterT objects, placed in static storage, in the stack and in a buffer provided by the application, and checks that no heap memory was allocated by them. Any allocation is detected by two means:
+ * - The global operator new is replaced by a counting version.
+ * - The quantity of blocks allocated in the heap, as reported by heap_caps_get_info(), is compared before and after the cycles.
+ * The result of each check is reported through the serial port as PASS or FAIL, and a failure stops the example in the Error_Handler().
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <atomic>
+#include <new>
+#include <esp_heap_caps.h>
+#include <ClickCounter_Esp32.h>
+#include <ClickCounterT_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define CyclesQty 1000 // Quantity of construction to destruction cycles in each check
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+std::atomic<uint32_t> newQty{0};   // Allocations made by the operator new replacements
+
+ClickCounter staticCntr(-9999, 9999);  // Built before setup(), with no heap use
+ClickCounterT<0, 9999, ccOvfWrap, ccLckCritical> staticCntrT;  // Constant initialized, no code is executed to build it
+alignas(ClickCounter) uint8_t cntrBuf[sizeof(ClickCounter)];  // Application provided storage for a counter
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+bool heapCheck(const char* checkName, void (*cycleFn)());
+void cycleBufCntr();
+void cycleStackCntr();
+void cycleStaticCntr();
+void cycleTmpltCntr();
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+//==================================>> Operator new counting replacements BEGIN
+void* operator new(size_t size){
+   newQty++;
+   return malloc(size);
+}
+
+void* operator new[](size_t size){
+   newQty++;
+   return malloc(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t &) noexcept{
+   newQty++;
+   return malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t &) noexcept{
+   newQty++;
+   return malloc(size);
+}
+
+void operator delete(void* ptr) noexcept{
+   free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept{
+   free(ptr);
+}
+//====================================>> Operator new counting replacements END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nHeap use check started"); //FTPO
+   Serial.println("======================"); //FTPO
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   bool allPass{true};
+
+   staticCntr.begin(0);  // Started once, the end() method of a counter without display clears its range
+   delay(100); // Lets the serial port driver finish its pending work before measuring
+   allPass = heapCheck("Static storage ClickCounter", cycleStaticCntr) && allPass;
+   allPass = heapCheck("Stack ClickCounter", cycleStackCntr) && allPass;
+   allPass = heapCheck("Application buffer ClickCounter", cycleBufCntr) && allPass;
+   allPass = heapCheck("ClickCounterT", cycleTmpltCntr) && allPass;
+   Serial.println(allPass?"\nAll checks PASSED":"\nSome checks FAILED");
+   if(!allPass)
+      Error_Handler();
+
+   for(;;){
+      vTaskDelay(10000);
+   }
+}
+//=================================>> User Tasks Implementations END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+
+/**
+ * @brief Executes a cycle function CyclesQty times and checks no heap memory was allocated meanwhile
+ *
+ * @param checkName Name of the check to report
+ * @param cycleFn Function executing a single cycle
+ *
+ * @retval true No allocation was detected
+ * @retval false Some allocation was detected
+ */
+bool heapCheck(const char* checkName, void (*cycleFn)()){
+   bool result{false};
+   multi_heap_info_t heapInfoBefore{};
+   multi_heap_info_t heapInfoAfter{};
+   uint32_t newQtyBefore{0};
+   uint32_t newQtyAfter{0};
+
+   heap_caps_get_info(&heapInfoBefore, MALLOC_CAP_DEFAULT);
+   newQtyBefore = newQty;
+   for(int cycle{0}; cycle < CyclesQty; cycle++)
+      cycleFn();
+   newQtyAfter = newQty;
+   heap_caps_get_info(&heapInfoAfter, MALLOC_CAP_DEFAULT);
+   result = ((newQtyAfter == newQtyBefore) && (heapInfoAfter.total_allocated_blocks == heapInfoBefore.total_allocated_blocks));
+
+   Serial.print(checkName);
+   Serial.print(": ");
+   Serial.print(newQtyAfter - newQtyBefore);
+   Serial.print(" operator new calls, ");
+   Serial.print((int32_t)(heapInfoAfter.total_allocated_blocks - heapInfoBefore.total_allocated_blocks));
+   Serial.print(" heap blocks difference -> ");
+   Serial.println(result?"PASS":"FAIL");
+
+   return result;
+}
+
+void cycleBufCntr(){
+   ClickCounter* cntrPtr = new (cntrBuf) ClickCounter(-9999, 9999);  // Placement new, uses the buffer provided
+
+   cntrPtr->begin(0);
+   cntrPtr->countUp(10);
+   cntrPtr->countDown(3);
+   cntrPtr->countToZero(2);
+   cntrPtr->snapshot();
+   cntrPtr->end();
+   cntrPtr->~ClickCounter();
+
+   return;
+}
+
+void cycleStackCntr(){
+   ClickCounter stackCntr(-9999, 9999);
+
+   stackCntr.setLockFree(true);
+   stackCntr.begin(5);
+   stackCntr.countUp();
+   stackCntr.countReset();
+   stackCntr.getTotal();
+   stackCntr.end();
+
+   return;
+}
+
+void cycleStaticCntr(){
+   staticCntr.countUp(2);
+   staticCntr.countRestart(100);
+   staticCntr.countDown(1);
+   staticCntr.getCount();
+   staticCntr.snapshot();
+
+   return;
+}
+
+void cycleTmpltCntr(){
+   ClickCounterT<-99, 99, ccOvfReject, ccLckMutex> mtxCntrT;
+
+   mtxCntrT.begin(0);
+   mtxCntrT.countUp();
+   mtxCntrT.end();
+   staticCntrT.begin(0);
+   staticCntrT.countUp(20000);
+   staticCntrT.end();
+
+   return;
+}
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_07.ino
+ *
+ * @brief Code example file to export many counters through a serial link as a binary telemetry stream
+ *
+ * @details The example keeps 64 counters in a ClickCounterBank object, modified at random by a simulated production task, and exports them through the UART2 port (TX pin GPIO17) with a ClickTelemetryEncoder object: every 100 milliseconds a frame with only the counters modified since the previous frame is sent. A key frame is sent every 50 frames, so a receiver started in the middle of the stream gets all the values in at most 5 seconds.
+ * Every 5 seconds the serial port reports the bytes sent as binary frames, and the bytes that the same updates would have taken printed as ASCII, one `<counter> <value>` line per counter and update.
+ * The stream is decoded in a Linux host by the extras/ClickTelemetryDecode program of the library.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ClickCounterBank_Esp32.h>
+#include <ClickTelemetry_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define ProdTskPrrtyLvl 3 // Simulated production task priority level
+#define SlotsQty 64 // Quantity of counters exported
+#define FramePeriodMs 100 // Time between frames
+#define ReportPeriodMs 5000 // Time between statistics reports
+#define TlmTxPin 17 // UART2 transmission pin
+#define FrameBufSz (7 + SlotsQty * 10) // Frame buffer size, the encoder worst case frame size
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+ClickTelemetryEncoder myEncoder(SlotsQty, 50);  // Built before, and destroyed after, the bank associated to it
+ClickCounterBank myBank(SlotsQty, 0, 999999);
+uint8_t frameBuf[FrameBufSz];
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void prodTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t prodTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nTelemetry example started"); //FTPO
+   Serial.println("=========================="); //FTPO
+   Serial2.begin(115200, SERIAL_8N1, -1, TlmTxPin);
+
+   if((myEncoder.getMaxFrameSize() > FrameBufSz) || !myBank.setTelemetry(&myEncoder))  // With a buffer of the worst case frame size no frame is ever truncated
+      Error_Handler();
+   if(!myBank.begin(0))
+      Error_Handler();
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+
+   // Create the simulated production task, modifying the counters
+   xReturned = xTaskCreatePinnedToCore(
+      prodTsk,  // Callback function/task to be called
+      "ProductionTask",  // Name of the task
+      2048,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ProdTskPrrtyLvl, // Priority level given to the task
+      &prodTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   size_t frameLen{0};
+   uint32_t binBytes{0};
+   uint32_t asciiBytes{0};
+   uint32_t framesQty{0};
+   int32_t prevVals[SlotsQty]{};
+   int32_t curVal{0};
+   char asciiLine[24];
+   TickType_t lastWakeTm{xTaskGetTickCount()};
+   TickType_t lastReportTm{lastWakeTm};
+
+   for(;;){
+      vTaskDelayUntil(&lastWakeTm, pdMS_TO_TICKS(FramePeriodMs));
+      frameLen = myEncoder.buildFrame(frameBuf, sizeof(frameBuf));
+      if(frameLen > 0){
+         Serial2.write(frameBuf, frameLen);
+         binBytes += frameLen;
+         framesQty++;
+      }
+      for(int slot{0}; slot < SlotsQty; slot++){   // Bytes the same updates would take as ASCII lines, measured for the report only
+         curVal = myBank.getCount(slot);
+         if(curVal != prevVals[slot]){
+            asciiBytes += snprintf(asciiLine, sizeof(asciiLine), "%d %ld\n", slot, (long)curVal);
+            prevVals[slot] = curVal;
+         }
+      }
+      if((xTaskGetTickCount() - lastReportTm) >= pdMS_TO_TICKS(ReportPeriodMs)){
+         lastReportTm = xTaskGetTickCount();
+         Serial.print("Frames sent: ");
+         Serial.print(framesQty);
+         Serial.print(", binary bytes: ");
+         Serial.print(binBytes);
+         Serial.print(", ASCII bytes: ");
+         Serial.print(asciiBytes);
+         Serial.print(", bandwidth used: ");
+         Serial.print((asciiBytes > 0)?(100.0 * binBytes / asciiBytes):(0.0), 1);
+         Serial.println("%");
+         binBytes = 0;
+         asciiBytes = 0;
+         framesQty = 0;
+      }
+   }
+}
+
+void prodTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   for(;;){
+      myBank.countUp(esp_random() % 8);   // A few counters are busy, the rest are seldom modified
+      if((esp_random() % 16) == 0)
+         myBank.countUp(esp_random() % SlotsQty);
+      vTaskDelay(pdMS_TO_TICKS(5));
+   }
+}
+//=================================>> User Tasks Implementations END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file CC_ESP32_Example_08.ino
+ *
+ * @brief Code example file to share a single display among several counters with a ClickDisplayMux object
+ *
+ * @details The example keeps three counters, one for each of three simulated production lines, and shows them in a single 4 digits TM1637 display (CLK pin GPIO16, DIO pin GPIO17) with a ClickDisplayMux object. Each counter is shown for 3 seconds, with its line label (A, b or C) in the leftmost digit and its value in the other three digits.
+ * The counters are built without a display, so their counting methods never wait for the display bus: the multiplexer task prints the display only when the shown page or the shown value changes.
+ * Every 15 seconds the first line counter is shown immediately by showPage(), and the serial port reports the three counts.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  *
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+ ******************************************************************************
+*/
+#include <Arduino.h>
+#include <SevenSegDisplays.h>
+#include <ClickCounter_Esp32.h>
+#include <ClickDisplayMux_Esp32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define ProdTskPrrtyLvl 3 // Simulated production task priority level
+#define LinesQty 3 // Quantity of simulated production lines
+#define DwellTimeMs 3000 // Time each counter is shown
+#define ReportPeriodMs 15000 // Time between reports
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+ClickCounter lineCntrs[LinesQty] {{-99, 999}, {-99, 999}, {-99, 999}};  // Built without a display, the values must fit in the 3 digits left by the label
+const char lineLbls[LinesQty] {'A', 'b', 'C'};
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void prodTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t prodTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(9600); //FTPO
+   Serial.println("\n\n\nDisplay multiplexer example started"); //FTPO
+   Serial.println("==================================="); //FTPO
+
+   for(int line{0}; line < LinesQty; line++){
+      if(!lineCntrs[line].begin(0))
+         Error_Handler();
+   }
+
+   // Create the Main control task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      mainCtrlTsk,  // Callback function/task to be called
+      "MainControlTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ssdExecTskPrrtyCnfg, // Priority level given to the task
+      &mainCtrlTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+
+   // Create the simulated production task, modifying the counters
+   xReturned = xTaskCreatePinnedToCore(
+      prodTsk,  // Callback function/task to be called
+      "ProductionTask",  // Name of the task
+      2048,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      ProdTskPrrtyLvl, // Priority level given to the task
+      &prodTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   const uint8_t dio {GPIO_NUM_17};  // Pin connected to DIO of TM1637
+   const uint8_t clk {GPIO_NUM_16}; // Pin connected to CLK of TM1637
+
+   static uint8_t myDispIOPins[2] {clk, dio}; // Pins set as an array as required by hw constructor
+
+   uint8_t theNewOrder [4] {3, 2, 1, 0};
+
+   SevenSegDispHw* myLedDispHwPtr {new SevenSegTM1637(myDispIOPins, 4, false)};
+   myLedDispHwPtr -> setDigitsOrder(theNewOrder);
+   SevenSegDisplays myLedDisp(myLedDispHwPtr);
+
+   ClickDisplayMux myDispMux(&myLedDisp, DwellTimeMs, true);
+
+   myLedDisp.begin();
+   Serial.println("Display Service Started");
+
+   for(int line{0}; line < LinesQty; line++){
+      if(!myDispMux.addCounter(&lineCntrs[line], lineLbls[line]))
+         Error_Handler();
+   }
+   if(!myDispMux.begin())
+      Error_Handler();
+   Serial.println("Display Multiplexer Service Started");
+
+   for(;;){
+      vTaskDelay(pdMS_TO_TICKS(ReportPeriodMs));
+      myDispMux.showPage(0);
+      for(int line{0}; line < LinesQty; line++){
+         Serial.print("Line ");
+         Serial.print(lineLbls[line]);
+         Serial.print(": ");
+         Serial.print(lineCntrs[line].getCount());
+         Serial.print((line < (LinesQty - 1))?(", "):("\n"));
+      }
+   }
+}
+
+void prodTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   for(;;){
+      for(int line{0}; line < LinesQty; line++){
+         if((esp_random() % (2 << line)) == 0){   // Each line produces at half the rate of the previous one
+            if(!lineCntrs[line].countUp())
+               lineCntrs[line].countReset();
+         }
+      }
+      vTaskDelay(pdMS_TO_TICKS(100));
+   }
+}
+//=================================>> User Tasks Implementations END
+
+//=======================================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+   for(;;)
+   {
+   }
+
+   return;
+}
+//=========================================>> User Functions Implementations END
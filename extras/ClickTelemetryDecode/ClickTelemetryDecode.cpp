@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file ClickTelemetryDecode.cpp
+ *
+ * @brief Host side decoder for the telemetry stream built by the ClickTelemetryEncoder class
+ *
+ * @details The program reads the binary telemetry stream from a serial device, a file or the standard input, decodes it with the library's ClickTelemetryDecoder class, and prints one line for each channel whose value changed, as `<channel> <value>`. The link state is reported to the standard error output.
+ *
+ * Build it in a Linux host from this directory with:
+ * `g++ -std=c++11 -O2 -I../../src ClickTelemetryDecode.cpp ../../src/ClickTelemetry_ESP32.cpp -o cctlmdec`
+ * or with the host CMake build in the repository root, that builds it with the unit tests.
+ *
+ * Usage: `cctlmdec <channels quantity> [<input path>]`, i.e. after setting the serial port with `stty -F /dev/ttyUSB0 115200 raw`, run `cctlmdec 64 /dev/ttyUSB0`. If no input path is provided the standard input is read.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++11 host
+ *
+ * @author	: Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 GMT+0200 DST
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <ClickTelemetry_Esp32.h>
+
+int main(int argc, char* argv[]){
+   size_t chnlsQty{0};
+   FILE* inPtr{stdin};
+   int32_t* prevArr{nullptr};
+   uint8_t rdBuf[256];
+   size_t rdQty{0};
+   bool wasSynced{false};
+
+   if((argc < 2) || (argc > 3)){
+      fprintf(stderr, "Usage: %s <channels quantity> [<input path>]\n", argv[0]);
+      return 1;
+   }
+   chnlsQty = strtoul(argv[1], nullptr, 10);
+   if(argc == 3){
+      inPtr = fopen(argv[2], "rb");
+      if(inPtr == nullptr){
+         fprintf(stderr, "Can't open %s\n", argv[2]);
+         return 1;
+      }
+   }
+   ClickTelemetryDecoder decoder(chnlsQty);
+   if(decoder.getChnlsQty() == 0){
+      fprintf(stderr, "Invalid channels quantity: %s\n", argv[1]);
+      return 1;
+   }
+   prevArr = new int32_t[chnlsQty]();
+
+   while((rdQty = fread(rdBuf, 1, sizeof(rdBuf), inPtr)) > 0){
+      if(decoder.feed(rdBuf, rdQty) > 0){
+         for(size_t chnl{0}; chnl < chnlsQty; chnl++){
+            if(decoder.getValue(chnl) != prevArr[chnl]){
+               prevArr[chnl] = decoder.getValue(chnl);
+               printf("%zu %ld\n", chnl, static_cast<long>(prevArr[chnl]));
+            }
+         }
+         fflush(stdout);
+      }
+      if(decoder.isSynced() != wasSynced){
+         wasSynced = decoder.isSynced();
+         fprintf(stderr, wasSynced?"Synchronized\n":"Synchronization lost, waiting for a key frame\n");
+      }
+   }
+   fprintf(stderr, "Frame errors: %lu, frames lost: %lu\n", static_cast<unsigned long>(decoder.getFrameErrQty()), static_cast<unsigned long>(decoder.getLostQty()));
+
+   delete [] prevArr;
+   if(inPtr != stdin)
+      fclose(inPtr);
+
+   return 0;
+}
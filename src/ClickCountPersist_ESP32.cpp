@@ -0,0 +1,270 @@
+/**
+ ******************************************************************************
+ * @file ClickCountPersist_Esp32.cpp
+ *
+ * @brief Code file for the ClickCountPersist class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickCountPersist class keeps a ClickCounter total count in a non volatile storage, as an append-only log of checkpoints and delta records.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <ClickCountPersist_Esp32.h>
+#include <ClickCounter_Esp32.h>
+
+ClickCountPersist::ClickCountPersist(ClickStorage* strgPtr, const uint32_t &cmmtMs, const uint32_t &cmmtClks)
+:_strgPtr{strgPtr}, _cmmtClks{cmmtClks}
+{
+   _cmmtTcks = pdMS_TO_TICKS(cmmtMs);
+   if(_cmmtTcks == 0)
+      _cmmtTcks = 1;
+}
+
+ClickCountPersist::~ClickCountPersist()
+{
+   end();
+}
+
+bool ClickCountPersist::begin(ClickCounter* cntrPtr, const UBaseType_t &tskPrrty){
+   bool result{false};
+   int64_t rstrdTtl{0};
+   TaskHandle_t tskHndl{nullptr};
+
+   if((_cmmtTskHndl.load() == nullptr) && (cntrPtr != nullptr) && _strgOk()){
+      if(!_scnd)
+         restore(rstrdTtl);   // Sets the log writing position, even if the counter didn't use the restored value
+      _cntrPtr = cntrPtr;
+      _cmmtTskStop.store(false);
+      _pndngClks.store(0);
+      if(xTaskCreate(_cmmtTsk, "CCPrstCmmtTsk", _cmmtTskStckSz, this, tskPrrty, &tskHndl) == pdPASS){
+         _cmmtTskHndl.store(tskHndl);
+         xTaskNotifyGive(tskHndl);   // The first commit registers the starting total if it differs from the restored one
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCountPersist::end(){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   _cmmtTskUsrs.fetch_add(1);
+   tskHndl = _cmmtTskHndl.load();
+   if(tskHndl != nullptr){
+      _cmmtTskStop.store(true);
+      xTaskNotifyGive(tskHndl);
+   }
+   _cmmtTskUsrs.fetch_sub(1);
+   if(tskHndl != nullptr){
+      while(_cmmtTskStop.load())   // Cleared by the task as its last access to the object
+         vTaskDelay(1);
+      _scnd = false;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCountPersist::flush(const bool &checkpoint){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   _cmmtTskUsrs.fetch_add(1);
+   tskHndl = _cmmtTskHndl.load();
+   if(tskHndl != nullptr){
+      if(checkpoint)
+         _ckptRqst.store(true);
+      xTaskNotifyGive(tskHndl);
+      result = true;
+   }
+   _cmmtTskUsrs.fetch_sub(1);
+
+   return result;
+}
+
+uint32_t ClickCountPersist::getWriteErrQty(const bool &reset){
+   uint32_t result{0};
+
+   if(reset)
+      result = _wrtErrQty.exchange(0);
+   else
+      result = _wrtErrQty.load();
+
+   return result;
+}
+
+void IRAM_ATTR ClickCountPersist::notify(const uint32_t &clicks, BaseType_t* pxHigherPriorityTaskWoken){
+   uint32_t prevClks{_pndngClks.fetch_add(clicks, std::memory_order_relaxed)};
+   TaskHandle_t tskHndl{nullptr};
+
+   if((_cmmtClks != 0) && (prevClks < _cmmtClks) && ((static_cast<uint64_t>(prevClks) + clicks) >= _cmmtClks)){   // Only the modification crossing the threshold notifies the task
+      _cmmtTskUsrs.fetch_add(1);
+      tskHndl = _cmmtTskHndl.load();
+      if(tskHndl != nullptr){
+         if(xPortInIsrContext())
+            vTaskNotifyGiveFromISR(tskHndl, pxHigherPriorityTaskWoken);
+         else
+            xTaskNotifyGive(tskHndl);
+      }
+      _cmmtTskUsrs.fetch_sub(1);
+   }
+
+   return;
+}
+
+bool ClickCountPersist::restore(int64_t &total){
+   bool result{false};
+   ccPrstHdr_t hdr{};
+   ccPrstRcrd_t rcrdsBuf[_rstrRcrdsPerRd];
+   uint32_t sctrSize{0};
+   uint32_t rcrdsQty{0};
+   bool logEnd{false};
+
+   if((_cmmtTskHndl.load() == nullptr) && _strgOk()){
+      sctrSize = _strgPtr->getSctrSize();
+      _ckptNdd = true;
+      _gen = 0;
+      for(uint32_t sctr{0}; sctr < _strgPtr->getSctrsQty(); sctr++){
+         if(_strgPtr->read(sctr * sctrSize, &hdr, sizeof(hdr))){
+            if((hdr.magic == _hdrMagic) && (hdr.chk == _hdrChk(hdr)) && (!result || (hdr.gen > _gen))){
+               _curSctr = sctr;
+               _gen = hdr.gen;
+               _lastTtl = hdr.total;
+               result = true;
+            }
+         }
+      }
+      if(result){
+         _ckptNdd = false;
+         _wrtOffs = sizeof(ccPrstHdr_t);
+         while(!logEnd && ((_wrtOffs + sizeof(ccPrstRcrd_t)) <= sctrSize)){
+            rcrdsQty = (sctrSize - _wrtOffs) / sizeof(ccPrstRcrd_t);
+            if(rcrdsQty > _rstrRcrdsPerRd)
+               rcrdsQty = _rstrRcrdsPerRd;
+            if(!_strgPtr->read(_curSctr * sctrSize + _wrtOffs, rcrdsBuf, rcrdsQty * sizeof(ccPrstRcrd_t))){
+               _ckptNdd = true;
+               break;
+            }
+            for(uint32_t i{0}; i < rcrdsQty; i++){
+               if((rcrdsBuf[i].delta == -1) && (rcrdsBuf[i].chk == UINT32_MAX)){   // Erased record, the end of the log
+                  logEnd = true;
+                  break;
+               }
+               if(rcrdsBuf[i].chk != _rcrdChk(rcrdsBuf[i].delta, _gen, _wrtOffs)){   // Record left incomplete, the rest of the sector can't be written
+                  _ckptNdd = true;
+                  logEnd = true;
+                  break;
+               }
+               _lastTtl += rcrdsBuf[i].delta;
+               _wrtOffs += sizeof(ccPrstRcrd_t);
+            }
+         }
+         total = _lastTtl;
+      }
+      _scnd = true;
+   }
+
+   return result;
+}
+
+void ClickCountPersist::_commit(const int64_t &total, const bool &ckpt){
+   int64_t delta{total - _lastTtl};
+   ccPrstRcrd_t rcrd{};
+
+   if(ckpt || _ckptNdd || (delta < INT32_MIN) || (delta > INT32_MAX) || ((_wrtOffs + sizeof(ccPrstRcrd_t)) > _strgPtr->getSctrSize())){
+      if(!_wrtCkpt(total))
+         _wrtErrQty.fetch_add(1);
+   }
+   else if(delta != 0){
+      rcrd.delta = static_cast<int32_t>(delta);
+      rcrd.chk = _rcrdChk(rcrd.delta, _gen, _wrtOffs);
+      if(_strgPtr->write(_curSctr * _strgPtr->getSctrSize() + _wrtOffs, &rcrd, sizeof(rcrd))){
+         _wrtOffs += sizeof(rcrd);
+         _lastTtl = total;
+      }
+      else{
+         _ckptNdd = true;   // The record position might be partially written, the next commit starts a new sector
+         _wrtErrQty.fetch_add(1);
+      }
+   }
+
+   return;
+}
+
+void ClickCountPersist::_cmmtTsk(void* argp){
+   ClickCountPersist* prstPtr = static_cast<ClickCountPersist*>(argp);
+   bool stop{false};
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, prstPtr->_cmmtTcks);
+      stop = prstPtr->_cmmtTskStop.load();
+      prstPtr->_pndngClks.store(0, std::memory_order_relaxed);
+      prstPtr->_commit(prstPtr->_cntrPtr->getTotal(), prstPtr->_ckptRqst.exchange(false));
+      if(stop)
+         break;
+   }
+   prstPtr->_cmmtTskHndl.store(nullptr);
+   while(prstPtr->_cmmtTskUsrs.load() != 0)   // Notifiers that read the handle before it was cleared finish using it
+      vTaskDelay(1);
+   prstPtr->_cmmtTskStop.store(false);   // The last access to the object, end() returns after it
+   vTaskDelete(NULL);
+}
+
+uint32_t ClickCountPersist::_hdrChk(const ccPrstHdr_t &hdr){
+   uint16_t crc{ccCrc16(&hdr.magic, sizeof(hdr.magic))};
+
+   crc = ccCrc16(&hdr.gen, sizeof(hdr.gen), crc);
+   crc = ccCrc16(&hdr.total, sizeof(hdr.total), crc);
+
+   return crc;   // The upper half is 0, an erased header never matches
+}
+
+uint32_t ClickCountPersist::_rcrdChk(const int32_t &delta, const uint32_t &gen, const uint32_t &offs){
+   uint16_t crc{ccCrc16(&gen, sizeof(gen))};   // A record left from a previous sector use, or read at a wrong position, doesn't match
+
+   crc = ccCrc16(&offs, sizeof(offs), crc);
+   crc = ccCrc16(&delta, sizeof(delta), crc);
+
+   return crc;   // The upper half is 0, an erased record never matches
+}
+
+bool ClickCountPersist::_strgOk(){
+
+   return ((_strgPtr != nullptr) && (_strgPtr->getSctrsQty() >= 2) && (_strgPtr->getSctrSize() >= (sizeof(ccPrstHdr_t) + sizeof(ccPrstRcrd_t))));
+}
+
+bool ClickCountPersist::_wrtCkpt(const int64_t &total){
+   bool result{false};
+   ccPrstHdr_t hdr{_hdrMagic, _gen + 1, total, 0, 0};
+   uint32_t nxtSctr{(_curSctr + 1) % _strgPtr->getSctrsQty()};
+
+   hdr.chk = _hdrChk(hdr);
+   if(_strgPtr->erase(nxtSctr)){   // The current sector is kept untouched until the new checkpoint is completely written
+      if(_strgPtr->write(nxtSctr * _strgPtr->getSctrSize(), &hdr, sizeof(hdr))){
+         _curSctr = nxtSctr;
+         _gen = hdr.gen;
+         _wrtOffs = sizeof(hdr);
+         _lastTtl = total;
+         _ckptNdd = false;
+         result = true;
+      }
+   }
+
+   return result;
+}
@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @file ClickCountPersist_Esp32.h
+ *
+ * @brief Header file for the ClickCountPersist class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickCountPersist class keeps a ClickCounter total count in a non volatile storage, so the count survives power losses and reboots. The count modifications are not written one by one: a background task periodically writes the net change of the total as a single small record appended to a log, so thousands of clicks cost a single write, and the counting methods never wait for the storage.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKCOUNTPERSIST_ESP32_H_
+#define _CLICKCOUNTPERSIST_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+#include <ClickStorage_Esp32.h>
+#include <ClickTelemetry_Esp32.h>
+
+class ClickCounter;
+
+/**
+ * @class ClickCountPersist
+ *
+ * @brief Models the persistence of a ClickCounter object total count in a ClickStorage.
+ *
+ * The storage sectors are used as an append-only circular log:
+ * - Each sector starts with a checkpoint header holding the complete total count and the sector generation number.
+ * - The rest of the sector holds delta records, each one with the net change of the total since the previous record.
+ * - When a sector is full, or a checkpoint is requested, the next sector is erased and started with a new checkpoint. The sectors are used one after the other, spreading the erase cycles over all of them.
+ *
+ * The total is restored by finding the sector with the highest generation and adding its delta records to its checkpoint, so the restore time is bounded by the quantity of sectors plus the size of one sector, independently of the time the counter has been working. Records and headers carry a CRC-16 check value, records computed over their generation and storage position too: a record left incomplete by a power loss is discarded, the total restored from the records before it and a new checkpoint forced, and an incomplete checkpoint makes the previous sector, never erased before the new checkpoint is completely written, to be used.
+ *
+ * The commit task wakes once every commit period, or earlier when the clicks pending to be committed reach a threshold, and writes a single record with the net change of the total. The counting methods only add their clicks to an atomic accumulator and, when the threshold is crossed, notify the task: they never block on the storage.
+ *
+ * @note A power loss loses at most the count modifications made since the last commit.
+ */
+class ClickCountPersist{
+private:
+   struct ccPrstHdr_t{
+      uint32_t magic;
+      uint32_t gen;
+      int64_t total;
+      uint32_t chk;
+      uint32_t rsrvd;
+   };
+   struct ccPrstRcrd_t{
+      int32_t delta;
+      uint32_t chk;
+   };
+   static const uint32_t _hdrMagic{0x4343504C};
+   static const uint8_t _rstrRcrdsPerRd{16};
+   static const uint32_t _cmmtTskStckSz{3072};
+
+   ClickStorage* _strgPtr{nullptr};
+   ClickCounter* _cntrPtr{nullptr};
+   TickType_t _cmmtTcks{1};
+   uint32_t _cmmtClks{0};
+   std::atomic<uint32_t> _pndngClks{0};
+   std::atomic<TaskHandle_t> _cmmtTskHndl{nullptr};
+   std::atomic<bool> _cmmtTskStop{false};
+   std::atomic<uint32_t> _cmmtTskUsrs{0};   // Notifiers using the task handle, the task is not deleted while they do
+   std::atomic<bool> _ckptRqst{false};
+   std::atomic<uint32_t> _wrtErrQty{0};
+   bool _scnd{false};
+   bool _ckptNdd{true};
+   uint32_t _curSctr{0};
+   uint32_t _gen{0};
+   uint32_t _wrtOffs{0};
+   int64_t _lastTtl{0};
+
+   void _commit(const int64_t &total, const bool &ckpt);
+   static void _cmmtTsk(void* argp);
+   static uint32_t _hdrChk(const ccPrstHdr_t &hdr);
+   static uint32_t _rcrdChk(const int32_t &delta, const uint32_t &gen, const uint32_t &offs);
+   bool _strgOk();
+   bool _wrtCkpt(const int64_t &total);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param strgPtr Pointer to the instantiated ClickStorage subclass object (PartitionStorage, FileStorage, or user defined subclasses) to keep the log. The storage must have at least 2 sectors, and must be used by a single ClickCountPersist object.
+    * @param cmmtMs (Optional) Commit period in milliseconds, the maximum time a count modification waits to be written. If not provided a value of 1000 will be used.
+    * @param cmmtClks (Optional) Quantity of clicks (absolute values of the count modifications) that trigger a commit before the commit period ends. A value of 0 disables the threshold. If not provided the threshold will be disabled.
+    */
+   ClickCountPersist(ClickStorage* strgPtr, const uint32_t &cmmtMs = 1000, const uint32_t &cmmtClks = 0);
+   /**
+    * @brief Class destructor.
+    *
+    * Stops the commit task, if running, after a last commit.
+    */
+   ~ClickCountPersist();
+   /**
+    * @brief Starts the commit task for a counter.
+    *
+    * This method is invoked by ClickCounter::begin(const int32_t &) for the object associated by ClickCounter::setPersistence(ClickCountPersist*), after the count was restored.
+    *
+    * @param cntrPtr Pointer to the counter whose total count will be persisted.
+    * @param tskPrrty (Optional) Priority level given to the commit task. If not provided a value of 1 will be used.
+    *
+    * @retval true The task was created.
+    * @retval false The task was already running, the cntrPtr parameter was nullptr, the storage is not usable, or the task creation failed.
+    */
+   bool begin(ClickCounter* cntrPtr, const UBaseType_t &tskPrrty = 1);
+   /**
+    * @brief Commits the pending modifications and stops the commit task.
+    *
+    * This method is invoked by ClickCounter::end() before the counter is disabled. The caller is blocked until the last commit is completed.
+    *
+    * @retval true The task was running and it was stopped.
+    * @retval false The task was not running.
+    */
+   bool end();
+   /**
+    * @brief Requests an immediate commit.
+    *
+    * The commit is executed by the commit task, the caller is not blocked. Use it before a planned shutdown, or after an important count modification.
+    *
+    * @param checkpoint (Optional) Indicates if the commit must start a new sector with a checkpoint instead of appending a delta record. If not provided a delta record will be appended.
+    *
+    * @retval true The commit task is running and was notified.
+    * @retval false The commit task is not running.
+    */
+   bool flush(const bool &checkpoint = false);
+   /**
+    * @brief Returns the quantity of storage writes that failed.
+    *
+    * A failed write is retried by the next commit in a new sector, so no count modification is lost unless the storage is permanently damaged.
+    *
+    * @param reset (Optional) Indicates if the failed writes counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of failed writes since the object was built or since the last reset.
+    */
+   uint32_t getWriteErrQty(const bool &reset = false);
+   /**
+    * @brief Registers clicks pending to be committed.
+    *
+    * This method is invoked by the counting methods of the associated ClickCounter object, it's ISR safe and never blocks: it adds the clicks to an atomic accumulator, and notifies the commit task only when the accumulated clicks cross the commit threshold.
+    *
+    * @param clicks Absolute value of the count modification.
+    * @param pxHigherPriorityTaskWoken (Optional) Pointer to a BaseType_t variable, set to pdTRUE if notifying the commit task from an ISR unblocked a task of higher priority than the interrupted one. May be nullptr.
+    */
+   void notify(const uint32_t &clicks, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   /**
+    * @brief Reads the last total count committed to the storage.
+    *
+    * This method is invoked by ClickCounter::begin(const int32_t &) for the object associated by ClickCounter::setPersistence(ClickCountPersist*). The storage read time is bounded by the quantity of sectors plus the size of a single sector.
+    *
+    * @param total Variable where the restored total count will be stored.
+    *
+    * @retval true A valid checkpoint was found, the total parameter holds the last total committed.
+    * @retval false The commit task is running, the storage is not usable, or the storage holds no valid checkpoint (i.e. it was never used). The total parameter is not modified.
+    */
+   bool restore(int64_t &total);
+};
+
+#endif   // _CLICKCOUNTPERSIST_ESP32_H_
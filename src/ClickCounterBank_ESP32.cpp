@@ -0,0 +1,335 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterBank_Esp32.cpp
+ *
+ * @brief Code file for the ClickCounterBank class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickCounterBank class models a set of counters whose attributes are kept in contiguous arrays indexed by the counter (slot) number.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <new>
+#include <ClickCounterBank_Esp32.h>
+
+ClickCounterBank::ClickCounterBank(const size_t &slotsQty, int32_t countMin, int32_t countMax)
+{
+   if(slotsQty > 0){
+      _countArr = new(std::nothrow) std::atomic<int32_t>[slotsQty];
+      _minArr = new(std::nothrow) int32_t[slotsQty];
+      _maxArr = new(std::nothrow) int32_t[slotsQty];
+      if((_countArr != nullptr) && (_minArr != nullptr) && (_maxArr != nullptr)){
+         for(size_t i{0}; i < slotsQty; i++){
+            _countArr[i].store(0, std::memory_order_relaxed);
+            _minArr[i] = countMin;
+            _maxArr[i] = countMax;
+         }
+         _slotsQty = slotsQty;
+      }
+   }
+}
+
+ClickCounterBank::~ClickCounterBank()
+{
+   if(_tlmPtr != nullptr){
+      for(size_t i{0}; i < _slotsQty; i++)
+         _tlmPtr->bindChannel(_tlmFrstChnl + i, nullptr);
+   }
+   delete [] _countArr;
+   delete [] _minArr;
+   delete [] _maxArr;
+   delete [] _dsplyArr;
+   delete [] _flagsArr;
+   if(_dspMutex != nullptr)
+      vSemaphoreDelete(_dspMutex);
+}
+
+bool ClickCounterBank::addDeltas(const int32_t* deltasPtr, const size_t &firstSlot, const size_t &qty, bool* rsltsPtr){
+   bool result{false};
+   bool slotRslt{false};
+
+   if(_begun && (deltasPtr != nullptr) && (firstSlot < _slotsQty) && (qty <= (_slotsQty - firstSlot))){
+      result = true;
+      for(size_t i{0}; i < qty; i++){
+         slotRslt = true;
+         if(deltasPtr[i] != 0){
+            slotRslt = _slotAddInRng(firstSlot + i, deltasPtr[i]);
+            if(slotRslt)
+               slotRslt = _slotUpdDisplay(firstSlot + i);
+         }
+         if(rsltsPtr != nullptr)
+            rsltsPtr[i] = slotRslt;
+         if(!slotRslt)
+            result = false;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::begin(const int32_t &startVal){
+   bool result{false};
+
+   if(!_begun && (_slotsQty > 0)){
+      result = true;
+      for(size_t i{0}; i < _slotsQty; i++){
+         if((_minArr[i] >= _maxArr[i]) || (startVal < _minArr[i]) || (startVal > _maxArr[i])){
+            result = false;
+            break;
+         }
+      }
+      if(result){
+         _beginStartVal = startVal;
+         _begun = true;
+         result = countResetAll();
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::countDown(const size_t &slot, const int32_t &qty){
+   bool result{false};
+   int32_t locQty = (qty == INT32_MIN)?(INT32_MAX):(abs(qty));
+
+   if(_begun && (slot < _slotsQty) && (locQty > 0)){
+      result = _slotAddInRng(slot, -locQty);
+      if(result)
+         result = _slotUpdDisplay(slot);
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::countReset(const size_t &slot){
+
+   return countRestart(slot, _beginStartVal);
+}
+
+bool ClickCounterBank::countResetAll(){
+   bool result{false};
+
+   if(_begun){
+      result = true;
+      for(size_t i{0}; i < _slotsQty; i++){
+         _countArr[i].store(_beginStartVal, std::memory_order_release);
+         _slotTlmMark(i);
+         if(!_slotUpdDisplay(i))
+            result = false;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::countRestart(const size_t &slot, const int32_t &restartValue){
+   bool result{false};
+
+   if(_begun && (slot < _slotsQty)){
+      if((restartValue >= _minArr[slot]) && (restartValue <= _maxArr[slot])){
+         _countArr[slot].store(restartValue, std::memory_order_release);
+         _slotTlmMark(slot);
+         result = _slotUpdDisplay(slot);
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::countUp(const size_t &slot, const int32_t &qty){
+   bool result{false};
+   int32_t locQty = (qty == INT32_MIN)?(INT32_MAX):(abs(qty));
+
+   if(_begun && (slot < _slotsQty) && (locQty > 0)){
+      result = _slotAddInRng(slot, locQty);
+      if(result)
+         result = _slotUpdDisplay(slot);
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::end(){
+   bool result{false};
+
+   if(_begun){
+      _begun = false;
+      result = true;
+   }
+
+   return result;
+}
+
+int32_t ClickCounterBank::getCount(const size_t &slot){
+   int32_t result{0};
+
+   if(slot < _slotsQty)
+      result = _countArr[slot].load(std::memory_order_acquire);
+
+   return result;
+}
+
+int32_t ClickCounterBank::getMaxCountVal(const size_t &slot){
+   int32_t result{0};
+
+   if(slot < _slotsQty)
+      result = _maxArr[slot];
+
+   return result;
+}
+
+int32_t ClickCounterBank::getMinCountVal(const size_t &slot){
+   int32_t result{0};
+
+   if(slot < _slotsQty)
+      result = _minArr[slot];
+
+   return result;
+}
+
+size_t ClickCounterBank::getSlotsQty(){
+
+   return _slotsQty;
+}
+
+int32_t ClickCounterBank::getStartVal(){
+
+   return _beginStartVal;
+}
+
+bool ClickCounterBank::setSlotDisplay(const size_t &slot, SevenSegDisplays* dsplyPtr, bool rgthAlgn, bool zeroPad){
+   bool result{false};
+
+   if(!_begun && (slot < _slotsQty)){
+      if(_dsplyArr == nullptr){   // The display related arrays are only allocated if a display is bound
+         _dsplyArr = new(std::nothrow) SevenSegDisplays*[_slotsQty]();
+         _flagsArr = new(std::nothrow) uint8_t[_slotsQty]();
+         _dspMutex = xSemaphoreCreateMutexStatic(&_dspMtxBuf);
+         if((_dsplyArr == nullptr) || (_flagsArr == nullptr) || (_dspMutex == nullptr)){
+            delete [] _dsplyArr;
+            delete [] _flagsArr;
+            if(_dspMutex != nullptr)
+               vSemaphoreDelete(_dspMutex);
+            _dsplyArr = nullptr;
+            _flagsArr = nullptr;
+            _dspMutex = nullptr;
+         }
+      }
+      if(_dsplyArr != nullptr){
+         _dsplyArr[slot] = dsplyPtr;
+         _flagsArr[slot] = (rgthAlgn?_flgRgthAlgn:0) | (zeroPad?_flgZeroPad:0);
+         if(dsplyPtr != nullptr){
+            _minArr[slot] = dsplyPtr->getDspValMin();
+            _maxArr[slot] = dsplyPtr->getDspValMax();
+         }
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::setSlotRange(const size_t &slot, const int32_t &countMin, const int32_t &countMax){
+   bool result{false};
+
+   if(!_begun && (slot < _slotsQty) && (countMin < countMax)){
+      _minArr[slot] = countMin;
+      _maxArr[slot] = countMax;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::setTelemetry(ClickTelemetryEncoder* tlmPtr, const size_t &frstChnl){
+   bool result{false};
+
+   if(!_begun && ((tlmPtr == nullptr) || ((frstChnl < tlmPtr->getChnlsQty()) && (_slotsQty <= (tlmPtr->getChnlsQty() - frstChnl))))){
+      if(_tlmPtr != nullptr){
+         for(size_t i{0}; i < _slotsQty; i++)
+            _tlmPtr->bindChannel(_tlmFrstChnl + i, nullptr);
+      }
+      _tlmPtr = tlmPtr;
+      _tlmFrstChnl = frstChnl;
+      if(_tlmPtr != nullptr){
+         for(size_t i{0}; i < _slotsQty; i++)
+            _tlmPtr->bindChannel(_tlmFrstChnl + i, &_countArr[i]);
+      }
+      result = true;
+   }
+
+   return result;
+}
+
+size_t ClickCounterBank::snapshot(int32_t* dstPtr, const size_t &firstSlot, const size_t &qty){
+   size_t result{0};
+
+   if((dstPtr != nullptr) && (firstSlot < _slotsQty)){
+      result = _slotsQty - firstSlot;
+      if(qty < result)
+         result = qty;
+      for(size_t i{0}; i < result; i++)
+         dstPtr[i] = _countArr[firstSlot + i].load(std::memory_order_acquire);
+   }
+
+   return result;
+}
+
+bool ClickCounterBank::updDisplay(const size_t &slot){
+   bool result{false};
+
+   if(slot < _slotsQty)
+      result = _slotUpdDisplay(slot);
+
+   return result;
+}
+
+bool IRAM_ATTR ClickCounterBank::_slotAddInRng(const size_t &slot, const int32_t &delta){
+   bool result{false};
+   int32_t curVal{_countArr[slot].load(std::memory_order_relaxed)};
+   int64_t locNewVal{0};
+
+   do{
+      locNewVal = static_cast<int64_t>(curVal) + delta;
+      result = ((locNewVal >= _minArr[slot]) && (locNewVal <= _maxArr[slot]));
+   }while(result && !_countArr[slot].compare_exchange_weak(curVal, static_cast<int32_t>(locNewVal), std::memory_order_acq_rel, std::memory_order_relaxed));
+   if(result)
+      _slotTlmMark(slot);
+
+   return result;
+}
+
+void IRAM_ATTR ClickCounterBank::_slotTlmMark(const size_t &slot){
+   if(_tlmPtr != nullptr)
+      _tlmPtr->markChanged(_tlmFrstChnl + slot);
+
+   return;
+}
+
+bool ClickCounterBank::_slotUpdDisplay(const size_t &slot){
+   bool result{true};
+
+   if((_dsplyArr != nullptr) && (_dsplyArr[slot] != nullptr)){
+      result = false;
+      if(xSemaphoreTake(_dspMutex, portMAX_DELAY) == pdTRUE){
+         result = _dsplyArr[slot]->print(_countArr[slot].load(std::memory_order_acquire), (_flagsArr[slot] & _flgRgthAlgn) != 0, (_flagsArr[slot] & _flgZeroPad) != 0);   // The count is read after taking the mutex, so the last print shows the last value
+         xSemaphoreGive(_dspMutex);
+      }
+   }
+
+   return result;
+}
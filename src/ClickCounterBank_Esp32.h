@@ -0,0 +1,264 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterBank_Esp32.h
+ *
+ * @brief Header file for the ClickCounterBank class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickCounterBank class models a set of counters sharing the same services, intended for applications that keep hundreds of counters in the same controller (one counter per bin, lane, item, etc.). Instead of building one ClickCounter object per counter, each one with it's own mutex, display pointer, flags and range limits, the bank keeps each of those attributes in a contiguous array indexed by the counter (slot) number. Each slot count is updated atomically without locking, and the bank provides bulk operations over all the slots.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKCOUNTERBANK_ESP32_H_
+#define _CLICKCOUNTERBANK_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+#include <SevenSegDisplays.h>
+#include <ClickTelemetry_Esp32.h>
+
+/**
+ * @class ClickCounterBank
+ *
+ * @brief Models a fixed quantity of counters (slots) stored as contiguous arrays.
+ *
+ * Every slot has it's own valid range and count, and might optionally be bound to a SevenSegDisplays object. The counting methods of each slot are lock-free when the slot has no display bound, the display updates of all the slots are serialized by a single mutex, created only when the first display is bound.
+ * The bulk operations (countResetAll(), addDeltas(), snapshot()) process the slots one after the other, each slot is atomically updated or read, but the bulk operation as a whole is not atomic: counting operations executed meanwhile on other slots might or might not be reflected.
+ */
+class ClickCounterBank{
+private:
+   static const uint8_t _flgRgthAlgn{0x01};
+   static const uint8_t _flgZeroPad{0x02};
+
+   size_t _slotsQty{0};
+   std::atomic<int32_t>* _countArr{nullptr};
+   int32_t* _minArr{nullptr};
+   int32_t* _maxArr{nullptr};
+   SevenSegDisplays** _dsplyArr{nullptr};
+   uint8_t* _flagsArr{nullptr};
+   SemaphoreHandle_t _dspMutex{nullptr};
+   StaticSemaphore_t _dspMtxBuf;
+   ClickTelemetryEncoder* _tlmPtr{nullptr};
+   size_t _tlmFrstChnl{0};
+   int32_t _beginStartVal{0};
+   bool _begun{false};
+
+   bool _slotAddInRng(const size_t &slot, const int32_t &delta);
+   void _slotTlmMark(const size_t &slot);
+   bool _slotUpdDisplay(const size_t &slot);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * All the slots are built with the same valid range, that might be individually modified before the bank is started, see setSlotRange(const size_t &, const int32_t &, const int32_t &).
+    *
+    * @param slotsQty Quantity of counters (slots) in the bank.
+    * @param countMin Left side limit (minimum) for the slots valid range segment. The valid count range minimum value is included as a valid counting value.
+    * @param countMax Right side limit (maximum) for the slots valid range segment. The valid count range maximum value is included as a valid counting value.
+    *
+    * @note If the arrays can't be allocated the bank is built with no slots, and getSlotsQty() will return 0.
+    */
+   ClickCounterBank(const size_t &slotsQty, int32_t countMin, int32_t countMax);
+   /**
+    * @brief Class destructor.
+    */
+   ~ClickCounterBank();
+   /**
+    * @brief Copy constructor, deleted: the object owns its mutex, and the tasks, queues and linked objects reference it by its address.
+    */
+   ClickCounterBank(const ClickCounterBank&) = delete;
+   /**
+    * @brief Copy assignment operator, deleted for the same reasons as the copy constructor.
+    */
+   ClickCounterBank& operator=(const ClickCounterBank&) = delete;
+   /**
+    * @brief Adds a vector of deltas to a range of consecutive slots.
+    *
+    * Each delta is added to it's slot only if the resulting count stays in the slot valid range, a delta failing to be added doesn't prevent the rest of the deltas from being added.
+    *
+    * @param deltasPtr Pointer to the array of deltas to add, deltasPtr[i] is added to the slot firstSlot + i. A delta equal to 0 leaves the slot unmodified and is considered successfully added.
+    * @param firstSlot Number of the slot the first delta is added to.
+    * @param qty Quantity of elements of the deltasPtr array to add.
+    * @param rsltsPtr (Optional) Pointer to an array of at least qty elements where the success of each delta addition will be stored. If not provided or nullptr, the individual results are not reported.
+    *
+    * @retval true The bank is begun, the slots range is valid and all the deltas were added.
+    * @retval false The bank is not begun, the slots range exceeds the bank size, or at least one of the deltas couldn't be added.
+    */
+   bool addDeltas(const int32_t* deltasPtr, const size_t &firstSlot, const size_t &qty, bool* rsltsPtr = nullptr);
+   /**
+    * @brief Sets the basic required parameters for the object to start working.
+    *
+    * @param startVal (Optional) Initial value for all the slots, if no parameter is provided a default value of 0 (zero) will be used. The parameter must be within the valid range of every slot.
+    *
+    * @return The success in setting the needed attribute values for the object to start working.
+    * @retval true The object was not previously begun, every slot valid range is correctly defined and the startVal parameter is in every slot valid range. The object is started.
+    * @retval false One of the previously described conditions failed, the object is not ready to be used.
+    */
+   bool begin(const int32_t &startVal = 0);
+   /**
+    * @brief Decrements the value of a slot count.
+    *
+    * @param slot Number of the slot to decrement.
+    * @param qty Optional integer value, its **absolute** value will be decremented from the slot count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.
+    *
+    * @retval true The slot count could be decremented by the corresponding value without setting it out of range.
+    * @retval false The qty parameter was equal to 0, the object was not begun, the slot doesn't exist, or the count couldn't be decremented without getting out of range. The slot will keep its current value.
+    */
+   bool countDown(const size_t &slot, const int32_t &qty = 1);
+   /**
+    * @brief Resets a slot to the value provided when the bank was started with the begin(const int32_t &) method.
+    *
+    * @param slot Number of the slot to reset.
+    *
+    * @return See countRestart(const size_t &, const int32_t &)
+    */
+   bool countReset(const size_t &slot);
+   /**
+    * @brief Resets all the slots to the value provided when the bank was started with the begin(const int32_t &) method.
+    *
+    * @retval true The bank was begun, all the slots were reset.
+    * @retval false The bank was not begun, or the display of at least one of the slots failed to be updated.
+    */
+   bool countResetAll();
+   /**
+    * @brief Restarts a slot count from the value provided as parameter.
+    *
+    * @param slot Number of the slot to restart.
+    * @param restartValue Optional integer value, a value of 0 is set if no parameter is provided. The parameter must be in the slot valid range.
+    *
+    * @retval true The object was begun, the slot exists and the parameter value was within the slot valid range, count restart succeeded.
+    * @retval false One of the previously described conditions failed, count restart failed.
+    */
+   bool countRestart(const size_t &slot, const int32_t &restartValue = 0);
+   /**
+    * @brief Increments the value of a slot count.
+    *
+    * @param slot Number of the slot to increment.
+    * @param qty Optional integer value, its **absolute** value will be incremented in the slot count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.
+    *
+    * @retval true The slot count could be incremented by the corresponding value without setting it out of range.
+    * @retval false The qty parameter was equal to 0, the object was not begun, the slot doesn't exist, or the count couldn't be incremented without getting out of range. The slot will keep its current value.
+    */
+   bool countUp(const size_t &slot, const int32_t &qty = 1);
+   /**
+    * @brief Disables the bank for further activities.
+    *
+    * @retval true The bank was active, and it was disabled for further actions.
+    * @retval false The bank was NOT active, no change of it's status was done.
+    */
+   bool end();
+   /**
+    * @brief Returns a slot count value.
+    *
+    * @param slot Number of the slot to read.
+    *
+    * @return The slot count value, 0 if the slot doesn't exist.
+    */
+   int32_t getCount(const size_t &slot);
+   /**
+    * @brief Returns a slot Maximum Counter Value.
+    *
+    * @param slot Number of the slot.
+    *
+    * @return The slot Maximum Counter Value, 0 if the slot doesn't exist.
+    */
+   int32_t getMaxCountVal(const size_t &slot);
+   /**
+    * @brief Returns a slot Minimum Counter Value.
+    *
+    * @param slot Number of the slot.
+    *
+    * @return The slot Minimum Counter Value, 0 if the slot doesn't exist.
+    */
+   int32_t getMinCountVal(const size_t &slot);
+   /**
+    * @brief Returns the quantity of slots of the bank.
+    *
+    * @return The quantity of slots, 0 if the arrays couldn't be allocated.
+    */
+   size_t getSlotsQty();
+   /**
+    * @brief Returns the value that was used to begin() the object.
+    *
+    * @return startVal attribute value.
+    */
+   int32_t getStartVal();
+   /**
+    * @brief Binds a display to a slot.
+    *
+    * The slot valid range is set to the range of values the display can show, as the ClickCounter class does. The binding must be done before the bank is started.
+    *
+    * @param slot Number of the slot.
+    * @param dsplyPtr Pointer to the SevenSegDisplays object to bind, nullptr to unbind the current display.
+    * @param rgthAlgn (Optional) Indicates if the represented value must be displayed right aligned. If not provided a value of true will be used.
+    * @param zeroPad (Optional) Indicates if the heading free spaces of the integer right aligned displayed must be filled with zeros (true) or spaces (false). If not provided a value of false will be used.
+    *
+    * @retval true The bank was not begun, the slot exists and the display was bound.
+    * @retval false One of the previously described conditions failed, or the memory needed couldn't be allocated.
+    */
+   bool setSlotDisplay(const size_t &slot, SevenSegDisplays* dsplyPtr, bool rgthAlgn = true, bool zeroPad = false);
+   /**
+    * @brief Sets a slot valid range.
+    *
+    * The range must be set before the bank is started.
+    *
+    * @param slot Number of the slot.
+    * @param countMin Left side limit (minimum) for the slot valid range segment.
+    * @param countMax Right side limit (maximum) for the slot valid range segment.
+    *
+    * @retval true The bank was not begun, the slot exists and the range was set.
+    * @retval false One of the previously described conditions failed, the range was not modified.
+    */
+   bool setSlotRange(const size_t &slot, const int32_t &countMin, const int32_t &countMax);
+   /**
+    * @brief Associates a range of consecutive telemetry encoder channels to the bank slots.
+    *
+    * Each slot count is bound to the channel frstChnl + slot, and every slot modification marks its channel as changed by a lock-free operation, so the frames built by the encoder include only the slots modified since the previous frame, see ClickTelemetryEncoder. The association must be set before the bank is started.
+    *
+    * @param tlmPtr Pointer to an instantiated ClickTelemetryEncoder object. A nullptr value removes the current association, unbinding the channels.
+    * @param frstChnl (Optional) Number of the encoder channel bound to the slot 0. If not provided the channel 0 will be used.
+    *
+    * @retval true The bank was not begun, the encoder has channels for all the slots and the association was set or removed.
+    * @retval false One of the previously described conditions failed, the association was not modified.
+    *
+    * @note The encoder must exist while it's associated, and it must not be building a frame while the association is set or removed, including by the bank destruction.
+    */
+   bool setTelemetry(ClickTelemetryEncoder* tlmPtr, const size_t &frstChnl = 0);
+   /**
+    * @brief Copies the count values of a range of consecutive slots.
+    *
+    * @param dstPtr Pointer to the array where the counts will be copied, dstPtr[i] receives the count of the slot firstSlot + i.
+    * @param firstSlot (Optional) Number of the first slot to copy. If not provided a value of 0 will be used.
+    * @param qty (Optional) Maximum quantity of slots to copy. If not provided all the slots from firstSlot to the last will be copied.
+    *
+    * @return The quantity of counts copied to the dstPtr array.
+    */
+   size_t snapshot(int32_t* dstPtr, const size_t &firstSlot = 0, const size_t &qty = SIZE_MAX);
+   /**
+    * @brief Updates the display bound to a slot with the slot current count value.
+    *
+    * @param slot Number of the slot.
+    *
+    * @retval true The slot has no display bound, or the display was updated.
+    * @retval false The slot doesn't exist, or the display update failed.
+    */
+   bool updDisplay(const size_t &slot);
+};
+
+#endif   // _CLICKCOUNTERBANK_ESP32_H_
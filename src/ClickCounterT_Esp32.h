@@ -0,0 +1,439 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterT_Esp32.h
+ *
+ * @brief Header file for the ClickCounterT class template of the ClickCounter_Esp32 library
+ *
+ * @details The ClickCounterT class template models the same counters the ClickCounter class does, but with every configuration decision resolved at compile time: the valid range limits, the behavior when a counting operation would get the count out of the valid range (overflow policy), the mechanism used to protect the count from simultaneous modifications (lock policy) and the way the count is displayed (display policy). Each instantiation only includes the code needed by the selected options, so a counter without display and without locking compiles to a few instructions per counting operation, and the SevenSegDisplays library is only needed when a display policy using it is selected.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKCOUNTERT_ESP32_H_
+#define _CLICKCOUNTERT_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+class SevenSegDisplays;
+
+//=========================================================>> Overflow policies BEGIN
+/**
+ * @brief Overflow policy: operations that would get the count out of the valid range fail, and the count keeps its value.
+ */
+struct ccOvfReject{
+   template<int32_t Min, int32_t Max>
+   static inline bool fit(const int64_t &val, int32_t &newVal){
+      newVal = static_cast<int32_t>(val);
+      return ((val >= Min) && (val <= Max));
+   }
+};
+
+/**
+ * @brief Overflow policy: operations that would get the count out of the valid range set the count to the range limit exceeded.
+ */
+struct ccOvfSaturate{
+   template<int32_t Min, int32_t Max>
+   static inline bool fit(const int64_t &val, int32_t &newVal){
+      newVal = (val < Min)?Min:((val > Max)?Max:static_cast<int32_t>(val));
+      return true;
+   }
+};
+
+/**
+ * @brief Overflow policy: operations that would get the count out of the valid range continue counting from the opposite range limit, as a mechanical odometer does.
+ */
+struct ccOvfWrap{
+   template<int32_t Min, int32_t Max>
+   static inline bool fit(const int64_t &val, int32_t &newVal){
+      const int64_t span{static_cast<int64_t>(Max) - Min + 1};
+      int64_t offset{(val - Min) % span};
+
+      if(offset < 0)
+         offset += span;
+      newVal = static_cast<int32_t>(Min + offset);
+      return true;
+   }
+};
+//===========================================================>> Overflow policies END
+
+//=============================================================>> Lock policies BEGIN
+/**
+ * @brief Lock policy: no protection, for counters modified by a single task.
+ */
+struct ccLckNone{
+   class Cell{
+   private:
+      int32_t _count{0};
+   public:
+      inline int32_t load() const {return _count;}
+      template<typename StepT, typename ShowT>
+      inline bool modify(const StepT &step, ShowT &shw){
+         int32_t newVal{0};
+         bool result{step(_count, newVal)};
+
+         if(result){
+            _count = newVal;
+            result = shw.show(newVal);
+         }
+         return result;
+      }
+   };
+};
+
+/**
+ * @brief Lock policy: the count is modified with an atomic compare and swap, for counters modified simultaneously by tasks and ISRs. The display, if any, is updated after the modification and the updates are not serialized.
+ */
+struct ccLckAtomic{
+   class Cell{
+   private:
+      std::atomic<int32_t> _count{0};
+   public:
+      inline int32_t load() const {return _count.load(std::memory_order_acquire);}
+      template<typename StepT, typename ShowT>
+      inline bool modify(const StepT &step, ShowT &shw){
+         int32_t curVal{_count.load(std::memory_order_relaxed)};
+         int32_t newVal{0};
+         bool result{false};
+
+         do{
+            result = step(curVal, newVal);
+         }while(result && !_count.compare_exchange_weak(curVal, newVal, std::memory_order_acq_rel, std::memory_order_relaxed));
+         if(result)
+            result = shw.show(newVal);
+         return result;
+      }
+   };
+};
+
+/**
+ * @brief Lock policy: the count is modified inside a critical section (spinlock), for counters modified simultaneously by tasks and ISRs. The display, if any, is updated after leaving the critical section and the updates are not serialized.
+ */
+struct ccLckCritical{
+   class Cell{
+   private:
+      portMUX_TYPE _cntMux = portMUX_INITIALIZER_UNLOCKED;
+      int32_t _count{0};
+   public:
+      inline int32_t load() const {return _count;}
+      template<typename StepT, typename ShowT>
+      inline bool modify(const StepT &step, ShowT &shw){
+         int32_t newVal{0};
+         bool result{false};
+
+         portENTER_CRITICAL_SAFE(&_cntMux);
+         result = step(_count, newVal);
+         if(result)
+            _count = newVal;
+         portEXIT_CRITICAL_SAFE(&_cntMux);
+         if(result)
+            result = shw.show(newVal);
+         return result;
+      }
+   };
+};
+
+/**
+ * @brief Lock policy: the count modification and the display update are serialized by a FreeRTOS mutex, as the ClickCounter class does by default. Not to be used from ISRs.
+ */
+struct ccLckMutex{
+   class Cell{
+   private:
+      SemaphoreHandle_t _cntMutex{nullptr};
+      StaticSemaphore_t _cntMtxBuf;
+      int32_t _count{0};
+   public:
+      Cell() {_cntMutex = xSemaphoreCreateMutexStatic(&_cntMtxBuf);}
+      ~Cell() {if(_cntMutex != nullptr) vSemaphoreDelete(_cntMutex);}
+      Cell(const Cell&) = delete;
+      Cell& operator=(const Cell&) = delete;
+      inline int32_t load() const {return _count;}
+      template<typename StepT, typename ShowT>
+      inline bool modify(const StepT &step, ShowT &shw){
+         int32_t newVal{0};
+         bool result{false};
+
+         if((_cntMutex != nullptr) && (xSemaphoreTake(_cntMutex, portMAX_DELAY) == pdTRUE)){
+            result = step(_count, newVal);
+            if(result){
+               _count = newVal;
+               result = shw.show(newVal);
+            }
+            xSemaphoreGive(_cntMutex);
+         }
+         return result;
+      }
+   };
+};
+//===============================================================>> Lock policies END
+
+//==========================================================>> Display policies BEGIN
+/**
+ * @brief Display policy: no display.
+ */
+struct ccDspNone{
+   typedef std::nullptr_t prm_t;
+
+   constexpr ccDspNone() {}
+   constexpr explicit ccDspNone(prm_t) {}
+   inline bool show(const int32_t &) {return true;}
+};
+
+/**
+ * @brief Display policy: the count is shown by a function provided by the application, that receives the new count value and returns the success of the display update.
+ */
+struct ccDspFn{
+   typedef bool (*prm_t)(const int32_t &);
+
+   prm_t dspFnPtr{nullptr};
+
+   constexpr ccDspFn() {}
+   constexpr explicit ccDspFn(prm_t fnPtr):dspFnPtr{fnPtr} {}
+   inline bool show(const int32_t &val) {return (dspFnPtr == nullptr)?true:dspFnPtr(val);}
+};
+
+/**
+ * @brief Display policy: the count is shown by a display object, usually a SevenSegDisplays object, i.e. ccDspObj<SevenSegDisplays>.
+ *
+ * @tparam DspT Display class, must provide a bool print(const int32_t &, bool, bool) method.
+ * @tparam RgthAlgn Indicates if the represented value must be displayed right aligned.
+ * @tparam ZeroPad Indicates if the heading free spaces of the integer right aligned displayed must be filled with zeros (true) or spaces (false).
+ */
+template<typename DspT, bool RgthAlgn = true, bool ZeroPad = false>
+struct ccDspObj{
+   typedef DspT* prm_t;
+
+   prm_t dsplyPtr{nullptr};
+
+   constexpr ccDspObj() {}
+   constexpr explicit ccDspObj(prm_t dspPtr):dsplyPtr{dspPtr} {}
+   inline bool show(const int32_t &val) {return (dsplyPtr == nullptr)?true:dsplyPtr->print(val, RgthAlgn, ZeroPad);}
+};
+//============================================================>> Display policies END
+
+/**
+ * @class ClickCounterT
+ *
+ * @brief Models a counter whose valid range, overflow, locking and displaying behaviors are set at compile time.
+ *
+ * The class template provides the same basic counting methods of the ClickCounter class with the same names and results, so code written for the basic ClickCounter API might be moved to an instantiation of this template changing only the object declaration. The ClickCounter class remains the option for counters that need their configuration to be set or changed at runtime, or any of it's extended services (blinking, deferred refresh, journal, watchpoints, rate statistics, pulse sources).
+ *
+ * @tparam Min Left side limit (minimum) for the counter values valid range segment, included as a valid counting value.
+ * @tparam Max Right side limit (maximum) for the counter values valid range segment, included as a valid counting value.
+ * @tparam OvfPlcy Overflow policy: ccOvfReject (default), ccOvfSaturate or ccOvfWrap.
+ * @tparam LckPlcy Lock policy: ccLckNone, ccLckAtomic (default), ccLckCritical or ccLckMutex.
+ * @tparam DspPlcy Display policy: ccDspNone (default), ccDspFn or ccDspObj<DisplayClass, RightAlign, ZeroPad>.
+ *
+ * Usage example, a display-less counter of the values 0 to 9999 without any protection for simultaneous modifications:
+ * @code
+ * ClickCounterT<0, 9999, ccOvfReject, ccLckNone> myCounter;
+ * @endcode
+ */
+template<int32_t Min, int32_t Max, typename OvfPlcy = ccOvfReject, typename LckPlcy = ccLckAtomic, typename DspPlcy = ccDspNone>
+class ClickCounterT : private DspPlcy{
+   static_assert(Min < Max, "ClickCounterT requires Min < Max");
+
+private:
+   typename LckPlcy::Cell _cell;
+   int32_t _beginStartVal{0};
+   bool _begun{false};
+
+   inline DspPlcy& _dsp(){return static_cast<DspPlcy&>(*this);}
+   inline bool _countAdd(const int64_t &delta){
+      return _cell.modify([&delta](const int32_t &curVal, int32_t &newVal) -> bool {
+         return OvfPlcy::template fit<Min, Max>(curVal + delta, newVal);
+      }, _dsp());
+   }
+
+public:
+   /**
+    * @brief Class constructor, for display policies that need no parameters.
+    *
+    * The constructors are constexpr for the ccLckNone, ccLckAtomic and ccLckCritical lock policies: objects defined in static storage are constant initialized, before any code is executed, with no heap use and no dependency on the static initialization order. The ccLckMutex policy builds its mutex at runtime, in a storage that is part of the object, so it needs no heap memory either.
+    */
+   constexpr ClickCounterT() {}
+   /**
+    * @brief Class constructor
+    *
+    * @param dspPrm The display policy parameter: the display function pointer for ccDspFn, the display object pointer for ccDspObj.
+    */
+   constexpr explicit ClickCounterT(typename DspPlcy::prm_t dspPrm):DspPlcy(dspPrm) {}
+   /**
+    * @brief Sets the basic required parameters for the object to start working.
+    *
+    * See ClickCounter::begin(const int32_t &)
+    */
+   bool begin(const int32_t &startVal = 0){
+      bool result{false};
+
+      if(!_begun){
+         _begun = true;
+         result = countRestart(startVal);
+         if(result)
+            _beginStartVal = startVal;
+         else
+            _begun = false;
+      }
+
+      return result;
+   }
+   /**
+    * @brief Decrements the value of the current count.
+    *
+    * See ClickCounter::countDown(const int32_t &). If the decrement would get the count out of the valid range, the result depends on the overflow policy.
+    */
+   inline bool countDown(const int32_t &qty = 1){
+      bool result{false};
+
+      if(qty != 0)
+         result = _countAdd((qty > 0)?(-static_cast<int64_t>(qty)):(qty));
+
+      return result;
+   }
+   /**
+    * @brief Returns a boolean value indicating if the count value is zero.
+    */
+   inline bool countIsZero(){
+
+      return (_cell.load() == 0);
+   }
+   /**
+    * @brief Resets the counter to the value provided when the counter was started with the begin(const int32_t &) method.
+    */
+   bool countReset(){
+
+      return countRestart(_beginStartVal);
+   }
+   /**
+    * @brief Restarts the count from the value provided as parameter.
+    *
+    * See ClickCounter::countRestart(const int32_t &). The value must be in the valid range for any overflow policy.
+    */
+   bool countRestart(const int32_t &restartValue = 0){
+
+      return _cell.modify([&restartValue](const int32_t &, int32_t &newVal) -> bool {
+         newVal = restartValue;
+         return ((restartValue >= Min) && (restartValue <= Max));
+      }, _dsp());
+   }
+   /**
+    * @brief Modifies the count value in the direction of 0 (zero) by the parameter value.
+    *
+    * See ClickCounter::countToZero(const int32_t &). The count never goes past zero, for any overflow policy.
+    */
+   bool countToZero(const int32_t &qty = 1){
+      const int64_t locQty{(qty < 0)?(-static_cast<int64_t>(qty)):(qty)};
+
+      return (locQty > 0) && _cell.modify([&locQty](const int32_t &curVal, int32_t &newVal) -> bool {
+         bool result{false};
+
+         if((curVal > 0) && ((curVal - locQty) >= 0)){
+            newVal = static_cast<int32_t>(curVal - locQty);
+            result = true;
+         }
+         else if((curVal < 0) && ((curVal + locQty) <= 0)){
+            newVal = static_cast<int32_t>(curVal + locQty);
+            result = true;
+         }
+
+         return result;
+      }, _dsp());
+   }
+   /**
+    * @brief Increments the value of the current count.
+    *
+    * See ClickCounter::countUp(const int32_t &). If the increment would get the count out of the valid range, the result depends on the overflow policy.
+    */
+   inline bool countUp(const int32_t &qty = 1){
+      bool result{false};
+
+      if(qty != 0)
+         result = _countAdd((qty < 0)?(-static_cast<int64_t>(qty)):(qty));
+
+      return result;
+   }
+   /**
+    * @brief Disables the counter for further activities.
+    */
+   bool end(){
+      bool result{false};
+
+      if(_begun){
+         _begun = false;
+         result = true;
+      }
+
+      return result;
+   }
+   /**
+    * @brief Get the object's count value.
+    */
+   inline int32_t getCount(){
+
+      return _cell.load();
+   }
+   /**
+    * @brief Returns the Maximum Counter Value.
+    */
+   constexpr int32_t getMaxCountVal() const{
+
+      return Max;
+   }
+   /**
+    * @brief Returns the Minimum Counter Value.
+    */
+   constexpr int32_t getMinCountVal() const{
+
+      return Min;
+   }
+   /**
+    * @brief Returns the value that was used to begin() the object.
+    */
+   int32_t getStartVal(){
+
+      return _beginStartVal;
+   }
+   /**
+    * @brief Updates the display with the current count value.
+    *
+    * @retval true The display policy is ccDspNone, or the display was updated.
+    * @retval false The display update failed.
+    */
+   bool updDisplay(){
+
+      return _dsp().show(_cell.load());
+   }
+};
+
+/**
+ * @brief ClickCounterT instantiation with the ClickCounter class default behaviors.
+ *
+ * Out of range operations fail, the modifications and the display updates are serialized by a mutex, and the count is shown in an optional SevenSegDisplays object, as a ClickCounter object does. Code using the basic ClickCounter API might be moved to this alias changing only the object declaration, i.e. `ClickCounter myCounter(-5, 10);` becomes `FixedClickCounter<-5, 10> myCounter;`, and `ClickCounter myCounter(&myDisplay);` becomes `FixedClickCounter<-999, 9999> myCounter(&myDisplay);` for a 4 digits display.
+ *
+ * @note ClickCounterT is a parallel API, not the base of the ClickCounter class: a ClickCounter object keeps its configuration, range included, settable at runtime, and provides the extended services the template doesn't.
+ *
+ * @tparam Min Left side limit (minimum) for the counter values valid range segment.
+ * @tparam Max Right side limit (maximum) for the counter values valid range segment.
+ * @tparam RgthAlgn Indicates if the count must be displayed right aligned.
+ * @tparam ZeroPad Indicates if the heading free spaces of the right aligned count must be filled with zeros (true) or spaces (false).
+ */
+template<int32_t Min, int32_t Max, bool RgthAlgn = true, bool ZeroPad = false>
+using FixedClickCounter = ClickCounterT<Min, Max, ccOvfReject, ccLckMutex, ccDspObj<SevenSegDisplays, RgthAlgn, ZeroPad>>;
+
+#endif   // _CLICKCOUNTERT_ESP32_H_
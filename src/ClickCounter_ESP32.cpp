@@ -23,42 +23,215 @@
  * @copyright Copyright (c) 2025  GPL-3.0 license
  *******************************************************************************
  */
+#include <inttypes.h>
+#include <new>
+#include <algorithm>
 #include <ClickCounter_Esp32.h>
 
 ClickCounter::ClickCounter()
-{    
+{
+   _CCCountMutex = xSemaphoreCreateMutexStatic(&_CCCountMtxBuf);
 }
 
 ClickCounter::ClickCounter(SevenSegDisplays* cntrDsplyPtr, bool rgthAlgn, bool zeroPad)
 :_cntrDsplyPtr{cntrDsplyPtr}, _countRgthAlgn{rgthAlgn}, _countZeroPad{zeroPad}
 {
-   _CCCountMutex = xSemaphoreCreateMutex();
+   _CCCountMutex = xSemaphoreCreateMutexStatic(&_CCCountMtxBuf);
 }
 
 ClickCounter::ClickCounter(int32_t countMin, int32_t countMax)
 :_countMin{countMin}, _countMax{countMax}
 {   
-   _CCCountMutex = xSemaphoreCreateMutex();
+   _CCCountMutex = xSemaphoreCreateMutexStatic(&_CCCountMtxBuf);
 }
 
 ClickCounter::~ClickCounter()
 {
+   if(_prstPtr != nullptr)
+      _prstPtr->end();   // The commit task reads the object's total
+   stopAsyncTask();
+   stopRefreshTask();
+   stopDispatchTask();
+   if(_tlmPtr != nullptr)
+      _tlmPtr->bindChannel(_tlmChnl, nullptr);
+   delete [] _wpArrPtr;
+   if(_chngEvGrp.load() != nullptr)
+      vEventGroupDelete(_chngEvGrp.load());
+   if(_CCCountMutex != nullptr)
+      vSemaphoreDelete(_CCCountMutex);
+}
+
+bool ClickCounter::addWatchpoint(const ccWpType_t &wpType, const int32_t &wpVal, fncVdPtrPrmPtrType fnPtr, void* argPtr){
+   bool result{false};
+
+   if(fnPtr != nullptr)   // Watchpoints with no function are reserved for the tasks blocked in waitUntil()
+      result = _wpIns(ccWtchPnt_t{wpVal, wpType, fnPtr, argPtr, 0});
+
+   return result;
+}
+
+bool ClickCounter::apply(const ccBatchOp_t* opsPtr, const size_t &opsQty, bool* rsltsPtr){
+   bool result{false};
+   bool opRslt{false};
+   bool rstrtd{false};
+   int32_t curVal{0};
+   int32_t newVal{0};
+   int64_t netDelta{0};
+   uint32_t rjctdQty{0};
+
+   if((opsPtr != nullptr) && (opsQty > 0)){
+      if(_lockFree || _mtxTake()){
+         if(_cscdMuxPtr != nullptr){   // Rollover and cascade stages: each operation is applied on its own, so it can wrap and carry as the counting methods do
+            result = true;
+            curVal = _count.load(std::memory_order_relaxed);
+            newVal = curVal;
+            for(size_t opNbr{0}; opNbr < opsQty; opNbr++){
+               opRslt = _cscdBatchOp(opsPtr[opNbr], newVal, netDelta);
+               if(rsltsPtr != nullptr)
+                  rsltsPtr[opNbr] = opRslt;
+               if(opRslt){
+                  if((opsPtr[opNbr].opType == ccOpRestart) || (opsPtr[opNbr].opType == ccOpReset))
+                     rstrtd = true;
+               }
+               else{
+                  result = false;
+                  rjctdQty++;
+               }
+            }
+         }
+         else{
+            curVal = _count.load(std::memory_order_relaxed);
+            do{
+               result = true;
+               rstrtd = false;
+               rjctdQty = 0;
+               newVal = curVal;
+               for(size_t opNbr{0}; opNbr < opsQty; opNbr++){
+                  opRslt = _batchOpVal(opsPtr[opNbr], newVal);
+                  if(rsltsPtr != nullptr)
+                     rsltsPtr[opNbr] = opRslt;
+                  if(opRslt){
+                     if((opsPtr[opNbr].opType == ccOpRestart) || (opsPtr[opNbr].opType == ccOpReset))
+                        rstrtd = true;
+                  }
+                  else{
+                     result = false;
+                     rjctdQty++;
+                  }
+               }
+            }while(!_count.compare_exchange_weak(curVal, newVal, std::memory_order_acq_rel, std::memory_order_relaxed));
+            netDelta = static_cast<int64_t>(newVal) - curVal;
+            if(rstrtd){   // As countRestart() does, the pulses scaling remainder and the pending polled units are discarded
+               _ttlOffs.store(0);
+               _sclRmndr.store(0);
+               _pollPndng.store(0);
+            }
+         }
+         if(rjctdQty > 0)
+            _instrRjct(rjctdQty);
+         if((newVal != curVal) || (netDelta != 0) || rstrtd){   // A batch that left the count unchanged, as when every operation failed, notifies nothing and prints nothing
+            _cntChngd(ccOpBatch, netDelta, newVal);
+            if(_lockFree){
+               if(!_lckdUpdDisplay())
+                  result = false;
+            }
+            else if(!_rfrshDisplay())
+               result = false;
+         }
+         if(!_lockFree)
+            _mtxGive();
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::applyAsync(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr, const TickType_t &tmOut){
+
+   return _asyncPost(op, rsltPtr, tmOut, nullptr);
+}
+
+bool IRAM_ATTR ClickCounter::applyAsyncFromISR(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr, BaseType_t* pxHigherPriorityTaskWoken){
+
+   return _asyncPost(op, rsltPtr, 0, pxHigherPriorityTaskWoken);
 }
 
 bool ClickCounter::begin(const int32_t &startVal){
    bool result{false};
+   int32_t locStartVal{startVal};
+   int32_t locMin{_countMin};
+   int32_t locMax{_countMax};
+   int32_t fmtDspMin{_fmtDspMin};
+   int32_t fmtDspMax{_fmtDspMax};
+   int64_t fmtPow{_fmtPow};
+   uint8_t fmtDgts{_fmtDgts};
+   int32_t prevVal{0};
+   int64_t rstrdTtl{0};
+   int64_t rstrdVal{0};
+   int64_t rstrdOffs{0};
 
    if(!_begun){
       if(_cntrDsplyPtr != nullptr){
-         _countMin = _cntrDsplyPtr->getDspValMin();
-         _countMax = _cntrDsplyPtr->getDspValMax();
+         fmtDspMin = _cntrDsplyPtr->getDspValMin();
+         fmtDspMax = _cntrDsplyPtr->getDspValMax();
+         fmtDgts = 0;
+         fmtPow = 1;
+         while(fmtPow <= fmtDspMax){   // The rendering constants are calculated once, not per count modification
+            fmtDgts++;
+            fmtPow *= 10;
+         }
+         if(_dspFmt == ccFmtCount){
+            locMin = fmtDspMin;
+            locMax = fmtDspMax;
+         }
+         else{
+            locMin = INT32_MIN;
+            locMax = INT32_MAX;
+         }
          _noDisplay = false;
       } 
-      if(_countMin < _countMax){
-         result = countRestart(startVal);
-         if (result){
+      if(locMin < locMax){
+         result = ((locStartVal >= locMin) && (locStartVal <= locMax));
+         if((_prstPtr != nullptr) && _prstPtr->restore(rstrdTtl)){
+            rstrdVal = rstrdTtl;
+            if(_rllvr)
+               _rllvrFit(rstrdVal, locMin, locMax);
+            result = ((rstrdVal >= locMin) && (rstrdVal <= locMax));   // A total that can't be restored is reported, never silently replaced
+            if(result){
+               locStartVal = static_cast<int32_t>(rstrdVal);
+               rstrdOffs = rstrdTtl - rstrdVal;   // The carries restored are kept as part of the total count
+            }
+         }
+         if(result)
+            result = _mtxTake();
+         if(result){
+            _snpWrtBgn();   // The range, the count and the begun state are published together, a snapshot never sees them mixed
+            _fmtDspMin = fmtDspMin;
+            _fmtDspMax = fmtDspMax;
+            _fmtDgts = fmtDgts;
+            _fmtPow = fmtPow;
+            _countMin = locMin;
+            _countMax = locMax;
+            _cscdLck();
+            prevVal = _count.exchange(locStartVal);
+            _ttlOffs.store(rstrdOffs);
+            _sclRmndr.store(0);
+            _pollPndng.store(0);
+            _cscdUnlck();
             _beginStartVal = startVal;
             _begun = true;
+            _snpWrtEnd();
+            _mtxGive();
+            _wpRslvBnds();
+            _cntChngd(ccOpRestart, static_cast<int64_t>(locStartVal) - prevVal, locStartVal);
+            result = _lckdUpdDisplay();
+         }
+         if(result && (_prstPtr != nullptr))
+            result = _prstPtr->begin(this);   // Started once the count is published, its first commit reads the total
+         if(!result && _begun){
+            _snpWrtBgn();
+            _begun = false;
+            _snpWrtEnd();
          }
       } 
    }
@@ -89,26 +262,56 @@ bool ClickCounter::blink(const unsigned long &onRate, const unsigned long &offRa
 }
 
 void ClickCounter::clear(){
-   if(!_noDisplay)
+   if(!_noDisplay){
       _cntrDsplyPtr->clear();
+      _lastDspValid = false;
+   }
 
    return;
 }
 
 bool ClickCounter::countDown(const int32_t &qty){
-   int32_t locQty = abs(qty);
+   int32_t locQty = _absQty(qty);
    bool result {false};
+   int32_t newVal{0};
 
    if(locQty > 0){
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
-         if((_count - locQty) >= _countMin){
-            _count -= locQty;
+      if(_lockFree){
+         if(_cntAddInRng(-locQty, newVal)){
+            _cntChngd(ccOpDown, -locQty, newVal);
+            result = _lckdUpdDisplay();
+         }
+      }
+      else if(_mtxTake()){
+         if(_cntAddInRng(-locQty, newVal)){
+            _cntChngd(ccOpDown, -locQty, newVal);
             if(!_noDisplay)
-               result = _updDisplay();
+               result = _rfrshDisplay();
             else
                result = true;
          }
-         xSemaphoreGive(_CCCountMutex);
+         _mtxGive();
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::countDownAsync(const int32_t &qty, ccAsyncRslt_t* rsltPtr, const TickType_t &tmOut){
+
+   return applyAsync(ccBatchOp_t{ccOpDown, qty}, rsltPtr, tmOut);
+}
+
+bool IRAM_ATTR ClickCounter::countDownFromISR(const int32_t &qty, BaseType_t* pxHigherPriorityTaskWoken){
+   int32_t locQty = _absQty(qty);
+   bool result {false};
+   int32_t newVal{0};
+
+   if(locQty > 0){
+      result = _cntAddInRng(-locQty, newVal, pxHigherPriorityTaskWoken);
+      if(result){
+         _cntChngd(ccOpDown, -locQty, newVal, pxHigherPriorityTaskWoken);
+         _mrkDspDirtyFromISR(pxHigherPriorityTaskWoken);
       }
    }
 
@@ -118,9 +321,44 @@ bool ClickCounter::countDown(const int32_t &qty){
 bool ClickCounter::countIsZero(){
    bool result{false};
 
-   if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
+   if(_lockFree){
+      result = (_count.load(std::memory_order_relaxed) == 0);
+   }
+   else if(_mtxTake()){
       result = (_count == 0);
-      xSemaphoreGive(_CCCountMutex);
+      _mtxGive();
+   }
+
+   return result;
+}
+
+bool ClickCounter::countPulses(const int32_t &qty){
+   bool result{false};
+   int64_t units{0};
+
+   if(_sclPulses(qty, units)){
+      if(units > 0)
+         result = countUp(static_cast<int32_t>(units));
+      else if(units < 0)
+         result = countDown(static_cast<int32_t>(units));
+      else
+         result = true;
+   }
+
+   return result;
+}
+
+bool IRAM_ATTR ClickCounter::countPulsesFromISR(const int32_t &qty, BaseType_t* pxHigherPriorityTaskWoken){
+   bool result{false};
+   int64_t units{0};
+
+   if(_sclPulses(qty, units)){
+      if(units > 0)
+         result = countUpFromISR(static_cast<int32_t>(units), pxHigherPriorityTaskWoken);
+      else if(units < 0)
+         result = countDownFromISR(static_cast<int32_t>(units), pxHigherPriorityTaskWoken);
+      else
+         result = true;
    }
 
    return result;
@@ -133,43 +371,80 @@ bool ClickCounter::countReset(){
     
 bool ClickCounter::countRestart(const int32_t &restartValue){
    bool result{false};
+   int32_t prevVal{0};
 
    if ((restartValue >= _countMin) && (restartValue <= _countMax)){
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
-         _count = restartValue;
+      if(_lockFree){
+         _cscdLck();
+         prevVal = _count.exchange(restartValue);
+         _ttlOffs.store(0);
+         _sclRmndr.store(0);
+         _pollPndng.store(0);
+         _cscdUnlck();
+         _cntChngd(ccOpRestart, static_cast<int64_t>(restartValue) - prevVal, restartValue);
+         result = _lckdUpdDisplay();
+      }
+      else if(_mtxTake()){
+         _cscdLck();
+         prevVal = _count.exchange(restartValue);
+         _ttlOffs.store(0);
+         _sclRmndr.store(0);
+         _pollPndng.store(0);
+         _cscdUnlck();
+         _cntChngd(ccOpRestart, static_cast<int64_t>(restartValue) - prevVal, restartValue);
          if(!_noDisplay)
-            result = _updDisplay();
+            result = _rfrshDisplay();
          else
             result = true;
-         xSemaphoreGive(_CCCountMutex);
+         _mtxGive();
       }
    }
+   else
+      _instrRjct();
 
    return result;
 }
 
 bool ClickCounter::countToZero(const int32_t &qty){
-   int32_t locQty = abs(qty);
+   int32_t locQty = _absQty(qty);
    bool result {false};
+   int32_t curVal{0};
+   int32_t newVal{0};
 
    if(locQty > 0){
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
-         if (_count > 0){
-            if((_count - locQty) >= 0){
-               _count -= locQty;
-               result = true;
-            }
-         }   
-         else if (_count < 0){
-            if((_count + locQty) <= 0){
-               _count += locQty;
-               result = true;
+      if(_lockFree || _mtxTake()){
+         _cscdLck();
+         curVal = _count.load(std::memory_order_relaxed);
+         do{
+            result = false;
+            if (curVal > 0){
+               if((curVal - locQty) >= 0){
+                  newVal = curVal - locQty;
+                  result = true;
+               }
+            }   
+            else if (curVal < 0){
+               if((curVal + locQty) <= 0){
+                  newVal = curVal + locQty;
+                  result = true;
+               }
             }
-         }
+         }while(result && !_count.compare_exchange_weak(curVal, newVal, std::memory_order_acq_rel, std::memory_order_relaxed));
+         _cscdUnlck();
          if(result)
-            if(!_noDisplay)
-               result = _updDisplay();
-         xSemaphoreGive(_CCCountMutex);
+            _cntChngd(ccOpToZero, static_cast<int64_t>(newVal) - curVal, newVal);
+         else
+            _instrRjct();
+         if(_lockFree){
+            if(result)
+               result = _lckdUpdDisplay();
+         }
+         else{
+            if(result)
+               if(!_noDisplay)
+                  result = _rfrshDisplay();
+            _mtxGive();
+         }
       }
    }
 
@@ -178,17 +453,45 @@ bool ClickCounter::countToZero(const int32_t &qty){
 
 bool ClickCounter::countUp(const int32_t &qty){
    bool result {false};
-   int32_t locQty = abs(qty);
+   int32_t locQty = _absQty(qty);
+   int32_t newVal{0};
 
    if(locQty > 0){
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
-         if((_count + locQty) <= _countMax){
-            _count += locQty;
+      if(_lockFree){
+         if(_cntAddInRng(locQty, newVal)){
+            _cntChngd(ccOpUp, locQty, newVal);
+            result = _lckdUpdDisplay();
+         }
+      }
+      else if(_mtxTake()){
+         if(_cntAddInRng(locQty, newVal)){
+            _cntChngd(ccOpUp, locQty, newVal);
             result = true;
             if(!_noDisplay)
-               result = _updDisplay();
+               result = _rfrshDisplay();
          }
-         xSemaphoreGive(_CCCountMutex);
+         _mtxGive();
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::countUpAsync(const int32_t &qty, ccAsyncRslt_t* rsltPtr, const TickType_t &tmOut){
+
+   return applyAsync(ccBatchOp_t{ccOpUp, qty}, rsltPtr, tmOut);
+}
+
+bool IRAM_ATTR ClickCounter::countUpFromISR(const int32_t &qty, BaseType_t* pxHigherPriorityTaskWoken){
+   int32_t locQty = _absQty(qty);
+   bool result {false};
+   int32_t newVal{0};
+
+   if(locQty > 0){
+      result = _cntAddInRng(locQty, newVal, pxHigherPriorityTaskWoken);
+      if(result){
+         _cntChngd(ccOpUp, locQty, newVal, pxHigherPriorityTaskWoken);
+         _mrkDspDirtyFromISR(pxHigherPriorityTaskWoken);
       }
    }
 
@@ -199,32 +502,210 @@ bool ClickCounter::end(){
    bool result{false};
 
    if(_begun){
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
+      if(_prstPtr != nullptr)
+         _prstPtr->end();   // The last count modifications are committed before the count is cleared
+      if(_mtxTake()){
          if(_cntrDsplyPtr != nullptr)
             clear();
+         _snpWrtBgn();
          _countMin = 0;
          _countMax = 0;
          _count = 0;
          _begun = false;
+         _snpWrtEnd();
+         if(_tlmPtr != nullptr)
+            _tlmPtr->markChanged(_tlmChnl);
          result = true;
-         xSemaphoreGive(_CCCountMutex);
+         _mtxGive();
       }
    }
 
    return result;
 }
 
+bool ClickCounter::getAsyncStats(ccAsyncStats_t &stats, const bool &reset){
+   bool result{false};
+   QueueHandle_t asyncQueue{nullptr};
+
+   if(reset){
+      stats.postedQty = _asyncPstdQty.exchange(0, std::memory_order_relaxed);
+      stats.rjctdQty = _asyncRjctdQty.exchange(0, std::memory_order_relaxed);
+      stats.drainsQty = _asyncDrnsQty.exchange(0, std::memory_order_relaxed);
+      stats.appliedQty = _asyncAppldQty.exchange(0, std::memory_order_relaxed);
+      stats.maxBatch = _asyncMaxBatch.exchange(0, std::memory_order_relaxed);
+   }
+   else{
+      stats.postedQty = _asyncPstdQty.load(std::memory_order_relaxed);
+      stats.rjctdQty = _asyncRjctdQty.load(std::memory_order_relaxed);
+      stats.drainsQty = _asyncDrnsQty.load(std::memory_order_relaxed);
+      stats.appliedQty = _asyncAppldQty.load(std::memory_order_relaxed);
+      stats.maxBatch = _asyncMaxBatch.load(std::memory_order_relaxed);
+   }
+   _asyncQueueUsrs.fetch_add(1);   // The queue is not deleted while it's being read
+   asyncQueue = _asyncQueue.load();
+   result = (asyncQueue != nullptr);
+   stats.queuedQty = result?(uxQueueMessagesWaiting(asyncQueue)):(0);
+   _asyncQueueUsrs.fetch_sub(1);
+
+   return result;
+}
+
+ClickCounter* ClickCounter::getCarryCounter(){
+
+   return _carryCntrPtr;
+}
+
+int32_t ClickCounter::getCarryQty(const bool &reset){
+   int32_t result{0};
+
+   if(reset)
+      result = _carryQty.exchange(0);
+   else
+      result = _carryQty.load();
+
+   return result;
+}
+
 int32_t ClickCounter::getCount(){
    int32_t result{0};
 
-   if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
+   if(_lockFree){
+      result = _count.load(std::memory_order_relaxed);
+   }
+   else if(_mtxTake()){
       result = _count;
-      xSemaphoreGive(_CCCountMutex);
+      _mtxGive();
+   }
+
+   return result;
+}
+
+ccDspFmt_t ClickCounter::getDisplayFormat(){
+
+   return _dspFmt;
+}
+
+uint32_t ClickCounter::getDisplayPageMs(){
+
+   return _fmtPgTcks * portTICK_PERIOD_MS;
+}
+
+bool ClickCounter::getDisplayText(char* txtPtr, const size_t &txtSz, const uint8_t &dgts, const uint8_t &page){
+   bool result{false};
+   ccCntSnap_t snap{snapshot()};
+   ccFmtRng_t rng{};
+   int64_t dspMax{1};
+   int64_t dspMin{0};
+
+   if((txtPtr != nullptr) && (txtSz >= (static_cast<size_t>(dgts) + 2)) && (dgts <= 18)){
+      for(uint8_t dgt{0}; dgt < dgts; dgt++)
+         dspMax *= 10;
+      dspMax--;   // The values range of a display of that size, one digit is used by the sign of the negative values
+      dspMin = -(dspMax / 10);
+      if(dspMax > INT32_MAX)
+         dspMax = INT32_MAX;
+      if(dspMin < INT32_MIN)
+         dspMin = INT32_MIN;
+      if(snap.begun && (dgts > 0))
+         result = _fmtRndr((_dspFmt == ccFmtCount)?(static_cast<int64_t>(snap.count)):(getTotal()), dgts, page, static_cast<int32_t>(dspMin), static_cast<int32_t>(dspMax), txtPtr, txtSz, rng);
+      else{   // Not begun, the display is filled with dashes
+         memset(txtPtr, '-', dgts);
+         txtPtr[dgts] = '\0';
+      }
+   }
+
+   return result;
+}
+
+fncVdPtrPrmPtrType ClickCounter::getFnWhnCntValZeroPtr(){
+
+   return _fnWhnCntValZero;
+}
+
+bool ClickCounter::getInstrSnapshot(ccInstrSnap_t &snap, [[maybe_unused]] const bool &reset){
+   bool result{false};
+
+   snap = ccInstrSnap_t{};
+#if CC_INSTR_ENABLED
+   if(_instrPtr != nullptr){
+      ccInstrHist_t* histPtrs[_instrHistsQty]{&snap.lckWait, &snap.lckHold, &snap.dspLat};
+
+      for(uint8_t hist{0}; hist < _instrHistsQty; hist++){
+         for(uint8_t bckt{0}; bckt < ccInstrBcktsQty; bckt++)
+            histPtrs[hist]->bckts[bckt] = reset?(_instrPtr->bckts[hist][bckt].exchange(0, std::memory_order_relaxed)):(_instrPtr->bckts[hist][bckt].load(std::memory_order_relaxed));
+         histPtrs[hist]->maxUs = reset?(_instrPtr->maxUs[hist].exchange(0, std::memory_order_relaxed)):(_instrPtr->maxUs[hist].load(std::memory_order_relaxed));
+      }
+      snap.rjctdQty = reset?(_instrPtr->rjctdQty.exchange(0, std::memory_order_relaxed)):(_instrPtr->rjctdQty.load(std::memory_order_relaxed));
+      for(uint8_t op{0}; op <= ccOpBatch; op++)
+         snap.opsQty[op] = reset?(_instrPtr->opsQty[op].exchange(0, std::memory_order_relaxed)):(_instrPtr->opsQty[op].load(std::memory_order_relaxed));
+      result = true;
+   }
+#endif
+
+   return result;
+}
+
+ccInstrData_t* ClickCounter::getInstrumentation(){
+
+   return _instrPtr;
+}
+
+ClickEventJournal* ClickCounter::getJournal(){
+
+   return _jrnlPtr;
+}
+
+bool ClickCounter::getLockFree(){
+
+   return _lockFree;
+}
+
+uint32_t ClickCounter::getRate(){
+   uint32_t result{0};
+
+   if(_rtBcktTcks != 0){
+      portENTER_CRITICAL_SAFE(&_rtMux);
+      _rtChkRoll();
+      result = static_cast<uint32_t>((static_cast<uint64_t>(_rtWndwSum) * _rtBcktsPerMin) / _rtBcktsQty);
+      portEXIT_CRITICAL_SAFE(&_rtMux);
+   }
+
+   return result;
+}
+
+uint32_t ClickCounter::getRateEwma(){
+   uint32_t result{0};
+
+   if(_rtBcktTcks != 0){
+      portENTER_CRITICAL_SAFE(&_rtMux);
+      _rtChkRoll();
+      result = static_cast<uint32_t>(_rtEwma >> _rtFxdPtShft);
+      portEXIT_CRITICAL_SAFE(&_rtMux);
+   }
+
+   return result;
+}
+
+uint32_t ClickCounter::getRatePeak(const bool &reset){
+   uint32_t result{0};
+
+   if(_rtBcktTcks != 0){
+      portENTER_CRITICAL_SAFE(&_rtMux);
+      _rtChkRoll();
+      result = static_cast<uint32_t>(_rtPeak >> _rtFxdPtShft);
+      if(reset)
+         _rtPeak = 0;
+      portEXIT_CRITICAL_SAFE(&_rtMux);
    }
 
    return result;
 }
 
+bool ClickCounter::getRollover(){
+
+   return _rllvr;
+}
+
 int32_t ClickCounter::getMaxBlinkRate(){
    int32_t result{0};
 
@@ -253,6 +734,56 @@ int32_t ClickCounter::getMinCountVal(){
    return _countMin;
 }
 
+int64_t ClickCounter::getPendingUnits(){
+
+   return _pollPndng.load();
+}
+
+ClickCountPersist* ClickCounter::getPersistence(){
+
+   return _prstPtr;
+}
+
+ClickPulseSource* ClickCounter::getPulseSource(){
+
+   return _pulseSrcPtr;
+}
+
+uint32_t ClickCounter::getWatchpointLostQty(const bool &reset){
+   uint32_t result{0};
+
+   if(reset)
+      result = _wpLostQty.exchange(0);
+   else
+      result = _wpLostQty.load();
+
+   return result;
+}
+
+ClickTelemetryEncoder* ClickCounter::getTelemetry(){
+
+   return _tlmPtr;
+}
+
+int64_t ClickCounter::getTotal(){
+   int64_t result{0};
+   int64_t ttlOffs{0};
+
+   if(_cscdMuxPtr != nullptr){
+      portENTER_CRITICAL_SAFE(_cscdMuxPtr);
+      result = _ttlOffs.load(std::memory_order_relaxed) + _count.load(std::memory_order_relaxed);
+      portEXIT_CRITICAL_SAFE(_cscdMuxPtr);
+   }
+   else{
+      do{   // The offset is only modified by the count restarts, a restart in between the readings is retried
+         ttlOffs = _ttlOffs.load();
+         result = ttlOffs + _count.load();
+      }while(ttlOffs != _ttlOffs.load());
+   }
+
+   return result;
+}
+
 int ClickCounter::getStartVal(){
 
     return _beginStartVal;
@@ -269,6 +800,80 @@ bool ClickCounter::noBlink(){
    return result;
 }
 
+bool ClickCounter::pollPulseSource(){
+   bool result{false};
+   int64_t units{0};
+   int64_t room{0};
+   int32_t applUnits{0};
+
+   if(_pulseSrcPtr != nullptr){
+      _sclPulses(_pulseSrcPtr->takePulses(), units, INT64_MAX);   // With no units limit the scaling can't fail
+      units += _pollPndng.exchange(0);
+      room = (units > 0)?(INT32_MAX):(-INT32_MAX);
+      if(_cscdMuxPtr == nullptr)   // Out of the rollover mode the units are clamped to the room left in the valid range
+         room = static_cast<int64_t>((units > 0)?(_countMax):(_countMin)) - _count.load();
+      applUnits = static_cast<int32_t>((units > 0)?(std::min(std::min(units, room), static_cast<int64_t>(INT32_MAX))):(std::max(std::max(units, room), static_cast<int64_t>(-INT32_MAX))));
+      if(applUnits > 0)
+         result = countUp(applUnits);
+      else if(applUnits < 0)
+         result = countDown(applUnits);
+      else
+         result = true;
+      if(result)
+         units -= applUnits;
+      if(units != 0){
+         _pollPndng.fetch_add(units);   // Kept for the next polls, the pulses taken from the source are never lost
+         result = false;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::pumpDisplay(){
+   bool result{true};
+   int32_t curVal{0};
+
+   if(!_noDisplay && (_dspDirty.exchange(false) || _dspRate || (_dspFmt == ccFmtPages))){
+      if(_mtxTake()){
+         curVal = _dspVal();
+         if((_dspFmt != ccFmtCount) && !_dspRate)
+            result = _fmtUpdDisplay();   // Skips the print by itself if the rendering didn't change
+         else if(!_lastDspValid || (curVal != _lastDspVal))
+            result = _updDisplay();
+         _mtxGive();
+      }
+      else
+         result = false;
+   }
+
+   return result;
+}
+
+bool ClickCounter::removeWatchpoint(const ccWpType_t &wpType, const int32_t &wpVal, fncVdPtrPrmPtrType fnPtr){
+   bool result{false};
+   uint32_t wpPos{0};
+
+   portENTER_CRITICAL(&_wpMux);
+   for(wpPos = 0; (fnPtr != nullptr) && (wpPos < _wpQty.load()); wpPos++){   // The waiting tasks entries can't be removed
+      if((_wpArrPtr[wpPos].wpType == wpType) && (_wpArrPtr[wpPos].fnPtr == fnPtr)){
+         if((wpType == ccWpMinHit) || (wpType == ccWpMaxHit) || (_wpArrPtr[wpPos].wpVal == wpVal)){
+            result = true;
+            break;
+         }
+      }
+   }
+   if(result){
+      for(uint32_t i{wpPos + 1}; i < _wpQty.load(); i++)
+         _wpArrPtr[i - 1] = _wpArrPtr[i];
+      _wpQty.fetch_sub(1);
+      _wpGen++;
+   }
+   portEXIT_CRITICAL(&_wpMux);
+
+   return result;
+}
+
 bool ClickCounter::setBlinkRate(const unsigned long &newOnRate, const unsigned long &newOffRate){
    bool result{false};
 
@@ -280,23 +885,1503 @@ bool ClickCounter::setBlinkRate(const unsigned long &newOnRate, const unsigned l
    return result;
 }
 
-bool ClickCounter::_updDisplay(){
+bool ClickCounter::setCarryCounter(ClickCounter* carryCntrPtr){
    bool result{false};
+   ClickCounter* stgPtr{carryCntrPtr};
+   uint8_t stgsQty{1};
+   portMUX_TYPE* cscdMuxPtr{nullptr};
 
-   if(!_noDisplay)
-      result = _cntrDsplyPtr->print(_count, _countRgthAlgn, _countZeroPad);
-   else
+   if(!_begun && ((carryCntrPtr == nullptr) || (carryCntrPtr->_carryFdrPtr == nullptr) || (carryCntrPtr->_carryFdrPtr == this))){   // Two stages feeding the same counter would modify it from two different critical sections
       result = true;
-    
+      while(stgPtr != nullptr){
+         stgsQty++;
+         if((stgPtr == this) || (stgsQty > _cscdMaxStgs)){
+            result = false;
+            break;
+         }
+         stgPtr = stgPtr->_carryCntrPtr;
+      }
+      if(result){
+         if(_carryCntrPtr != nullptr){   // The currently linked higher order stages become a cascade of their own
+            cscdMuxPtr = ((_carryCntrPtr->_carryCntrPtr != nullptr) || _carryCntrPtr->_rllvr)?(&_carryCntrPtr->_cscdMux):(nullptr);
+            for(stgPtr = _carryCntrPtr; stgPtr != nullptr; stgPtr = stgPtr->_carryCntrPtr)
+               stgPtr->_cscdMuxPtr = cscdMuxPtr;
+            _carryCntrPtr->_carryFdrPtr = nullptr;
+         }
+         _carryCntrPtr = carryCntrPtr;
+         if(_carryCntrPtr != nullptr){   // All the stages of a cascade share the critical section of the lowest order stage
+            _carryCntrPtr->_carryFdrPtr = this;
+            if(_cscdMuxPtr == nullptr)
+               _cscdMuxPtr = &_cscdMux;
+            for(stgPtr = _carryCntrPtr; stgPtr != nullptr; stgPtr = stgPtr->_carryCntrPtr)
+               stgPtr->_cscdMuxPtr = _cscdMuxPtr;
+         }
+      }
+   }
+
    return result;
 }
 
-bool ClickCounter::updDisplay(){
+bool ClickCounter::setDisplayFormat(const ccDspFmt_t &dspFmt, const uint32_t &pageMs){
    bool result{false};
-      if(xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE){
-         result = _updDisplay();
-         xSemaphoreGive(_CCCountMutex);
-      }
+
+   if(!_begun){
+      _dspFmt = dspFmt;
+      if(dspFmt != ccFmtCount)
+         _fmtPrntTxt.reserve(sizeof(_fmtTxt));
+      _fmtPgTcks = pdMS_TO_TICKS(pageMs);
+      if(_fmtPgTcks == 0)
+         _fmtPgTcks = 1;
+      _lastDspValid = false;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setDisplayRate(const bool &dspRate){
+   bool result{false};
+
+   if(!dspRate || (_rtBcktTcks != 0)){
+      _dspRate = dspRate;
+      _lastDspValid = false;
+      _mrkDspDirty();
+      if(!_dfrdRfrsh)
+         result = pumpDisplay();
+      else
+         result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setDeferredRefresh(const bool &deferred){
+   bool result{true};
+
+   _dfrdRfrsh = deferred;
+   if(!deferred)
+      result = pumpDisplay();
+
+   return result;
+}
+
+bool ClickCounter::setFnWhnCntValZeroPtr(fncVdPtrPrmPtrType newFnWhnCntValZero, void* argPtr){
+   bool result{true};
+
+   if(_fnWhnCntValZero != nullptr)
+      removeWatchpoint(ccWpReached, 0, _fnWhnCntValZero);
+   _fnWhnCntValZero = nullptr;
+   _fnWhnCntValZeroArg = nullptr;
+   if(newFnWhnCntValZero != nullptr){
+      result = addWatchpoint(ccWpReached, 0, newFnWhnCntValZero, argPtr);
+      if(result){
+         _fnWhnCntValZero = newFnWhnCntValZero;
+         _fnWhnCntValZeroArg = argPtr;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::setInstrumentation([[maybe_unused]] ccInstrData_t* instrPtr){
+   bool result{false};
+
+#if CC_INSTR_ENABLED
+   if(!_begun){
+      _instrPtr = instrPtr;
+      result = true;
+   }
+#endif
+
+   return result;
+}
+
+bool ClickCounter::setJournal(ClickEventJournal* jrnlPtr){
+   _jrnlPtr = jrnlPtr;
+
+   return true;
+}
+
+bool ClickCounter::setPersistence(ClickCountPersist* prstPtr){
+   bool result{false};
+
+   if(!_begun){
+      _prstPtr = prstPtr;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setRateStats(const uint32_t &bcktMs, const uint8_t &ewmaShft){
+   bool result{false};
+
+   if((bcktMs == 0) || ((60000 % bcktMs) == 0)){
+      if((ewmaShft > 0) && (ewmaShft < 16)){
+         portENTER_CRITICAL_SAFE(&_rtMux);
+         for(uint8_t i{0}; i < _rtBcktsQty; i++)
+            _rtBckts[i] = 0;
+         _rtBcktIdx = 0;
+         _rtCurBckt = 0;
+         _rtWndwSum = 0;
+         _rtEwma = 0;
+         _rtPeak = 0;
+         _rtEwmaShft = ewmaShft;
+         if(bcktMs > 0){
+            _rtBcktsPerMin = 60000 / bcktMs;
+            _rtBcktTcks = pdMS_TO_TICKS(bcktMs);
+            if(_rtBcktTcks == 0)
+               _rtBcktTcks = 1;
+            _rtBcktStrt = xTaskGetTickCount();
+         }
+         else{
+            _rtBcktTcks = 0;
+            _dspRate = false;
+         }
+         portEXIT_CRITICAL_SAFE(&_rtMux);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::setLockFree(const bool &lockFree){
+   bool result{false};
+
+   if(!_begun){
+      _lockFree = lockFree;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setRollover(const bool &rollover){
+   bool result{false};
+
+   if(!_begun){
+      _rllvr = rollover;
+      if(_rllvr && (_cscdMuxPtr == nullptr))
+         _cscdMuxPtr = &_cscdMux;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setScaler(const uint32_t &pulsesQty, const uint32_t &unitsQty){
+   bool result{false};
+   uint32_t gcd{unitsQty};
+   uint32_t rmndr{pulsesQty};
+   uint32_t tmp{0};
+
+   if(!_begun && (pulsesQty > 0) && (unitsQty > 0)){
+      while(rmndr != 0){   // The ratio is reduced, keeping the intermediate products as small as possible
+         tmp = gcd % rmndr;
+         gcd = rmndr;
+         rmndr = tmp;
+      }
+      _sclNum = unitsQty / gcd;
+      _sclDen = pulsesQty / gcd;
+      _sclRmndr.store(0);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setTelemetry(ClickTelemetryEncoder* tlmPtr, const size_t &chnl){
+   bool result{false};
+
+   if(!_begun && ((tlmPtr == nullptr) || (chnl < tlmPtr->getChnlsQty()))){
+      if(_tlmPtr != nullptr)
+         _tlmPtr->bindChannel(_tlmChnl, nullptr);
+      _tlmPtr = tlmPtr;
+      _tlmChnl = chnl;
+      if(_tlmPtr != nullptr)
+         _tlmPtr->bindChannel(_tlmChnl, &_count);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::setPulseSource(ClickPulseSource* pulseSrcPtr){
+   _pulseSrcPtr = pulseSrcPtr;
+
+   return true;
+}
+
+ccCntSnap_t IRAM_ATTR ClickCounter::snapshot(){
+   ccCntSnap_t result{};
+   uint32_t seqStrt{0};
+
+   do{
+      seqStrt = _snpSeq.load(std::memory_order_acquire);
+      result.countMin = _countMin;
+      result.countMax = _countMax;
+      result.startVal = _beginStartVal;
+      result.begun = _begun;
+      result.count = _count.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);   // The members must be read before the sequence is checked again
+   }while(((seqStrt & 1) != 0) || (_snpSeq.load(std::memory_order_relaxed) != seqStrt));
+   result.gen = seqStrt >> 1;
+
+   return result;
+}
+
+bool ClickCounter::startAsyncTask(const UBaseType_t &queueLen, const UBaseType_t &tskPrrty){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+   QueueHandle_t asyncQueue{nullptr};
+
+   if((_asyncTskHndl.load() == nullptr) && (_asyncTskQueue == nullptr) && (queueLen > 0)){
+      asyncQueue = xQueueCreate(queueLen, sizeof(ccAsyncCmd_t));
+      if(asyncQueue != nullptr){
+         _asyncTskQueue = asyncQueue;
+         _asyncQueue.store(asyncQueue);   // Operations posted before the task starts wait in the queue
+         if(xTaskCreate(_asyncTsk, "CCAsyncTsk", _asyncTskStckSz, this, tskPrrty, &tskHndl) == pdPASS){
+            _asyncTskHndl.store(tskHndl);
+            result = true;
+         }
+         else{
+            _asyncQueue.store(nullptr);
+            while(_asyncQueueUsrs.load() != 0)   // The posting methods that read the handle before it was cleared end their sending
+               vTaskDelay(1);
+            _asyncFailQueued(asyncQueue);
+            _asyncTskQueue = nullptr;
+            vQueueDelete(asyncQueue);
+         }
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::startDispatchTask(const UBaseType_t &queueLen, const UBaseType_t &tskPrrty){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+   QueueHandle_t wpQueue{nullptr};
+
+   if((_wpTskHndl.load() == nullptr) && (queueLen > 0)){
+      wpQueue = xQueueCreate(queueLen, sizeof(ccWpCall_t));
+      if(wpQueue != nullptr){
+         if(xTaskCreate(_wpDsptchTsk, "CCWpDsptchTsk", _wpDsptchTskStckSz, wpQueue, tskPrrty, &tskHndl) == pdPASS){
+            _wpTskHndl.store(tskHndl);
+            _wpQueue.store(wpQueue);
+            result = true;
+         }
+         else
+            vQueueDelete(wpQueue);
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::startRefreshTask(const uint32_t &maxFps, const UBaseType_t &tskPrrty){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   if((_rfrshTskHndl.load() == nullptr) && (maxFps > 0)){
+      _rfrshFrmTcks = pdMS_TO_TICKS(1000 / maxFps);
+      if(_rfrshFrmTcks == 0)
+         _rfrshFrmTcks = 1;
+      _rfrshTskStop = false;
+      if(xTaskCreate(_rfrshTsk, "CCDspRfrshTsk", _rfrshTskStckSz, this, tskPrrty, &tskHndl) == pdPASS){
+         _rfrshTskHndl.store(tskHndl);
+         _dfrdRfrsh = true;
+         if(_dspDirty.load())
+            _rfrshTskNtfy();
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::stopRefreshTask(){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   _rfrshTskUsrs.fetch_add(1);
+   tskHndl = _rfrshTskHndl.load();
+   if(tskHndl != nullptr){
+      _rfrshTskStop.store(true);
+      xTaskNotifyGive(tskHndl);
+   }
+   _rfrshTskUsrs.fetch_sub(1);
+   if(tskHndl != nullptr){
+      while(_rfrshTskStop.load())   // Cleared by the task when it no longer accesses the object
+         vTaskDelay(1);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::_batchOpVal(const ccBatchOp_t &op, int32_t &val){
+   bool result{false};
+   int64_t locQty{op.qty};
+   int64_t newVal{val};
+
+   if(locQty < 0)
+      locQty = -locQty;
+   switch(op.opType){
+      case ccOpUp:
+         newVal += locQty;
+         result = ((locQty > 0) && (newVal <= _countMax));
+         break;
+      case ccOpDown:
+         newVal -= locQty;
+         result = ((locQty > 0) && (newVal >= _countMin));
+         break;
+      case ccOpToZero:
+         if(val > 0)
+            newVal -= locQty;
+         else
+            newVal += locQty;
+         result = ((locQty > 0) && (val != 0) && ((newVal == 0) || ((newVal > 0) == (val > 0))));
+         break;
+      case ccOpRestart:
+         newVal = op.qty;
+         result = ((newVal >= _countMin) && (newVal <= _countMax));
+         break;
+      case ccOpReset:
+         newVal = _beginStartVal;
+         result = ((newVal >= _countMin) && (newVal <= _countMax));   // As countReset() does, through countRestart()
+         break;
+      default:
+         break;
+   }
+   if(result)
+      val = static_cast<int32_t>(newVal);
+
+   return result;
+}
+
+bool ClickCounter::stopAsyncTask(){
+   bool result{false};
+   ccAsyncCmd_t stopCmd{{ccOpBatch, 0}, nullptr};
+   QueueHandle_t asyncQueue{_asyncQueue.exchange(nullptr)};
+
+   if(asyncQueue != nullptr){
+      while(_asyncQueueUsrs.load() != 0)   // The operations queued by the posting methods that read the handle before it was cleared precede the stop mark
+         vTaskDelay(1);
+      xQueueSend(asyncQueue, &stopCmd, portMAX_DELAY);
+      while(_asyncTskHndl.load() != nullptr)   // Cleared by the task once it no longer uses the queue nor the object
+         vTaskDelay(1);
+      _asyncTskQueue = nullptr;
+      vQueueDelete(asyncQueue);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickCounter::stopDispatchTask(){
+   bool result{false};
+   ccWpCall_t stopCall{nullptr, this};   // The stop mark carries the object to signal back the task end
+   QueueHandle_t wpQueue{_wpQueue.exchange(nullptr)};
+
+   if(wpQueue != nullptr){
+      while(_wpQueueUsrs.load() != 0)   // The calls queued by the counting methods that read the handle before it was cleared precede the stop mark
+         vTaskDelay(1);
+      xQueueSend(wpQueue, &stopCall, portMAX_DELAY);
+      while(_wpTskHndl.load() != nullptr)   // Cleared by the task once it no longer uses the queue
+         vTaskDelay(1);
+      vQueueDelete(wpQueue);
+      result = true;
+   }
+
+   return result;
+}
+
+int32_t IRAM_ATTR ClickCounter::_absQty(const int32_t &qty){
+   int32_t result{qty};
+
+   if(qty == INT32_MIN)
+      result = INT32_MAX;   // The absolute value of INT32_MIN is not representable as an int32_t
+   else if(qty < 0)
+      result = -qty;
+
+   return result;
+}
+
+void ClickCounter::_asyncFailQueued(QueueHandle_t asyncQueue){
+   ccAsyncCmd_t cmd{{ccOpBatch, 0}, nullptr};
+
+   while(xQueueReceive(asyncQueue, &cmd, 0) == pdTRUE){
+      if(cmd.rsltPtr != nullptr){
+         cmd.rsltPtr->status = ccAsyncFailed;
+         if(cmd.rsltPtr->ntfTsk != nullptr)
+            xTaskNotifyGive(cmd.rsltPtr->ntfTsk);
+      }
+   }
+
+   return;
+}
+
+bool IRAM_ATTR ClickCounter::_asyncPost(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr, const TickType_t &tmOut, BaseType_t* pxHigherPriorityTaskWoken){
+   bool result{false};
+   ccAsyncCmd_t cmd{op, rsltPtr};
+   QueueHandle_t asyncQueue{nullptr};
+
+   if(op.opType < ccOpBatch){   // ccOpBatch is reserved to stop the asynchronous task
+      _asyncQueueUsrs.fetch_add(1);
+      asyncQueue = _asyncQueue.load();
+      if(asyncQueue != nullptr){
+         if(rsltPtr != nullptr)
+            rsltPtr->status = ccAsyncPndng;
+         if(xPortInIsrContext())
+            result = (xQueueSendFromISR(asyncQueue, &cmd, pxHigherPriorityTaskWoken) == pdTRUE);
+         else
+            result = (xQueueSend(asyncQueue, &cmd, tmOut) == pdTRUE);
+         if(result){
+            _asyncPstdQty.fetch_add(1, std::memory_order_relaxed);
+         }
+         else{
+            _asyncRjctdQty.fetch_add(1, std::memory_order_relaxed);
+            if(rsltPtr != nullptr)
+               rsltPtr->status = ccAsyncFailed;
+         }
+      }
+      _asyncQueueUsrs.fetch_sub(1);
+   }
+
+   return result;
+}
+
+void ClickCounter::_asyncTsk(void* argp){
+   ClickCounter* cntrPtr = static_cast<ClickCounter*>(argp);
+   QueueHandle_t asyncQueue{cntrPtr->_asyncTskQueue};
+   ccAsyncCmd_t cmds[_asyncBatchMax];
+   ccBatchOp_t ops[_asyncBatchMax];
+   bool rslts[_asyncBatchMax];
+   uint32_t cmdsQty{0};
+   uint32_t maxBatch{0};
+   int32_t curVal{0};
+   bool stop{false};
+
+   while(!stop){
+      cmdsQty = 0;
+      if(xQueueReceive(asyncQueue, &cmds[0], portMAX_DELAY) == pdTRUE){
+         do{   // All the operations already queued are folded in the same drain
+            if(cmds[cmdsQty].op.opType == ccOpBatch){
+               stop = true;
+               break;
+            }
+            ops[cmdsQty] = cmds[cmdsQty].op;
+            cmdsQty++;
+         }while((cmdsQty < _asyncBatchMax) && (xQueueReceive(asyncQueue, &cmds[cmdsQty], 0) == pdTRUE));
+         if(cmdsQty > 0){
+            cntrPtr->apply(ops, cmdsQty, rslts);
+            curVal = cntrPtr->_count.load();
+            for(uint32_t i{0}; i < cmdsQty; i++){
+               if(cmds[i].rsltPtr != nullptr){
+                  cmds[i].rsltPtr->count = curVal;
+                  std::atomic_thread_fence(std::memory_order_release);   // The count must be visible before the status
+                  cmds[i].rsltPtr->status = rslts[i]?ccAsyncDone:ccAsyncFailed;
+                  if(cmds[i].rsltPtr->ntfTsk != nullptr)
+                     xTaskNotifyGive(cmds[i].rsltPtr->ntfTsk);
+               }
+            }
+            cntrPtr->_asyncDrnsQty.fetch_add(1, std::memory_order_relaxed);
+            cntrPtr->_asyncAppldQty.fetch_add(cmdsQty, std::memory_order_relaxed);
+            maxBatch = cntrPtr->_asyncMaxBatch.load(std::memory_order_relaxed);
+            while((cmdsQty > maxBatch) && !cntrPtr->_asyncMaxBatch.compare_exchange_weak(maxBatch, cmdsQty, std::memory_order_relaxed));
+         }
+      }
+   }
+   _asyncFailQueued(asyncQueue);   // No operation should follow the stop mark, but none is left pending if it does
+   cntrPtr->_asyncTskHndl.store(nullptr);   // Last access to the object and the queue, stopAsyncTask() returns after it
+   vTaskDelete(NULL);
+}
+
+bool IRAM_ATTR ClickCounter::_cntAddInRng(const int32_t &delta, int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken){
+   bool result{false};
+   int32_t curVal{_count.load(std::memory_order_relaxed)};
+   int64_t locNewVal{0};
+
+   if(_cscdMuxPtr != nullptr){   // Rollover mode and cascaded counters keep the count and the carries updated together
+      result = _cscdAdd(delta, newVal, pxHigherPriorityTaskWoken);
+   }
+   else{
+      do{
+         locNewVal = static_cast<int64_t>(curVal) + delta;
+         result = ((locNewVal >= _countMin) && (locNewVal <= _countMax));
+      }while(result && !_count.compare_exchange_weak(curVal, static_cast<int32_t>(locNewVal), std::memory_order_acq_rel, std::memory_order_relaxed));
+      if(result)
+         newVal = static_cast<int32_t>(locNewVal);
+   }
+   if(!result)
+      _instrRjct();
+
+   return result;
+}
+
+bool ClickCounter::_cscdBatchOp(const ccBatchOp_t &op, int32_t &newVal, int64_t &netDelta){
+   bool result{false};
+   int32_t locQty{_absQty(op.qty)};
+   int32_t prevVal{0};
+   int32_t opVal{0};
+
+   if((op.opType == ccOpUp) || (op.opType == ccOpDown)){
+      if(locQty > 0){
+         result = _cscdAdd((op.opType == ccOpUp)?(locQty):(-locQty), newVal);
+         if(result)
+            netDelta += (op.opType == ccOpUp)?(locQty):(-locQty);
+      }
+   }
+   else{
+      _cscdLck();
+      prevVal = _count.load(std::memory_order_relaxed);
+      opVal = prevVal;
+      result = _batchOpVal(op, opVal);
+      if(result){
+         _count.store(opVal, std::memory_order_release);
+         if((op.opType == ccOpRestart) || (op.opType == ccOpReset)){
+            _ttlOffs.store(0);
+            _sclRmndr.store(0);
+            _pollPndng.store(0);
+         }
+         netDelta += static_cast<int64_t>(opVal) - prevVal;
+         newVal = opVal;
+      }
+      _cscdUnlck();
+   }
+
+   return result;
+}
+
+bool IRAM_ATTR ClickCounter::_cscdAdd(const int32_t &delta, int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken){
+   bool result{true};
+   ClickCounter* stgPtrs[_cscdMaxStgs]{};
+   int32_t stgVals[_cscdMaxStgs]{};
+   int32_t stgDeltas[_cscdMaxStgs]{};
+   int32_t stgCarries[_cscdMaxStgs]{};
+   uint8_t stgsQty{0};
+   ClickCounter* stgPtr{this};
+   int64_t stgDelta{delta};
+   int64_t locNewVal{0};
+   int64_t carries{0};
+
+   portENTER_CRITICAL_SAFE(_cscdMuxPtr);
+   while((stgPtr != nullptr) && (stgDelta != 0)){
+      if(stgsQty == _cscdMaxStgs){
+         result = false;
+         break;
+      }
+      locNewVal = static_cast<int64_t>(stgPtr->_count.load(std::memory_order_relaxed)) + stgDelta;
+      carries = 0;
+      if(stgPtr->_rllvr)
+         carries = stgPtr->_rllvrFit(locNewVal, stgPtr->_countMin, stgPtr->_countMax);
+      else if((locNewVal < stgPtr->_countMin) || (locNewVal > stgPtr->_countMax)){
+         result = false;   // The carries can't be accepted, no stage is modified
+         break;
+      }
+      stgPtrs[stgsQty] = stgPtr;
+      stgVals[stgsQty] = static_cast<int32_t>(locNewVal);
+      stgDeltas[stgsQty] = static_cast<int32_t>(stgDelta);
+      stgCarries[stgsQty] = static_cast<int32_t>(carries);
+      stgsQty++;
+      stgDelta = carries;
+      stgPtr = stgPtr->_carryCntrPtr;
+   }
+   if(result){
+      for(uint8_t stg{0}; stg < stgsQty; stg++){
+         stgPtrs[stg]->_count.store(stgVals[stg], std::memory_order_release);
+         if(stgCarries[stg] != 0){
+            stgPtrs[stg]->_carryQty.fetch_add(stgCarries[stg], std::memory_order_relaxed);
+            stgPtrs[stg]->_ttlOffs.fetch_add(static_cast<int64_t>(stgCarries[stg]) * (static_cast<int64_t>(stgPtrs[stg]->_countMax) - stgPtrs[stg]->_countMin + 1), std::memory_order_relaxed);
+         }
+      }
+   }
+   portEXIT_CRITICAL_SAFE(_cscdMuxPtr);
+   if(result){
+      newVal = (stgsQty > 0)?(stgVals[0]):(_count.load(std::memory_order_relaxed));
+      for(uint8_t stg{1}; stg < stgsQty; stg++){   // The invoking stage notifications and display update are managed by the invoking method
+         stgPtrs[stg]->_cntChngd((stgDeltas[stg] > 0)?ccOpUp:ccOpDown, stgDeltas[stg], stgVals[stg], pxHigherPriorityTaskWoken);
+         if(xPortInIsrContext())
+            stgPtrs[stg]->_mrkDspDirtyFromISR(pxHigherPriorityTaskWoken);
+         else
+            stgPtrs[stg]->_lckdUpdDisplay();
+      }
+   }
+
+   return result;
+}
+
+void IRAM_ATTR ClickCounter::_cscdLck(){
+   if(_cscdMuxPtr != nullptr)
+      portENTER_CRITICAL_SAFE(_cscdMuxPtr);
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_cscdUnlck(){
+   if(_cscdMuxPtr != nullptr)
+      portEXIT_CRITICAL_SAFE(_cscdMuxPtr);
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_chngNtfy(BaseType_t* pxHigherPriorityTaskWoken){
+   EventGroupHandle_t evGrp{_chngEvGrp.load()};
+   EventBits_t wtrsMsk{0};
+
+   _chngSeq.fetch_add(1);
+   wtrsMsk = _chngWtrsMsk.load();   // Read after the sequence change, a task registered later sees the new sequence
+   if((evGrp != nullptr) && (wtrsMsk != 0)){
+      if(xPortInIsrContext())
+         xEventGroupSetBitsFromISR(evGrp, wtrsMsk, pxHigherPriorityTaskWoken);   // Deferred to the timer service task
+      else
+         xEventGroupSetBits(evGrp, wtrsMsk);
+   }
+
+   return;
+}
+
+bool ClickCounter::_chngWt(fncBlnCntPrmPtrType predFn, void* argPtr, const TickType_t &tmOut){
+   bool result{false};
+   EventGroupHandle_t evGrp{_chngEvGrp.load()};
+   EventGroupHandle_t newEvGrp{nullptr};
+   TickType_t strtTck{xTaskGetTickCount()};
+   TickType_t tmLeft{0};
+   uint32_t strtSeq{0};
+   uint32_t wtrsMsk{_chngWtrsMsk.load()};
+   EventBits_t wtrBit{0};
+
+   if(evGrp == nullptr){   // The event group is only created if a task ever waits for changes
+      newEvGrp = xEventGroupCreate();
+      if(newEvGrp != nullptr){
+         if(_chngEvGrp.compare_exchange_strong(evGrp, newEvGrp))
+            evGrp = newEvGrp;
+         else
+            vEventGroupDelete(newEvGrp);   // Other task created it first
+      }
+   }
+   if(evGrp != nullptr){
+      do{   // Each waiting task gets its own bit, so no task clears the wake up of another one
+         wtrBit = _chngWtrsBits & ~wtrsMsk;
+         wtrBit &= ~(wtrBit - 1);   // The lowest free bit
+      }while((wtrBit != 0) && !_chngWtrsMsk.compare_exchange_weak(wtrsMsk, wtrsMsk | wtrBit));
+   }
+   if(wtrBit != 0){
+      xEventGroupClearBits(evGrp, wtrBit);   // Left set by a previous owner of the bit
+      strtSeq = _chngSeq.load();   // Read after registering, every later modification changes it
+      for(;;){
+         if(predFn == nullptr)
+            result = (_chngSeq.load() != strtSeq);
+         else
+            result = predFn(_count.load(), argPtr);
+         if(result)
+            break;
+         tmLeft = _tmOutLeft(strtTck, tmOut);
+         if(tmLeft == 0)
+            break;
+         xEventGroupWaitBits(evGrp, wtrBit, pdTRUE, pdFALSE, tmLeft);   // A modification after the check sets the bit, even if it happens before the wait starts
+      }
+      _chngWtrsMsk.fetch_and(~wtrBit);
+   }
+
+   return result;
+}
+
+void IRAM_ATTR ClickCounter::_cntChngd(const ccBatchOpType_t &opType, const int64_t &delta, const int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken){
+   ccEvntRcrd_t evntRcrd{};
+   int64_t prevVal{static_cast<int64_t>(newVal) - delta};
+
+   _instrOp(opType);
+   if((_wpQty.load(std::memory_order_relaxed) != 0) && (delta != 0)){
+      if(prevVal < _countMin)   // A rollover wrap was done, the count passed through the range limit
+         prevVal = _countMin;
+      else if(prevVal > _countMax)
+         prevVal = _countMax;
+      _wpChk(static_cast<int32_t>(prevVal), newVal, pxHigherPriorityTaskWoken);
+   }
+   if((_chngWtrsMsk.load() != 0) && (delta != 0))
+      _chngNtfy(pxHigherPriorityTaskWoken);
+   if((_rtBcktTcks != 0) && (opType != ccOpRestart))
+      _rtAdd(static_cast<uint32_t>((delta < 0)?(-delta):(delta)));
+   if(_prstPtr != nullptr)
+      _prstPtr->notify(static_cast<uint32_t>((delta < 0)?(-delta):(delta)), pxHigherPriorityTaskWoken);
+   if((_tlmPtr != nullptr) && (delta != 0))
+      _tlmPtr->markChanged(_tlmChnl);
+   if(_jrnlPtr != nullptr){
+      evntRcrd.tmStmp = static_cast<uint32_t>(esp_timer_get_time());
+      evntRcrd.count = newVal;
+      evntRcrd.delta = static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(delta, INT32_MIN), INT32_MAX));   // A restart across a full int32_t range doesn't fit the record
+      evntRcrd.opType = static_cast<uint8_t>(opType);
+      _jrnlPtr->push(evntRcrd);
+   }
+
+   return;
+}
+
+bool IRAM_ATTR ClickCounter::_sclPulses(const int32_t &pulses, int64_t &units, const int64_t &unitsLim){
+   bool result{true};
+   uint32_t curRmndr{0};
+   int64_t scldVal{0};
+   int64_t locUnits{0};
+
+   if((_sclNum == 1) && (_sclDen == 1)){
+      units = pulses;
+   }
+   else{
+      curRmndr = _sclRmndr.load(std::memory_order_relaxed);
+      do{
+         scldVal = static_cast<int64_t>(curRmndr) + (static_cast<int64_t>(pulses) * _sclNum);
+         locUnits = scldVal / _sclDen;
+         if((scldVal % _sclDen) < 0)   // Floor division, the remainder is kept positive for negative pulses too
+            locUnits--;
+         if((locUnits < -unitsLim) || (locUnits > unitsLim)){
+            result = false;
+            break;
+         }
+      }while(!_sclRmndr.compare_exchange_weak(curRmndr, static_cast<uint32_t>(scldVal - (locUnits * _sclDen)), std::memory_order_relaxed, std::memory_order_relaxed));
+      units = locUnits;
+   }
+
+   return result;
+}
+
+int32_t ClickCounter::_dspVal(){
+   int32_t result{0};
+
+   if(_dspRate){
+      result = static_cast<int32_t>(getRate());
+      if(result > _fmtDspMax)
+         result = _fmtDspMax;
+   }
+   else
+      result = _count.load();
+
+   return result;
+}
+
+bool ClickCounter::_fmtRndr(const int64_t &total, const uint8_t &dgts, const uint8_t &page, const int32_t &dspMin, const int32_t &dspMax, char* txtPtr, const size_t &txtSz, ccFmtRng_t &rng) const{
+   bool result{true};
+   int64_t pow{1};
+   int64_t pgIdx{0};
+   int64_t absTtl{(total < 0)?(-total):(total)};
+   int64_t unit{1000};
+   int64_t scldMax{1};
+   int64_t scldVal{0};
+   char sfx{'k'};
+   char padChr{' '};
+   int8_t nmbrDgts{0};
+   size_t txtLen{0};
+   size_t txtDgts{0};
+   size_t padPos{0};
+
+   for(uint8_t dgt{0}; dgt < dgts; dgt++)
+      pow *= 10;
+   pgIdx = total / pow;
+   if((total < 0) && ((total % pow) != 0))
+      pgIdx--;   // Floor division, the low order window of negative totals counts as an odometer does
+   rng = ccFmtRng_t{0, 0, 0, true, true};
+   txtPtr[0] = '\0';
+   if((_dspFmt == ccFmtCount) || (_dspFmt == ccFmtScaled)){
+      if((total >= dspMin) && (total <= dspMax)){
+         rng.lo = dspMin;
+         rng.hi = static_cast<int64_t>(dspMax) + 1;
+         rng.zeroPad = _countZeroPad;
+      }
+      else if(_dspFmt == ccFmtCount){   // The count can't be represented, the display is filled with dashes
+         rng.bySub = false;
+         result = false;
+         memset(txtPtr, '-', dgts);
+         txtPtr[dgts] = '\0';
+         if(total > 0){
+            rng.lo = static_cast<int64_t>(dspMax) + 1;
+            rng.hi = INT64_MAX;
+         }
+         else{
+            rng.lo = INT64_MIN;
+            rng.hi = dspMin;
+         }
+      }
+      else{
+         rng.bySub = false;
+         nmbrDgts = dgts - 1 - ((total < 0)?1:0);   // One digit is used by the suffix, another by the sign
+         for(int8_t dgt{0}; dgt < nmbrDgts; dgt++)
+            scldMax *= 10;
+         scldMax--;
+         scldVal = absTtl / unit;
+         if(scldVal > scldMax){
+            unit = 1000000;
+            sfx = 'M';
+            scldVal = absTtl / unit;
+         }
+         if((nmbrDgts < 1) || (scldVal > scldMax)){   // The total can't be represented, the display is filled with dashes
+            result = false;
+            memset(txtPtr, '-', dgts);
+            txtPtr[dgts] = '\0';
+            if(total > 0){
+               rng.lo = (scldMax + 1) * unit;
+               rng.hi = INT64_MAX;
+            }
+            else{
+               rng.lo = INT64_MIN;
+               rng.hi = -((scldMax + 1) * unit) + 1;
+            }
+         }
+         else{
+            snprintf(txtPtr, txtSz, "%s%" PRId64 "%c", (total < 0)?"-":"", scldVal, sfx);
+            if(total > 0){
+               rng.lo = scldVal * unit;
+               if(rng.lo <= dspMax)
+                  rng.lo = static_cast<int64_t>(dspMax) + 1;
+               rng.hi = (scldVal + 1) * unit;
+            }
+            else{
+               rng.hi = -(scldVal * unit) + 1;
+               if(rng.hi > dspMin)
+                  rng.hi = dspMin;
+               rng.lo = -((scldVal + 1) * unit) + 1;
+            }
+         }
+      }
+   }
+   else{
+      rng.lo = pgIdx * pow;
+      rng.hi = rng.lo + pow;
+      rng.offs = rng.lo;
+      if((_dspFmt == ccFmtPages) && (page == 1) && (pgIdx != 0)){
+         rng.bySub = false;
+         if((pgIdx >= pow) || (pgIdx <= -(pow / 10))){   // The page index doesn't fit, one digit is used by the sign
+            result = false;
+            memset(txtPtr, '-', dgts);
+            txtPtr[dgts] = '\0';
+         }
+         else
+            snprintf(txtPtr, txtSz, "%" PRId64, pgIdx);   // The page index of a 64 bits total doesn't fit in a 32 bits long
+         strcat(txtPtr, ".");
+      }
+   }
+   if(rng.bySub){   // The text of the value printed by subtraction
+      snprintf(txtPtr, txtSz, "%" PRId64, total - rng.offs);
+      if(rng.zeroPad)
+         padChr = '0';
+   }
+   txtLen = strlen(txtPtr);
+   txtDgts = txtLen - (((txtLen > 0) && (txtPtr[txtLen - 1] == '.'))?1:0);
+   if((txtDgts < dgts) && (_countRgthAlgn || (padChr == '0'))){   // Right alignment of the text, a trailing decimal point doesn't use a digit of the display
+      padPos = ((padChr == '0') && (txtPtr[0] == '-'))?1:0;   // The zeros are padded after the sign
+      memmove(txtPtr + padPos + (dgts - txtDgts), txtPtr + padPos, txtLen + 1 - padPos);
+      memset(txtPtr + padPos, padChr, dgts - txtDgts);
+   }
+
+   return result;
+}
+
+bool ClickCounter::_fmtUpdDisplay(){
+   bool result{true};
+   bool rndrChngd{false};
+   int64_t total{getTotal()};
+   uint8_t page{0};
+   TickType_t curTck{0};
+
+   if(_dspFmt == ccFmtPages){
+      curTck = xTaskGetTickCount();
+      if(static_cast<int32_t>(curTck - _fmtPgFlipTck) >= 0){
+         _fmtCurPg ^= 1;
+         _fmtPgFlipTck = curTck + _fmtPgTcks;
+      }
+      page = _fmtCurPg;
+   }
+   if(!_lastDspValid || (total < _fmtRng.lo) || (total >= _fmtRng.hi) || (page != _fmtRndrPg)){
+      _fmtRndr(total, _fmtDgts, page, _fmtDspMin, _fmtDspMax, _fmtTxt, sizeof(_fmtTxt), _fmtRng);   // The only place where the rendering divisions are made
+      _fmtRndrPg = page;
+      rndrChngd = true;
+   }
+   if(_fmtRng.bySub){
+      if(rndrChngd || (total != _fmtLastTtl))
+         result = _cntrDsplyPtr->print(static_cast<int32_t>(total - _fmtRng.offs), _countRgthAlgn, _fmtRng.zeroPad);
+   }
+   else if(rndrChngd){
+      _fmtPrntTxt = _fmtTxt;   // Copied to the reserved storage, no String is built for each print
+      result = _cntrDsplyPtr->print(_fmtPrntTxt);
+   }
+   _fmtLastTtl = total;
+   _lastDspValid = result;
+
+   return result;
+}
+
+void IRAM_ATTR ClickCounter::_instrAdd([[maybe_unused]] const uint8_t &hist, [[maybe_unused]] const int64_t &us){
+#if CC_INSTR_ENABLED
+   if(_instrPtr != nullptr){
+      uint32_t locUs{(us < 0)?(0):((us > UINT32_MAX)?(UINT32_MAX):(static_cast<uint32_t>(us)))};
+      uint8_t bckt{0};
+      uint32_t curMax{_instrPtr->maxUs[hist].load(std::memory_order_relaxed)};
+
+      if(locUs > 0){
+         bckt = 32 - __builtin_clz(locUs);   // Position of the highest bit set, the log2 bucket without a loop
+         if(bckt >= ccInstrBcktsQty)
+            bckt = ccInstrBcktsQty - 1;
+      }
+      _instrPtr->bckts[hist][bckt].fetch_add(1, std::memory_order_relaxed);
+      while((locUs > curMax) && !_instrPtr->maxUs[hist].compare_exchange_weak(curMax, locUs, std::memory_order_relaxed)){
+      }
+   }
+#endif
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_instrOp([[maybe_unused]] const ccBatchOpType_t &opType){
+#if CC_INSTR_ENABLED
+   if(_instrPtr != nullptr)
+      _instrPtr->opsQty[opType].fetch_add(1, std::memory_order_relaxed);
+#endif
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_instrRjct([[maybe_unused]] const uint32_t &qty){
+#if CC_INSTR_ENABLED
+   if(_instrPtr != nullptr)
+      _instrPtr->rjctdQty.fetch_add(qty, std::memory_order_relaxed);
+#endif
+
+   return;
+}
+
+bool ClickCounter::_lckdUpdDisplay(){
+   bool result{false};
+
+   if(_dfrdRfrsh){
+      _mrkDspDirty();
+      result = true;
+   }
+   else if(!_noDisplay){
+      if(_mtxTake()){
+         result = _updDisplay();
+         _mtxGive();
+      }
+   }
+   else
+      result = true;
+
+   return result;
+}
+
+void ClickCounter::_mrkDspDirty(){
+   if(!_noDisplay && !_dspDirty.exchange(true))
+      _rfrshTskNtfy();
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_mrkDspDirtyFromISR(BaseType_t* pxHigherPriorityTaskWoken){
+   if(!_noDisplay && !_dspDirty.exchange(true))
+      _rfrshTskNtfy(pxHigherPriorityTaskWoken, true);
+
+   return;
+}
+
+void ClickCounter::_mtxGive(){
+#if CC_INSTR_ENABLED
+   if(_instrPtr != nullptr)
+      _instrAdd(_instrLckHold, esp_timer_get_time() - _instrPtr->hldStrt);
+#endif
+   xSemaphoreGive(_CCCountMutex);
+
+   return;
+}
+
+bool ClickCounter::_mtxTake(){
+   bool result{false};
+#if CC_INSTR_ENABLED
+   int64_t strtTm{esp_timer_get_time()};
+#endif
+
+   result = (xSemaphoreTake(_CCCountMutex, portMAX_DELAY) == pdTRUE);
+#if CC_INSTR_ENABLED
+   if(result && (_instrPtr != nullptr)){
+      _instrPtr->hldStrt = esp_timer_get_time();
+      _instrAdd(_instrLckWait, _instrPtr->hldStrt - strtTm);
+   }
+#endif
+
+   return result;
+}
+
+bool ClickCounter::_rfrshDisplay(){
+   bool result{false};
+
+   if(_dfrdRfrsh){
+      _mrkDspDirty();
+      result = true;
+   }
+   else
+      result = _updDisplay();
+
+   return result;
+}
+
+int64_t IRAM_ATTR ClickCounter::_rllvrFit(int64_t &val, const int32_t &cntMin, const int32_t &cntMax){
+   int64_t result{0};
+   int64_t span{static_cast<int64_t>(cntMax) - cntMin + 1};
+   int64_t offset{val - cntMin};
+
+   if((offset < 0) || (offset >= span)){
+      if((offset >= span) && (offset < (2 * span)))   // Single wrap, the usual case, solved without a division
+         result = 1;
+      else if((offset < 0) && (offset >= -span))
+         result = -1;
+      else{
+         result = offset / span;
+         if((offset % span) < 0)
+            result--;
+      }
+      val -= result * span;
+   }
+
+   return result;
+}
+
+void ClickCounter::_rfrshTsk(void* argp){
+   ClickCounter* cntrPtr = static_cast<ClickCounter*>(argp);
+   TickType_t frmTcks{cntrPtr->_rfrshFrmTcks};
+
+   for(;;){
+      if(cntrPtr->_dspRate)   // The rate and the page shown change with time even if the count doesn't
+         ulTaskNotifyTake(pdTRUE, cntrPtr->_rtBcktTcks);
+      else if(cntrPtr->_dspFmt == ccFmtPages)
+         ulTaskNotifyTake(pdTRUE, cntrPtr->_fmtPgTcks);
+      else
+         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      if(cntrPtr->_rfrshTskStop)
+         break;
+      cntrPtr->pumpDisplay();
+      vTaskDelay(frmTcks);   // Notifications received meanwhile are collapsed into the next print
+   }
+   cntrPtr->_rfrshTskHndl.store(nullptr);
+   while(cntrPtr->_rfrshTskUsrs.load() != 0)   // Notifiers that read the handle before it was cleared are still using it
+      vTaskDelay(1);
+   cntrPtr->_rfrshTskStop.store(false);   // Last access to the object, stopRefreshTask() returns after it
+   vTaskDelete(NULL);
+}
+
+void IRAM_ATTR ClickCounter::_rfrshTskNtfy(BaseType_t* pxHigherPriorityTaskWoken, const bool &fromIsr){
+   TaskHandle_t tskHndl{nullptr};
+
+   _rfrshTskUsrs.fetch_add(1);
+   tskHndl = _rfrshTskHndl.load();
+   if(tskHndl != nullptr){
+      if(fromIsr)
+         vTaskNotifyGiveFromISR(tskHndl, pxHigherPriorityTaskWoken);
+      else
+         xTaskNotifyGive(tskHndl);
+   }
+   _rfrshTskUsrs.fetch_sub(1);
+
+   return;
+}
+
+TickType_t ClickCounter::_tmOutLeft(const TickType_t &strtTck, const TickType_t &tmOut){
+   TickType_t result{portMAX_DELAY};
+   TickType_t elpsdTcks{0};
+
+   if(tmOut != portMAX_DELAY){
+      elpsdTcks = xTaskGetTickCount() - strtTck;
+      result = (elpsdTcks < tmOut)?(tmOut - elpsdTcks):(0);
+   }
+
+   return result;
+}
+
+void IRAM_ATTR ClickCounter::_rtAdd(const uint32_t &clicks){
+   TickType_t curTcks{xPortInIsrContext()?xTaskGetTickCountFromISR():xTaskGetTickCount()};
+
+   portENTER_CRITICAL_SAFE(&_rtMux);
+   if((curTcks - _rtBcktStrt) >= _rtBcktTcks)
+      _rtRoll(curTcks);
+   _rtCurBckt += clicks;
+   portEXIT_CRITICAL_SAFE(&_rtMux);
+
+   return;
+}
+
+void ClickCounter::_rtChkRoll(){
+   TickType_t curTcks{xTaskGetTickCount()};
+
+   if((curTcks - _rtBcktStrt) >= _rtBcktTcks)
+      _rtRoll(curTcks);
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_rtPushBckt(const uint32_t &clicks){
+   int64_t bcktRate{0};
+
+   _rtWndwSum = _rtWndwSum - _rtBckts[_rtBcktIdx] + clicks;
+   _rtBckts[_rtBcktIdx] = clicks;
+   if(++_rtBcktIdx == _rtBcktsQty)
+      _rtBcktIdx = 0;
+   bcktRate = (static_cast<int64_t>(clicks) * _rtBcktsPerMin) << _rtFxdPtShft;
+   _rtEwma += (bcktRate - _rtEwma) >> _rtEwmaShft;
+   if(bcktRate > _rtPeak)
+      _rtPeak = bcktRate;
+
+   return;
+}
+
+void IRAM_ATTR ClickCounter::_rtRoll(const TickType_t &curTcks){
+   uint32_t elpsdBckts{(curTcks - _rtBcktStrt) / _rtBcktTcks};
+
+   _rtBcktStrt += elpsdBckts * _rtBcktTcks;
+   _rtPushBckt(_rtCurBckt);
+   _rtCurBckt = 0;
+   if(elpsdBckts > _rtMaxIdleBckts){   // The window is empty, and the EWMA is cleared even if a slow smoothing would keep a residue: pushing an empty bucket for each one would make the roll time unbounded
+      memset(_rtBckts, 0, sizeof(_rtBckts));
+      _rtWndwSum = 0;
+      _rtEwma = 0;
+   }
+   else{
+      while(--elpsdBckts > 0)
+         _rtPushBckt(0);
+   }
+
+   return;
+}
+
+void ClickCounter::_wpDsptchTsk(void* argp){
+   QueueHandle_t wpQueue = static_cast<QueueHandle_t>(argp);
+   ccWpCall_t wpCall{nullptr, nullptr};
+
+   for(;;){
+      if(xQueueReceive(wpQueue, &wpCall, portMAX_DELAY) == pdTRUE){
+         if(wpCall.fnPtr == nullptr)
+            break;
+         wpCall.fnPtr(wpCall.argPtr);
+      }
+   }
+   static_cast<ClickCounter*>(wpCall.argPtr)->_wpTskHndl.store(nullptr);   // Last access to the object, stopDispatchTask() returns after it
+   vTaskDelete(NULL);
+}
+
+void IRAM_ATTR ClickCounter::_wpChk(const int32_t &prevVal, const int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken){
+   ccWpCall_t wpCalls[_wpCallsPerChunk];
+   uint8_t callsQty{0};
+   int32_t loVal{(prevVal < newVal)?prevVal:newVal};
+   int32_t hiVal{(prevVal < newVal)?newVal:prevVal};
+   uint32_t wpPos{0};
+   uint32_t wpGen{0};
+   int32_t lastVal{0};
+   uint32_t lastId{0};
+   bool trggrd{false};
+   bool pending{false};
+   bool srchd{false};
+   bool wtrsFlgd{false};
+   QueueHandle_t wpQueue{nullptr};
+   BaseType_t inIsr{xPortInIsrContext()};
+
+   do{
+      callsQty = 0;
+      pending = false;
+      wtrsFlgd = false;
+      portENTER_CRITICAL_SAFE(&_wpMux);
+      if(!srchd){   // The first chunk is collected in the same critical section as the search
+         wpPos = _wpLwrBnd(loVal);
+         wpGen = _wpGen;
+         srchd = true;
+      }
+      else if(wpGen != _wpGen){  // The watchpoints list changed since the last chunk, the check resumes after the last watchpoint checked
+         wpPos = _wpLwrBnd(lastVal, lastId + 1);
+         wpGen = _wpGen;
+      }
+      while((wpPos < _wpQty.load(std::memory_order_relaxed)) && (_wpArrPtr[wpPos].wpVal <= hiVal)){
+         if(callsQty == _wpCallsPerChunk){
+            pending = true;
+            break;
+         }
+         switch(_wpArrPtr[wpPos].wpType){
+            case ccWpReached:
+            case ccWpMinHit:
+            case ccWpMaxHit:
+               trggrd = (_wpArrPtr[wpPos].wpVal == newVal);
+               break;
+            case ccWpCrossUp:
+               trggrd = ((prevVal < _wpArrPtr[wpPos].wpVal) && (_wpArrPtr[wpPos].wpVal <= newVal));
+               break;
+            case ccWpCrossDown:
+               trggrd = ((prevVal > _wpArrPtr[wpPos].wpVal) && (_wpArrPtr[wpPos].wpVal >= newVal));
+               break;
+            default:
+               trggrd = false;
+               break;
+         }
+         if(trggrd){
+            wpCalls[callsQty].fnPtr = _wpArrPtr[wpPos].fnPtr;
+            wpCalls[callsQty].argPtr = _wpArrPtr[wpPos].argPtr;
+            if(wpCalls[callsQty].fnPtr == nullptr){   // A task blocked in waitUntil(), flagged while its entry can't be removed
+               static_cast<ccWtr_t*>(wpCalls[callsQty].argPtr)->trggrd = true;
+               wpCalls[callsQty].argPtr = static_cast<ccWtr_t*>(wpCalls[callsQty].argPtr)->tskHndl;
+               wtrsFlgd = true;
+            }
+            callsQty++;
+         }
+         lastVal = _wpArrPtr[wpPos].wpVal;
+         lastId = _wpArrPtr[wpPos].wpId;
+         wpPos++;
+      }
+      if(wtrsFlgd)   // Registered before the critical section ends, so the flagged tasks can't return from waitUntil() before being notified
+         _wtNtfUsrs.fetch_add(1);
+      portEXIT_CRITICAL_SAFE(&_wpMux);
+      _wpQueueUsrs.fetch_add(1);
+      wpQueue = _wpQueue.load();
+      for(uint8_t i{0}; i < callsQty; i++){   // FreeRTOS queue and notification services can't be invoked inside the critical section
+         if(wpCalls[i].fnPtr == nullptr){
+            if(inIsr)
+               xTaskNotifyFromISR(static_cast<TaskHandle_t>(wpCalls[i].argPtr), _wtNtfBit, eSetBits, pxHigherPriorityTaskWoken);
+            else
+               xTaskNotify(static_cast<TaskHandle_t>(wpCalls[i].argPtr), _wtNtfBit, eSetBits);
+         }
+         else if((wpQueue == nullptr) || ((inIsr?xQueueSendFromISR(wpQueue, &wpCalls[i], pxHigherPriorityTaskWoken):xQueueSend(wpQueue, &wpCalls[i], 0)) != pdTRUE))
+            _wpLostQty.fetch_add(1, std::memory_order_relaxed);
+      }
+      _wpQueueUsrs.fetch_sub(1);
+      if(wtrsFlgd)
+         _wtNtfUsrs.fetch_sub(1);
+   }while(pending);
+
+   return;
+}
+
+bool ClickCounter::_wpIns(const ccWtchPnt_t &newWp){
+   bool result{false};
+   bool rtry{false};
+   ccWtchPnt_t locWp{newWp};
+   ccWtchPnt_t* newArrPtr{nullptr};
+   ccWtchPnt_t* oldArrPtr{nullptr};
+   uint32_t newCap{0};
+   uint32_t insPos{0};
+
+   if(locWp.wpType == ccWpMinHit)
+      locWp.wpVal = _countMin;
+   else if(locWp.wpType == ccWpMaxHit)
+      locWp.wpVal = _countMax;
+   do{
+      rtry = false;
+      newArrPtr = nullptr;
+      oldArrPtr = nullptr;
+      newCap = _wpCap;
+      if(_wpQty.load() == _wpCap){
+         newCap = (_wpCap == 0)?4:(_wpCap * 2);
+         newArrPtr = new(std::nothrow) ccWtchPnt_t[newCap];   // Allocated outside the critical section, the counting methods might be reading the current array
+      }
+      if((newCap != _wpCap) && (newArrPtr == nullptr))
+         break;
+      portENTER_CRITICAL(&_wpMux);
+      if(_wpQty.load() >= ((newArrPtr != nullptr)?newCap:_wpCap)){   // Other task filled the array after the capacity was checked
+         oldArrPtr = newArrPtr;
+         rtry = true;
+      }
+      else{
+         if(newArrPtr != nullptr){
+            for(uint32_t i{0}; i < _wpQty.load(); i++)
+               newArrPtr[i] = _wpArrPtr[i];
+            oldArrPtr = _wpArrPtr;
+            _wpArrPtr = newArrPtr;
+            _wpCap = newCap;
+         }
+         locWp.wpId = _wpNxtId++;
+         insPos = _wpLwrBnd(locWp.wpVal, locWp.wpId);   // After the watchpoints with the same value, as the id is the greatest
+         for(uint32_t i{_wpQty.load()}; i > insPos; i--)
+            _wpArrPtr[i] = _wpArrPtr[i - 1];
+         _wpArrPtr[insPos] = locWp;
+         _wpQty.fetch_add(1);
+         _wpGen++;
+         result = true;
+      }
+      portEXIT_CRITICAL(&_wpMux);
+      delete [] oldArrPtr;
+   }while(rtry);
+
+   return result;
+}
+
+uint32_t IRAM_ATTR ClickCounter::_wpLwrBnd(const int32_t &val, const uint32_t &id){
+   uint32_t loPos{0};
+   uint32_t hiPos{_wpQty.load(std::memory_order_relaxed)};
+   uint32_t midPos{0};
+
+   while(loPos < hiPos){
+      midPos = loPos + ((hiPos - loPos) / 2);
+      if((_wpArrPtr[midPos].wpVal < val) || ((_wpArrPtr[midPos].wpVal == val) && (_wpArrPtr[midPos].wpId < id)))
+         loPos = midPos + 1;
+      else
+         hiPos = midPos;
+   }
+
+   return loPos;
+}
+
+void ClickCounter::_wpRmvWtr(ccWtr_t* wtrPtr){
+   uint32_t wpPos{0};
+
+   portENTER_CRITICAL(&_wpMux);
+   for(wpPos = 0; wpPos < _wpQty.load(); wpPos++){
+      if((_wpArrPtr[wpPos].fnPtr == nullptr) && (_wpArrPtr[wpPos].argPtr == wtrPtr))
+         break;
+   }
+   if(wpPos < _wpQty.load()){
+      for(uint32_t i{wpPos + 1}; i < _wpQty.load(); i++)
+         _wpArrPtr[i - 1] = _wpArrPtr[i];
+      _wpQty.fetch_sub(1);
+      _wpGen++;
+   }
+   portEXIT_CRITICAL(&_wpMux);
+   if(wtrPtr->trggrd){   // Flagged by a counting method that might not have notified the task yet, the task handle must not be notified after the wait ended
+      while(_wtNtfUsrs.load() != 0)
+         vTaskDelay(1);
+   }
+
+   return;
+}
+
+void ClickCounter::_wpRslvBnds(){
+   ccWtchPnt_t wpAux{};
+   uint32_t j{0};
+
+   portENTER_CRITICAL(&_wpMux);
+   for(uint32_t i{0}; i < _wpQty.load(); i++){
+      if(_wpArrPtr[i].wpType == ccWpMinHit)
+         _wpArrPtr[i].wpVal = _countMin;
+      else if(_wpArrPtr[i].wpType == ccWpMaxHit)
+         _wpArrPtr[i].wpVal = _countMax;
+   }
+   for(uint32_t i{1}; i < _wpQty.load(); i++){   // Insertion sort, only the bounds watchpoints might be out of place
+      wpAux = _wpArrPtr[i];
+      for(j = i; (j > 0) && ((_wpArrPtr[j - 1].wpVal > wpAux.wpVal) || ((_wpArrPtr[j - 1].wpVal == wpAux.wpVal) && (_wpArrPtr[j - 1].wpId > wpAux.wpId))); j--)
+         _wpArrPtr[j] = _wpArrPtr[j - 1];
+      _wpArrPtr[j] = wpAux;
+   }
+   _wpGen++;
+   portEXIT_CRITICAL(&_wpMux);
+
+   return;
+}
+
+void ClickCounter::_snpWrtBgn(){
+
+   portENTER_CRITICAL(&_snpMux);   // Writers are serialized, and a reader in the same core can't interrupt a write
+   _snpSeq.fetch_add(1, std::memory_order_relaxed);
+   std::atomic_thread_fence(std::memory_order_release);
+
+   return;
+}
+
+void ClickCounter::_snpWrtEnd(){
+
+   _snpSeq.fetch_add(1, std::memory_order_release);
+   portEXIT_CRITICAL(&_snpMux);
+
+   return;
+}
+
+bool ClickCounter::_updDisplay(){
+   bool result{false};
+   int32_t curVal{0};
+#if CC_INSTR_ENABLED
+   int64_t strtTm{esp_timer_get_time()};
+#endif
+
+   if(!_noDisplay){
+      if((_dspFmt != ccFmtCount) && !_dspRate){
+         result = _fmtUpdDisplay();
+      }
+      else{
+         curVal = _dspVal();
+         result = _cntrDsplyPtr->print(curVal, _countRgthAlgn, _countZeroPad);
+         _lastDspVal = curVal;
+         _lastDspValid = result;
+      }
+#if CC_INSTR_ENABLED
+      _instrAdd(_instrDspLat, esp_timer_get_time() - strtTm);
+#endif
+   }
+   else
+      result = true;
+    
+   return result;
+}
+
+bool ClickCounter::updDisplay(){
+   bool result{false};
+      if(_mtxTake()){
+         result = _updDisplay();
+         _mtxGive();
+      }
+
+   return result;
+}
+
+bool ClickCounter::waitForChange(const TickType_t &tmOut){
+   bool result{false};
+
+   if(!xPortInIsrContext())
+      result = _chngWt(nullptr, nullptr, tmOut);
+
+   return result;
+}
+
+bool ClickCounter::waitUntil(const ccWpType_t &wpType, const int32_t &wpVal, const TickType_t &tmOut){
+   bool result{false};
+   ccWtr_t wtr{nullptr, false};
+   int32_t curVal{0};
+   TickType_t strtTck{xTaskGetTickCount()};
+   TickType_t tmLeft{0};
+   uint32_t ntfVal{0};
+
+   if(!xPortInIsrContext()){
+      wtr.tskHndl = xTaskGetCurrentTaskHandle();
+      if(_wpIns(ccWtchPnt_t{wpVal, wpType, nullptr, &wtr, 0})){
+         curVal = _count.load();   // Checked after registering, so a modification can't be missed between the check and the wait
+         switch(wpType){
+            case ccWpReached:
+               result = (curVal == wpVal);
+               break;
+            case ccWpCrossUp:
+               result = (curVal >= wpVal);
+               break;
+            case ccWpCrossDown:
+               result = (curVal <= wpVal);
+               break;
+            case ccWpMinHit:
+               result = (curVal == _countMin);
+               break;
+            case ccWpMaxHit:
+               result = (curVal == _countMax);
+               break;
+            default:
+               break;
+         }
+         while(!result && !wtr.trggrd){
+            tmLeft = _tmOutLeft(strtTck, tmOut);
+            if(tmLeft == 0)
+               break;
+            xTaskNotifyWait(0, _wtNtfBit, &ntfVal, tmLeft);   // Notifications left by a previous wait, already delivered when it returned, just make the flag be checked again
+         }
+         _wpRmvWtr(&wtr);
+         if(wtr.trggrd)   // Read after the entry was removed, it might have been flagged while the time out expired
+            result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickCounter::waitUntil(fncBlnCntPrmPtrType predFn, void* argPtr, const TickType_t &tmOut){
+   bool result{false};
+
+   if((predFn != nullptr) && !xPortInIsrContext())
+      result = _chngWt(predFn, argPtr, tmOut);
 
    return result;
 }
@@ -45,7 +45,22 @@
 
 #include<Arduino.h>
 #include <stdint.h>
+#include <atomic>
+#include <freertos/event_groups.h>
 #include <SevenSegDisplays.h>
+#include <ClickPulseSource_Esp32.h>
+#include <ClickEventJournal_Esp32.h>
+#include <ClickCountPersist_Esp32.h>
+#include <ClickTelemetry_Esp32.h>
+
+/**
+ * @brief Build flag enabling the ClickCounter instrumentation, see ClickCounter::getInstrSnapshot()
+ *
+ * Set it to 1 as a global build flag (i.e. `build_flags = -D CC_INSTR_ENABLED=1` in a PlatformIO project) to compile the instrumentation in. When it's 0 (default) no instrumentation code is compiled. The flag selects code only: the instrumentation data is kept in a ccInstrData_t block provided by the application, the object holds only a pointer to it, so a translation unit built with a different value than the library sees the same class layout.
+ */
+#ifndef CC_INSTR_ENABLED
+#define CC_INSTR_ENABLED 0
+#endif
 
 // Definition workaround to let a function/method return value to be a function pointer to a function that receives no arguments and returns no values: void (funcName*)()
 typedef void (*fncPtrType)();
@@ -55,6 +70,129 @@ typedef fncPtrType (*ptrToTrnFnc)();
 typedef void (*fncVdPtrPrmPtrType)(void*);
 typedef fncVdPtrPrmPtrType (*ptrToTrnFncVdPtr)(void*);
 
+// Definition workaround to let a function/method receive a function pointer to a function that receives an int32_t count value and a void* argument and returns a boolean value: bool (funcName*)(int32_t, void*)
+typedef bool (*fncBlnCntPrmPtrType)(int32_t, void*);
+
+/**
+ * @brief Operations available to be applied as part of a batch by the ClickCounter::apply() method
+ */
+enum ccBatchOpType_t{
+   ccOpUp,  /*!< Increment the count by the absolute value of the operation qty, as countUp(const int32_t &) */
+   ccOpDown,   /*!< Decrement the count by the absolute value of the operation qty, as countDown(const int32_t &) */
+   ccOpToZero, /*!< Approach the count to 0 by the absolute value of the operation qty, as countToZero(const int32_t &) */
+   ccOpRestart,   /*!< Restart the count to the operation qty value, as countRestart(const int32_t &) */
+   ccOpReset,  /*!< Restart the count to the begin() startVal, as countReset(). The operation qty is ignored */
+   ccOpBatch   /*!< Not valid as a batch operation. Identifies a complete batch applied by ClickCounter::apply() in the ClickEventJournal records */
+};
+
+/**
+ * @brief Operation to be applied as part of a batch by the ClickCounter::apply() method
+ */
+struct ccBatchOp_t{
+   ccBatchOpType_t opType; /*!< Type of the operation */
+   int32_t qty;   /*!< Quantity or value parameter for the operation */
+};
+
+/**
+ * @brief States of a command posted to the ClickCounter asynchronous queue, see ClickCounter::applyAsync()
+ */
+enum ccAsyncSt_t{
+   ccAsyncPndng,  /*!< The command is queued, waiting to be applied by the asynchronous task */
+   ccAsyncDone,   /*!< The command was successfully applied */
+   ccAsyncFailed  /*!< The command failed, as the equivalent counting method would, or it couldn't be queued */
+};
+
+/**
+ * @brief Completion result of a command posted to the ClickCounter asynchronous queue, see ClickCounter::applyAsync()
+ */
+struct ccAsyncRslt_t{
+   volatile ccAsyncSt_t status;  /*!< State of the command, set to ccAsyncPndng when the command is posted */
+   int32_t count; /*!< Count value after the drain that applied the command. Valid once the status is not ccAsyncPndng */
+   TaskHandle_t ntfTsk; /*!< Task to be notified, as by xTaskNotifyGive(), when the command is completed. Set it to nullptr to get no notification */
+};
+
+/**
+ * @brief Metrics of the ClickCounter asynchronous queue, see ClickCounter::getAsyncStats()
+ */
+struct ccAsyncStats_t{
+   uint32_t postedQty;  /*!< Quantity of commands queued */
+   uint32_t rjctdQty;   /*!< Quantity of commands rejected because the queue was full, the overload indicator */
+   uint32_t drainsQty;  /*!< Quantity of drains made by the asynchronous task. Each drain takes the object's mutex and refreshes the display just once */
+   uint32_t appliedQty; /*!< Quantity of commands applied, appliedQty / drainsQty is the average quantity of commands folded in a drain */
+   uint32_t maxBatch;   /*!< Greatest quantity of commands applied in a single drain */
+   uint32_t queuedQty;  /*!< Quantity of commands waiting in the queue when the metrics were read */
+};
+
+/**
+ * @brief Watchpoint types available for the ClickCounter::addWatchpoint() method
+ */
+enum ccWpType_t{
+   ccWpReached,   /*!< The count modification resulted in a count value equal to the watchpoint value */
+   ccWpCrossUp,   /*!< The count modification made the count reach or pass over the watchpoint value upwards, i.e. previous count < watchpoint value <= new count */
+   ccWpCrossDown, /*!< The count modification made the count reach or pass over the watchpoint value downwards, i.e. previous count > watchpoint value >= new count */
+   ccWpMinHit, /*!< The count modification resulted in a count value equal to the counter minimum valid value. The watchpoint value is ignored */
+   ccWpMaxHit  /*!< The count modification resulted in a count value equal to the counter maximum valid value. The watchpoint value is ignored */
+};
+
+/**
+ * @brief Quantity of buckets of the instrumentation histograms
+ */
+const uint8_t ccInstrBcktsQty{16};
+
+/**
+ * @brief Log-scale time histogram of the ClickCounter instrumentation
+ */
+struct ccInstrHist_t{
+   uint32_t bckts[ccInstrBcktsQty];  /*!< Quantity of samples by duration: bckts[0] holds the samples shorter than 1 microsecond, bckts[i] the samples of 2^(i-1) to 2^i - 1 microseconds. The last bucket holds also all the longer samples */
+   uint32_t maxUs;   /*!< Longest sample registered, in microseconds */
+};
+
+/**
+ * @brief Snapshot of the ClickCounter instrumentation data, see ClickCounter::getInstrSnapshot()
+ */
+struct ccInstrSnap_t{
+   ccInstrHist_t lckWait;  /*!< Time spent waiting to take the object's mutex */
+   ccInstrHist_t lckHold;  /*!< Time the object's mutex was held */
+   ccInstrHist_t dspLat;   /*!< Time taken by each display update, including the SevenSegDisplays print */
+   uint32_t rjctdQty;   /*!< Quantity of count modifications rejected for getting the count out of the valid range */
+   uint32_t opsQty[ccOpBatch + 1];  /*!< Quantity of successful count modifications, indexed by the ccBatchOpType_t value of the operation */
+};
+
+/**
+ * @brief Instrumentation data block of a ClickCounter object, provided by the application, see ClickCounter::setInstrumentation()
+ *
+ * The block is updated by the counting and displaying methods with relaxed atomic operations, and read by ClickCounter::getInstrSnapshot(). The counters without a block associated carry no instrumentation data at all.
+ */
+struct ccInstrData_t{
+   std::atomic<uint32_t> bckts[3][ccInstrBcktsQty]{};  /*!< Lock wait, lock hold and display latency histograms buckets, see ccInstrHist_t */
+   std::atomic<uint32_t> maxUs[3]{};   /*!< Lock wait, lock hold and display latency longest samples, in microseconds */
+   std::atomic<uint32_t> rjctdQty{0};  /*!< Quantity of count modifications rejected for getting the count out of the valid range */
+   std::atomic<uint32_t> opsQty[ccOpBatch + 1]{};  /*!< Quantity of successful count modifications, indexed by the ccBatchOpType_t value of the operation */
+   int64_t hldStrt{0};  /*!< Time the object's mutex was taken, written only by the mutex holder */
+};
+
+/**
+ * @brief Consistent snapshot of the ClickCounter state, see ClickCounter::snapshot()
+ */
+struct ccCntSnap_t{
+   int32_t count; /*!< Count value */
+   int32_t countMin; /*!< Minimum valid count value */
+   int32_t countMax; /*!< Maximum valid count value */
+   int32_t startVal; /*!< Start value set by the last successful begin() */
+   bool begun; /*!< Indicates if the counter was begun and not ended */
+   uint32_t gen; /*!< Generation of the counter configuration, incremented each time begin() or end() modifies the other members but the count */
+};
+
+/**
+ * @brief Formats available to render the count in the display, see ClickCounter::setDisplayFormat()
+ */
+enum ccDspFmt_t{
+   ccFmtCount, /*!< The count value, limited to the display valid range (default) */
+   ccFmtLowWindow,   /*!< The lowest order digits of the total that fit in the display, zero padded, as a mechanical odometer */
+   ccFmtScaled,   /*!< The total if it fits in the display, else the total scaled down to thousands or millions followed by a 'k' or 'M' suffix */
+   ccFmtPages  /*!< The total split in pages of as many digits as the display has, alternating the low order page and the high order page, the latter marked with a trailing decimal point */
+};
+
 /**
  * @class ClickCounter
  * 
@@ -73,20 +211,196 @@ private:
 
    int32_t _beginStartVal{0};
    bool _begun{false};
-   int32_t _count{0};
+   std::atomic<int32_t> _count{0};
+   bool _lockFree{false};
    bool _noDisplay{true};
 
+   ClickPulseSource* _pulseSrcPtr{nullptr};
+   ClickEventJournal* _jrnlPtr{nullptr};
+   ClickCountPersist* _prstPtr{nullptr};
+   ClickTelemetryEncoder* _tlmPtr{nullptr};
+   size_t _tlmChnl{0};
+
+   static const uint8_t _rtBcktsQty{10};
+   static const uint8_t _rtFxdPtShft{8};
+   static const uint32_t _rtMaxIdleBckts{64};
+   portMUX_TYPE _rtMux = portMUX_INITIALIZER_UNLOCKED;
+   TickType_t _rtBcktTcks{0};
+   TickType_t _rtBcktStrt{0};
+   uint32_t _rtBcktsPerMin{0};
+   uint32_t _rtBckts[_rtBcktsQty]{};
+   uint8_t _rtBcktIdx{0};
+   uint32_t _rtCurBckt{0};
+   uint32_t _rtWndwSum{0};
+   int64_t _rtEwma{0};
+   int64_t _rtPeak{0};
+   uint8_t _rtEwmaShft{3};
+   bool _dspRate{false};
+
+   bool _dfrdRfrsh{false};
+   std::atomic<bool> _dspDirty{false};
+   int32_t _lastDspVal{0};
+   bool _lastDspValid{false};
+   std::atomic<TaskHandle_t> _rfrshTskHndl{nullptr};
+   TickType_t _rfrshFrmTcks{1};
+   std::atomic<bool> _rfrshTskStop{false};   // Set by stopRefreshTask(), cleared by the exiting task as its last access to the object
+   std::atomic<uint32_t> _rfrshTskUsrs{0};   // Notifiers between reading _rfrshTskHndl and notifying it, the exiting task waits for them
+   static const uint32_t _rfrshTskStckSz{2048};
+
    fncVdPtrPrmPtrType _fnWhnCntValZero{nullptr};
 	void* _fnWhnCntValZeroArg {nullptr};
 
+   struct ccWtchPnt_t{
+      int32_t wpVal;
+      ccWpType_t wpType;
+      fncVdPtrPrmPtrType fnPtr;
+      void* argPtr;
+      uint32_t wpId;   // Insertion order, keeps the list strictly sorted by value and id
+   };
+   struct ccWpCall_t{
+      fncVdPtrPrmPtrType fnPtr;
+      void* argPtr;
+   };
+   static const uint8_t _wpCallsPerChunk{8};
+   static const uint32_t _wpDsptchTskStckSz{4096};
+   portMUX_TYPE _wpMux = portMUX_INITIALIZER_UNLOCKED;
+   ccWtchPnt_t* _wpArrPtr{nullptr};
+   std::atomic<uint32_t> _wpQty{0};
+   uint32_t _wpCap{0};
+   uint32_t _wpGen{0};
+   uint32_t _wpNxtId{0};
+   std::atomic<QueueHandle_t> _wpQueue{nullptr};
+   std::atomic<uint32_t> _wpQueueUsrs{0};   // Counting methods between reading _wpQueue and sending to it, stopDispatchTask() waits for them
+   std::atomic<TaskHandle_t> _wpTskHndl{nullptr};
+   std::atomic<uint32_t> _wpLostQty{0};
+
+   struct ccWtr_t{   // Task blocked by waitUntil(), kept in the watchpoints list as a watchpoint with no function
+      TaskHandle_t tskHndl;
+      volatile bool trggrd;
+   };
+   static const uint32_t _wtNtfBit{0x80000000};
+   std::atomic<uint32_t> _wtNtfUsrs{0};   // Counting methods between flagging a waitUntil() task and notifying it, the flagged task waits for them before returning
+   static const EventBits_t _chngWtrsBits{0x00FFFFFF};   // The event group bits usable by the waiting tasks, one bit each
+   std::atomic<EventGroupHandle_t> _chngEvGrp{nullptr};
+   std::atomic<uint32_t> _chngWtrsMsk{0};   // The bits allocated to the tasks waiting in waitForChange() and waitUntil()
+   std::atomic<uint32_t> _chngSeq{0};
+
+   struct ccAsyncCmd_t{
+      ccBatchOp_t op;
+      ccAsyncRslt_t* rsltPtr;
+   };
+   static const uint8_t _asyncBatchMax{32};
+   static const uint32_t _asyncTskStckSz{4096};
+   std::atomic<QueueHandle_t> _asyncQueue{nullptr};
+   std::atomic<uint32_t> _asyncQueueUsrs{0};   // Posting methods between reading _asyncQueue and sending to it, stopAsyncTask() waits for them
+   QueueHandle_t _asyncTskQueue{nullptr};   // The queue drained by the asynchronous task, deleted once the task ended
+   std::atomic<TaskHandle_t> _asyncTskHndl{nullptr};
+   std::atomic<uint32_t> _asyncPstdQty{0};
+   std::atomic<uint32_t> _asyncRjctdQty{0};
+   std::atomic<uint32_t> _asyncDrnsQty{0};
+   std::atomic<uint32_t> _asyncAppldQty{0};
+   std::atomic<uint32_t> _asyncMaxBatch{0};
+
+   portMUX_TYPE _snpMux = portMUX_INITIALIZER_UNLOCKED;
+   std::atomic<uint32_t> _snpSeq{0};   // Sequence lock of the configuration members, odd while they are being written
+
+   static const uint8_t _cscdMaxStgs{8};
+   bool _rllvr{false};
+   ClickCounter* _carryCntrPtr{nullptr};
+   ClickCounter* _carryFdrPtr{nullptr};   // The lower order stage whose carries this object receives
+   portMUX_TYPE _cscdMux = portMUX_INITIALIZER_UNLOCKED;
+   portMUX_TYPE* _cscdMuxPtr{nullptr};
+   std::atomic<int32_t> _carryQty{0};
+   std::atomic<int64_t> _ttlOffs{0};
+
+   uint32_t _sclNum{1};
+   uint32_t _sclDen{1};
+   std::atomic<uint32_t> _sclRmndr{0};   // Scaled pulses not reaching a whole count unit, always in the [0, _sclDen) range
+   std::atomic<int64_t> _pollPndng{0};   // Count units taken from the pulse source that didn't fit in the valid range yet
+
+   ccDspFmt_t _dspFmt{ccFmtCount};
+   uint8_t _fmtDgts{0};
+   int64_t _fmtPow{1};
+   int32_t _fmtDspMin{0};
+   int32_t _fmtDspMax{0};
+   TickType_t _fmtPgTcks{1};
+   TickType_t _fmtPgFlipTck{0};
+   uint8_t _fmtCurPg{1};   // The first page switch shows the low order page
+   uint8_t _fmtRndrPg{0};
+   struct ccFmtRng_t{   // Range of totals [lo, hi) rendered the same way, the ones printed by subtraction are shown as (total - offs)
+      int64_t lo;
+      int64_t hi;
+      int64_t offs;
+      bool bySub;
+      bool zeroPad;
+   };
+   ccFmtRng_t _fmtRng{0, 0, 0, false, false};
+   int64_t _fmtLastTtl{0};
+   char _fmtTxt[24]{};
+   String _fmtPrntTxt{};   // Reused by every text print, so printing needs no heap memory once setDisplayFormat() reserved the capacity
+
+   enum ccInstrHistIdx_t{   // Indexes of the ccInstrData_t histograms
+      _instrLckWait,
+      _instrLckHold,
+      _instrDspLat,
+      _instrHistsQty
+   };
+   ccInstrData_t* _instrPtr{nullptr};   // Kept even if CC_INSTR_ENABLED is 0, so the class layout is the same in every translation unit
+
  protected:
-   SemaphoreHandle_t _CCCountMutex; // Mutex to protect the _count value from concurrent access
+   SemaphoreHandle_t _CCCountMutex{nullptr}; // Mutex to protect the _count value from concurrent access, or only the display refresh when in lock-free mode
+   StaticSemaphore_t _CCCountMtxBuf;   // Storage of the _CCCountMutex, so the object needs no heap memory
+   bool _batchOpVal(const ccBatchOp_t &op, int32_t &val);
+   static int32_t _absQty(const int32_t &qty);
+   bool _sclPulses(const int32_t &pulses, int64_t &units, const int64_t &unitsLim = INT32_MAX);
+   static void _asyncFailQueued(QueueHandle_t asyncQueue);
+   bool _asyncPost(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr, const TickType_t &tmOut, BaseType_t* pxHigherPriorityTaskWoken);
+   static void _asyncTsk(void* argp);
+   bool _cntAddInRng(const int32_t &delta, int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   bool _cscdAdd(const int32_t &delta, int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   bool _cscdBatchOp(const ccBatchOp_t &op, int32_t &newVal, int64_t &netDelta);
+   void _cscdLck();
+   void _cscdUnlck();
+   void _chngNtfy(BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   bool _chngWt(fncBlnCntPrmPtrType predFn, void* argPtr, const TickType_t &tmOut);
+   void _cntChngd(const ccBatchOpType_t &opType, const int64_t &delta, const int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   int32_t _dspVal();
+   bool _fmtRndr(const int64_t &total, const uint8_t &dgts, const uint8_t &page, const int32_t &dspMin, const int32_t &dspMax, char* txtPtr, const size_t &txtSz, ccFmtRng_t &rng) const;
+   bool _fmtUpdDisplay();
+   void _instrAdd(const uint8_t &hist, const int64_t &us);
+   void _instrOp(const ccBatchOpType_t &opType);
+   void _instrRjct(const uint32_t &qty = 1);
+   bool _lckdUpdDisplay();
+   void _mrkDspDirty();
+   void _mrkDspDirtyFromISR(BaseType_t* pxHigherPriorityTaskWoken);
+   void _mtxGive();
+   bool _mtxTake();
+   bool _rfrshDisplay();
+   static void _rfrshTsk(void* argp);
+   void _rfrshTskNtfy(BaseType_t* pxHigherPriorityTaskWoken = nullptr, const bool &fromIsr = false);
+   static TickType_t _tmOutLeft(const TickType_t &strtTck, const TickType_t &tmOut);
+   int64_t _rllvrFit(int64_t &val, const int32_t &cntMin, const int32_t &cntMax);
+   static void _wpDsptchTsk(void* argp);
+   uint32_t _wpLwrBnd(const int32_t &val, const uint32_t &id = 0);
+   void _wpChk(const int32_t &prevVal, const int32_t &newVal, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
+   bool _wpIns(const ccWtchPnt_t &newWp);
+   void _wpRmvWtr(ccWtr_t* wtrPtr);
+   void _wpRslvBnds();
+   void _rtAdd(const uint32_t &clicks);
+   void _rtChkRoll();
+   void _rtPushBckt(const uint32_t &clicks);
+   void _rtRoll(const TickType_t &curTcks);
+   void _snpWrtBgn();
+   void _snpWrtEnd();
    bool _updDisplay();
 
 public:
    /**
     * @brief Default constructor
     * 
+    * Instantiates a ClickCounter object without an associated display and with an empty valid range, that must be set (i.e. by a derived class) before begin() is invoked.  
+    * 
+    * @note No ClickCounter constructor uses heap memory: the object's mutex is built in a storage that is part of the object, so counters might be placed in static storage, or in memory provided by the application, with no heap use. The construction, begin(), the counting methods, end() and the destruction use no heap memory either. Only the optional services (watchpoints, dispatcher, refresh and asynchronous tasks, waitForChange()) allocate memory or create tasks, and only when first used.  
     */
    ClickCounter();
    /**
@@ -117,6 +431,84 @@ public:
     * @brief Class destructor.  
     */
    ~ClickCounter();
+   /**
+    * @brief Copy constructor, deleted: the object owns its mutex, and the tasks, queues and linked objects reference it by its address.
+    */
+   ClickCounter(const ClickCounter&) = delete;
+   /**
+    * @brief Copy assignment operator, deleted for the same reasons as the copy constructor.
+    */
+   ClickCounter& operator=(const ClickCounter&) = delete;
+   /**
+    * @brief Adds a watchpoint to the object.
+    * 
+    * A watchpoint associates a condition on the count value changes with a function to be executed when the condition is met. Every successful count modification, including the ones made from ISRs, checks the watchpoints affected by the change, kept sorted by value so that the check takes a logarithmic time on the quantity of watchpoints. The functions of the triggered watchpoints are never executed by the counting method: they are queued to be executed by the dispatcher task (see startDispatchTask(const UBaseType_t &, const UBaseType_t &)) outside of any object's lock, so the executed functions can't stall the counting. Any quantity of watchpoints might be added, limited by the available memory.  
+    * 
+    * @param wpType Type of the watchpoint, one of the ccWpType_t values.  
+    * @param wpVal Count value watched. Ignored for the ccWpMinHit and ccWpMaxHit watchpoint types.  
+    * @param fnPtr Function to execute when the watchpoint is triggered. The function must receive a void* argument and return no value.  
+    * @param argPtr (Optional) Argument to pass to the fnPtr function when executed. If not provided a nullptr will be passed.  
+    * 
+    * @return The success in adding the watchpoint.
+    * @retval true The watchpoint was added.
+    * @retval false The fnPtr parameter was nullptr, or the memory needed to keep the watchpoint couldn't be allocated.
+    * 
+    * @note The functions of the triggered watchpoints will not be executed unless the dispatcher task is running.  
+    */
+   bool addWatchpoint(const ccWpType_t &wpType, const int32_t &wpVal, fncVdPtrPrmPtrType fnPtr, void* argPtr = nullptr);
+   /**
+    * @brief Applies a sequence of count operations as a single atomic modification. 
+    * 
+    * The operations are applied in the provided order over the current count value, each one with the same validations as the equivalent counting method. A failing operation doesn't modify the count, and the next operations are applied over the value resulting from the previous successful ones. The resulting value is stored as the new count value in a single modification, so no other task can observe or modify the count in any of the intermediate states, the object's mutex is taken just once, and the display is refreshed just once at the end.  
+    * If the object is in rollover mode or is a stage of a cascade (see setCarryCounter(ClickCounter*)) the counting up and down operations wrap and generate carries as countUp(const int32_t &) and countDown(const int32_t &) do, and the operations are applied one after the other, each one as a single atomic modification, so other tasks might observe the intermediate states. The count restart and reset operations clear the total, the scaled pulses remainder and the pending polled units as countRestart(const int32_t &) does.  
+    * 
+    * @param opsPtr Pointer to an array of ccBatchOp_t structures, each one holding an operation to apply.  
+    * @param opsQty Quantity of operations in the **opsPtr** array.  
+    * @param rsltsPtr (Optional) Pointer to an array of at least **opsQty** booleans, where the success of each operation will be stored. If not provided (or nullptr) the individual results will not be reported.  
+    * 
+    * @return The success of the complete batch.
+    * @retval true All the operations were successfully applied and the display (if there's one associated) was updated.
+    * @retval false The opsPtr was nullptr or opsQty was 0, at least one of the operations failed, or the display update failed.
+    * 
+    * Use example:  
+    * @code {.cpp}
+    * ccBatchOp_t endOfBatch[3] {{ccOpDown, 5}, {ccOpDown, 5}, {ccOpToZero, 2}};
+    * bool opsRslts[3]{};
+    * myClickCounter.apply(endOfBatch, 3, opsRslts);
+    * @endcode
+    */
+   bool apply(const ccBatchOp_t* opsPtr, const size_t &opsQty, bool* rsltsPtr = nullptr);
+   /**
+    * @brief Posts a count operation to be applied by the asynchronous task. 
+    * 
+    * The operation is queued and the method returns immediately, without taking the object's mutex nor printing to the display, so any quantity of tasks and ISRs might feed the counter without convoying on the mutex. The asynchronous task (see startAsyncTask(const UBaseType_t &, const UBaseType_t &)) drains all the queued operations at once and applies them as a single batch, as apply(const ccBatchOp_t*, const size_t &, bool*) does: each operation is validated as the equivalent counting method would, the mutex is taken just once and the display is refreshed just once for the whole drain.  
+    * 
+    * @param op Operation to apply.  
+    * @param rsltPtr (Optional) Pointer to a ccAsyncRslt_t structure where the completion result will be reported. Its status is set to ccAsyncPndng before the operation is queued, so the structure must be kept available until the status changes. If not provided (or nullptr) no result will be reported.  
+    * @param tmOut (Optional) Maximum time to wait for room in the queue, in ticks, ignored when invoked from an ISR. If not provided the method will not wait, so a full queue rejects the operation.  
+    * 
+    * @return The success in queuing the operation, not the result of the operation itself.
+    * @retval true The operation was queued.
+    * @retval false The asynchronous task is not running, the op type is not valid, or the queue was full, see getAsyncStats(ccAsyncStats_t &, const bool &).
+    * 
+    * @note Operations posted while the asynchronous task is being stopped are either applied or rejected, an operation queued is never left pending.  
+    * @note When invoked from an ISR no context switch is requested, use applyAsyncFromISR(const ccBatchOp_t &, ccAsyncRslt_t*, BaseType_t*) instead.  
+    */
+   bool applyAsync(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr = nullptr, const TickType_t &tmOut = 0);
+   /**
+    * @brief Posts a count operation to be applied by the asynchronous task, from an ISR. 
+    * 
+    * Equivalent to applyAsync(const ccBatchOp_t &, ccAsyncRslt_t*, const TickType_t &) invoked with no waiting time, reporting if the posting unblocked a task of higher priority than the interrupted one.  
+    * 
+    * @param op Operation to apply.  
+    * @param rsltPtr (Optional) Pointer to a ccAsyncRslt_t structure where the completion result will be reported, as in applyAsync(const ccBatchOp_t &, ccAsyncRslt_t*, const TickType_t &).  
+    * @param pxHigherPriorityTaskWoken (Optional) Pointer to a BaseType_t set to pdTRUE if the posting unblocked a task of higher priority, so a context switch should be requested before the ISR ends. If not provided (or nullptr) the information is not reported.  
+    * 
+    * @return The success in queuing the operation, not the result of the operation itself.
+    * @retval true The operation was queued.
+    * @retval false The asynchronous task is not running, the op type is not valid, or the queue was full.
+    */
+   bool applyAsyncFromISR(const ccBatchOp_t &op, ccAsyncRslt_t* rsltPtr = nullptr, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
    /**
     * @brief Sets the basic required parameters for the object to start working. 
     * 
@@ -124,7 +516,7 @@ public:
     * 
     * @return The success in setting the needed attribute values for the object to start working.  
     * @retval true The object was not previously begun, the display pointer (if provided) is not a nullptr and the startVal parameter is in the valid range. The object is started.
-    * @retval false One of the previously described conditions failed, the object is not ready to be used. 
+    * @retval false One of the previously described conditions failed, or the total count restored by the associated persistence object is out of the valid range (see setPersistence(ClickCountPersist*)), the object is not ready to be used. 
     * 
     * @attention If no startVal parameter is provided the default value 0 (zero) will be used. Keep in mind that begin() without parameter provided will fail if 
     */
@@ -199,6 +591,32 @@ public:
     * @warning The returned value must be kept controled to ensure no underflow error occurs and the counter is no longer holding a valid count. 
     */
    bool countDown(const int32_t &qty = 1);
+   /**
+    * @brief Posts a count decrement to be applied by the asynchronous task. 
+    * 
+    * Equivalent to applyAsync(const ccBatchOp_t &, ccAsyncRslt_t*, const TickType_t &) for a ccOpDown operation.  
+    * 
+    * @param qty (Optional) Integer value, its **absolute** value will be decremented from the current count value. If not provided a value of one will be used.  
+    * @param rsltPtr (Optional) Pointer to a ccAsyncRslt_t structure where the completion result will be reported. If not provided (or nullptr) no result will be reported.  
+    * @param tmOut (Optional) Maximum time to wait for room in the queue, in ticks. If not provided the method will not wait.  
+    * 
+    * @retval true The decrement was queued.
+    * @retval false The asynchronous task is not running, or the queue was full.
+    */
+   bool countDownAsync(const int32_t &qty = 1, ccAsyncRslt_t* rsltPtr = nullptr, const TickType_t &tmOut = 0);
+   /**
+    * @brief Decrements the value of the current count from an Interrupt Service Routine. 
+    * 
+    * ISR safe version of countDown(const int32_t &). The count is modified by a single atomic compare-and-swap operation, with the same range validation as countDown(const int32_t &), without taking the object's mutex and without printing to the display. If a display is associated it is flagged as outdated and the refresh task, if running, is notified to print the new value from task context (see startRefreshTask(const uint32_t &, const UBaseType_t &)). If no refresh task is running the display will be updated by the next pumpDisplay() call or by the next count modification made from task context.  
+    * 
+    * @param qty Optional integer value, its **absolute** value will be decremented from the current count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.  
+    * @param pxHigherPriorityTaskWoken (Optional) Pointer to a BaseType_t variable, set to pdTRUE if notifying the refresh task unblocked a task of higher priority than the interrupted one, in which case a context switch should be requested before the ISR exits (portYIELD_FROM_ISR()). May be nullptr.  
+    * 
+    * @return The success in decrementing the counter by the parameter's absolute value. 
+    * @retval true The count could be decremented by the corresponding value without setting count out of range.  
+    * @retval false The qty parameter was equal to 0, or the count couldn't be decremented by the parameter value without getting out of range. The counter will keep its current value. 
+    */
+   bool countDownFromISR(const int32_t &qty = 1, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
    /**
     * @brief Returns a boolean indicating if the current count value is equal to 0 (zero) or not. 
     * 
@@ -206,6 +624,29 @@ public:
     * @retval false The counter current value is NOT 0 (zero). 
     */
    bool countIsZero();   
+   /**
+    * @brief Counts raw pulses through the object's scaler. 
+    * 
+    * The pulses are converted to count units by the ratio set by setScaler(const uint32_t &, const uint32_t &), keeping the fraction of a unit not reached as a remainder for the next calls, so no pulse is lost by the conversion. The remainder is updated by a single atomic compare-and-swap operation: only when the pulses complete at least a whole unit the count is modified, by countUp(const int32_t &) or countDown(const int32_t &), and the display is updated. Inputs producing several pulses per counted unit (gear teeth per revolution, flowmeter pulses per litre) might be counted pulse by pulse at the cost of an atomic operation per pulse.  
+    * If no scaler was set each pulse is a count unit, and the method is equivalent to countUp(const int32_t &) for positive qty values, and countDown(const int32_t &) for negative qty values.  
+    * 
+    * @param qty Optional integer value, the quantity of pulses to count, positive values increment the count, negative values decrement it. If no parameter is passed a value of one will be used.  
+    * 
+    * @retval true The qty parameter was equal to 0, the pulses didn't complete a whole unit, or the units completed were counted. 
+    * @retval false The units completed couldn't be counted without getting the count out of range, the pulses are discarded. 
+    */
+   bool countPulses(const int32_t &qty = 1);
+   /**
+    * @brief Counts raw pulses through the object's scaler, from an Interrupt Service Routine. 
+    * 
+    * ISR safe version of countPulses(const int32_t &), the units completed are counted by countUpFromISR(const int32_t &, BaseType_t*) or countDownFromISR(const int32_t &, BaseType_t*).  
+    * 
+    * @param qty Optional integer value, the quantity of pulses to count, positive values increment the count, negative values decrement it. If no parameter is passed a value of one will be used.  
+    * @param pxHigherPriorityTaskWoken (Optional) See countUpFromISR(const int32_t &, BaseType_t*). May be nullptr.  
+    * 
+    * @return See countPulses(const int32_t &)
+    */
+   bool countPulsesFromISR(const int32_t &qty = 1, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
    /**
     * @brief Resets the counter. 
     * 
@@ -251,6 +692,50 @@ public:
     * @warning The returned value must be kept controled to ensure no overflow error occurs and the counter is no longer holding a valid count. 
     */
    bool countUp(const int32_t &qty = 1);
+   /**
+    * @brief Posts a count increment to be applied by the asynchronous task. 
+    * 
+    * Equivalent to applyAsync(const ccBatchOp_t &, ccAsyncRslt_t*, const TickType_t &) for a ccOpUp operation.  
+    * 
+    * @param qty (Optional) Integer value, its **absolute** value will be added to the current count value. If not provided a value of one will be used.  
+    * @param rsltPtr (Optional) Pointer to a ccAsyncRslt_t structure where the completion result will be reported. If not provided (or nullptr) no result will be reported.  
+    * @param tmOut (Optional) Maximum time to wait for room in the queue, in ticks. If not provided the method will not wait.  
+    * 
+    * @retval true The increment was queued.
+    * @retval false The asynchronous task is not running, or the queue was full.
+    * 
+    * Use example:  
+    * @code {.cpp}
+    * ccAsyncRslt_t rslt{ccAsyncPndng, 0, xTaskGetCurrentTaskHandle()};
+    * if(myClickCounter.countUpAsync(1, &rslt)){
+    *    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);   // Only needed if the task must know the result
+    * }
+    * @endcode
+    */
+   bool countUpAsync(const int32_t &qty = 1, ccAsyncRslt_t* rsltPtr = nullptr, const TickType_t &tmOut = 0);
+   /**
+    * @brief Increments the value of the current count from an Interrupt Service Routine. 
+    * 
+    * ISR safe version of countUp(const int32_t &). The count is modified by a single atomic compare-and-swap operation, with the same range validation as countUp(const int32_t &), without taking the object's mutex and without printing to the display. If a display is associated it is flagged as outdated and the refresh task, if running, is notified to print the new value from task context (see startRefreshTask(const uint32_t &, const UBaseType_t &)). If no refresh task is running the display will be updated by the next pumpDisplay() call or by the next count modification made from task context.  
+    * 
+    * @param qty Optional integer value, its **absolute** value will be incremented in the current count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.  
+    * @param pxHigherPriorityTaskWoken (Optional) Pointer to a BaseType_t variable, set to pdTRUE if notifying the refresh task unblocked a task of higher priority than the interrupted one, in which case a context switch should be requested before the ISR exits (portYIELD_FROM_ISR()). May be nullptr.  
+    * 
+    * @return The success in incrementing the counter by the parameter's absolute value. 
+    * @retval true The count could be incremented by the corresponding value without setting count out of range.  
+    * @retval false The qty parameter was equal to 0, or the count couldn't be incremented by the parameter value without getting out of range. The counter will keep its current value. 
+    * 
+    * Use example:  
+    * @code {.cpp}
+    * void IRAM_ATTR pulseIsr(){
+    *    BaseType_t xHigherPriorityTaskWoken{pdFALSE};
+    * 
+    *    myClickCounter.countUpFromISR(1, &xHigherPriorityTaskWoken);
+    *    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    * }
+    * @endcode
+    */
+   bool countUpFromISR(const int32_t &qty = 1, BaseType_t* pxHigherPriorityTaskWoken = nullptr);
    /**
     * @brief Disables the counter for further activities.  
     * 
@@ -261,12 +746,66 @@ public:
     * @retval false The counter was NOT active, no change of it's status was done. 
     */
    bool end();
+   /**
+    * @brief Returns the metrics of the asynchronous queue.
+    * 
+    * The metrics are read by relaxed atomic reads, without stopping the asynchronous task nor the posting methods.  
+    * 
+    * @param stats Variable where the metrics will be copied.  
+    * @param reset (Optional) Indicates if the metrics must be restarted after being copied. The queuedQty is never restarted. If not provided the metrics will not be restarted.  
+    * 
+    * @retval true The asynchronous task is running.
+    * @retval false The asynchronous task is not running, the metrics copied are the ones kept since it was last started.
+    */
+   bool getAsyncStats(ccAsyncStats_t &stats, const bool &reset = false);
+   /**
+    * @brief Returns the counter that receives the carries of this object.
+    * 
+    * @return A pointer to the carry counter set by setCarryCounter(ClickCounter*), or nullptr if there's none set.
+    */
+   ClickCounter* getCarryCounter();
+   /**
+    * @brief Returns the net quantity of carries generated by the object in rollover mode.
+    * 
+    * Each time a count modification wraps past the maximum valid value a carry is added, each time it wraps past the minimum valid value a carry is subtracted. The carries are accumulated even if there is a carry counter set.
+    * 
+    * @param reset (Optional) Indicates if the carries accumulator must be restarted to 0 after reading it. If not provided the accumulator will not be restarted.
+    * 
+    * @return The net quantity of carries generated since the object was built or since the last reset.
+    */
+   int32_t getCarryQty(const bool &reset = false);
    /**
     * @brief Get the object's count value. 
     * 
     * @return int32_t The current count value of the clickCounter object. 
     */
    int32_t getCount();
+   /**
+    * @brief Returns the format used to render the count in the display.
+    * 
+    * @return The format set by setDisplayFormat(const ccDspFmt_t &, const uint32_t &), ccFmtCount if none was set.
+    */
+   ccDspFmt_t getDisplayFormat();
+   /**
+    * @brief Returns the time each page of the total is shown in the ccFmtPages display format.
+    * 
+    * @return The time in milliseconds, as set by setDisplayFormat(const ccDspFmt_t &, const uint32_t &) and rounded to whole ticks.
+    */
+   uint32_t getDisplayPageMs();
+   /**
+    * @brief Renders the count as text, in the display format set, for a display of the digits quantity provided.
+    * 
+    * The text is the one the object would show in a display of that size: the count, or the total in the ccFmtLowWindow, ccFmtScaled and ccFmtPages formats, right aligned if the object was built to do so, and filled with dashes if the value doesn't fit. A trailing decimal point marks the high order page of the ccFmtPages format, and doesn't use a digit. The method is meant to show the counter in displays not bound to it, as ClickDisplayMux does.  
+    * 
+    * @param txtPtr Buffer where the text will be rendered.
+    * @param txtSz Size of the buffer, it must have room for the digits, a decimal point and the terminating null character.
+    * @param dgts Quantity of digits of the display, up to 18.
+    * @param page (Optional) Page of the total to render in the ccFmtPages format, 0 for the low order page and 1 for the high order page. If not provided the low order page is rendered.
+    * 
+    * @retval true The object is begun and its value was rendered.
+    * @retval false The object is not begun, the value doesn't fit in the digits provided, or the parameters are not valid. The text is filled with dashes if the buffer has room for them.
+    */
+   bool getDisplayText(char* txtPtr, const size_t &txtSz, const uint8_t &dgts, const uint8_t &page = 0);
    /**
     * @brief Returns the maximum rate the display can be configured to blink at. 
     * 
@@ -279,6 +818,49 @@ public:
     * @attention Opposite to the concept of Hertz, that designates how many times an action happens in a fixed period of time (a second), the value used in the `blink()` and all related methods is **the time set to elapse before the next action happens**.  
     */
    int32_t getMaxBlinkRate();
+   /**
+    * @brief Returns the function set to be executed when the count value reaches 0 (zero).
+    * 
+    * @return The function pointer set by setFnWhnCntValZeroPtr(fncVdPtrPrmPtrType, void*), or nullptr if no function is set.
+    */
+   fncVdPtrPrmPtrType getFnWhnCntValZeroPtr();
+   /**
+    * @brief Returns the instrumentation data collected.
+    * 
+    * The instrumentation registers, with minimum impact on the measured operations:
+    * - The time waited to take the object's mutex, and the time it was held, by the counting and displaying methods.  
+    * - The time taken by each display update.  
+    * - The quantity of count modifications rejected for getting the count out of the valid range.  
+    * - The quantity of successful count modifications by operation type.  
+    * 
+    * The data is copied by relaxed atomic reads, without locking the counting methods: an operation executed meanwhile might be partially reflected. The instrumentation is only available if the library was built with the CC_INSTR_ENABLED flag set to 1 and a data block was associated by setInstrumentation(ccInstrData_t*), otherwise it adds no execution time to the counting methods.  
+    * 
+    * @param snap Variable where the data will be copied. If the instrumentation is not available it's set to all zeros.
+    * @param reset (Optional) Indicates if the collected data must be restarted after being copied. If not provided the data will not be restarted.
+    * 
+    * @retval true The instrumentation is available and the data was copied.
+    * @retval false The library was built without instrumentation, or no data block is associated.
+    */
+   bool getInstrSnapshot(ccInstrSnap_t &snap, const bool &reset = false);
+   /**
+    * @brief Returns the instrumentation data block associated to the object.
+    * 
+    * @return A pointer to the ccInstrData_t block associated, or nullptr if there's no block associated, see setInstrumentation(ccInstrData_t*).
+    */
+   ccInstrData_t* getInstrumentation();
+   /**
+    * @brief Returns the event journal associated to the object.
+    * 
+    * @return A pointer to the ClickEventJournal object associated, or nullptr if there's no journal associated.
+    */
+   ClickEventJournal* getJournal();
+   /**
+    * @brief Returns the counting concurrency mode set for the object.
+    * 
+    * @retval true The object is set to the lock-free counting mode, see setLockFree(const bool &).
+    * @retval false The object is set to the mutex protected counting mode (default mode).
+    */
+   bool getLockFree();
    /**
     * @brief Returns the Maximum Counter Value.
     * 
@@ -307,6 +889,67 @@ public:
     * @return The Minimum Counter Value
     */
    int32_t getMinCountVal();
+   /**
+    * @brief Returns the count units taken from the pulse source not added to the count yet.
+    * 
+    * When the units delivered by a pollPulseSource() call don't fit in the valid count range the count is taken to the range limit and the rest are kept by the object, each following poll tries to add them again together with the new pulses, so no pulse taken from the source is lost. The pending units are discarded by the count restarts and resets.
+    * 
+    * @return The net quantity of pending count units, positive to be added to the count, negative to be subtracted from it.
+    */
+   int64_t getPendingUnits();
+   /**
+    * @brief Returns the persistence object associated to the object.
+    * 
+    * @return A pointer to the ClickCountPersist object associated, or nullptr if there's no persistence associated.
+    */
+   ClickCountPersist* getPersistence();
+   /**
+    * @brief Returns the pulse source associated to the object.
+    * 
+    * @return A pointer to the ClickPulseSource object associated, or nullptr if there's no pulse source associated.
+    */
+   ClickPulseSource* getPulseSource();
+   /**
+    * @brief Returns the counting rate over the rate statistics sliding window. 
+    * 
+    * The counting rate is calculated as the quantity of clicks registered in the last complete time buckets (see setRateStats(const uint32_t &, const uint8_t &)), the bucket currently in progress is not included. The clicks are the absolute values of the count modifications made by the counting methods, count restarts and resets are not included.  
+    * 
+    * @return The counting rate, in clicks per minute. If the rate statistics are not enabled 0 will be returned.
+    */
+   uint32_t getRate();
+   /**
+    * @brief Returns the exponentially weighted moving average (EWMA) of the counting rate. 
+    * 
+    * The EWMA is updated with the rate registered in each time bucket when the bucket is completed, each new bucket rate having a weight of 1/2^ewmaShft (see setRateStats(const uint32_t &, const uint8_t &)). After more than 64 consecutive buckets with no clicks the EWMA is cleared to 0.  
+    * 
+    * @return The counting rate EWMA, in clicks per minute. If the rate statistics are not enabled 0 will be returned.
+    */
+   uint32_t getRateEwma();
+   /**
+    * @brief Returns the highest counting rate registered in a single time bucket. 
+    * 
+    * @param reset (Optional) Indicates if the peak rate must be restarted to 0 after reading it. If not provided the peak rate will not be restarted.
+    * 
+    * @return The peak counting rate, in clicks per minute, since the rate statistics were enabled or since the last reset. If the rate statistics are not enabled 0 will be returned.
+    */
+   uint32_t getRatePeak(const bool &reset = false);
+   /**
+    * @brief Returns the count overflow mode set for the object.
+    * 
+    * @retval true The object is set to the rollover mode, see setRollover(const bool &).
+    * @retval false The object is set to reject the count modifications that get out of the valid range (default mode).
+    */
+   bool getRollover();
+   /**
+    * @brief Returns the quantity of triggered watchpoints whose function couldn't be queued for execution.
+    * 
+    * A triggered watchpoint function is lost when the dispatcher task is not running, or when its queue is full.  
+    * 
+    * @param reset (Optional) Indicates if the lost functions counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    * 
+    * @return The quantity of lost watchpoint function executions.
+    */
+   uint32_t getWatchpointLostQty(const bool &reset = false);
    /**
     * @brief Returns the value that was used to begin() the ClickCounter object. 
     * 
@@ -319,6 +962,20 @@ public:
     * @note No specific mechanism is provided to change the startVal attibute, as changing just that attribute might colude with the data integrity mechanisms. The only way provided to do such change is trough the execution of an `end()` method followed by a `begin(newStartValue)`, where the newStartValue is the intented value for startVal to be set to. 
     */
    int32_t getStartVal();
+   /**
+    * @brief Returns the telemetry encoder associated to the object.
+    * 
+    * @return A pointer to the ClickTelemetryEncoder object associated, or nullptr if there's no telemetry encoder associated.
+    */
+   ClickTelemetryEncoder* getTelemetry();
+   /**
+    * @brief Returns the object's total count. 
+    * 
+    * The total is a 64 bits value that keeps the real count when the count wraps in rollover mode (see setRollover(const bool &)): it's the count value plus the value of all the carries generated since the last count restart, plus the carries restored by the persistence backend (see setPersistence(ClickCountPersist*)). The total is calculated the same way in every mode: when the object is not in rollover mode and no carries were restored the total is equal to the count value.  
+    * 
+    * @return The total count value.
+    */
+   int64_t getTotal();
    /**
     * @brief Stops the display blinking, if it was doing so, leaving the display turned on.
     * 
@@ -332,6 +989,38 @@ public:
     * @endcode
     */
    bool noBlink();
+   /**
+    * @brief Polls the associated pulse source and adds the accumulated pulses to the count.
+    * 
+    * All the pulses accumulated by the pulse source since the last poll are added to the count with a single countUp(const int32_t &) call (or subtracted with a single countDown(const int32_t &) call if the source delivered a negative net quantity), so the count and display update costs are paid once per poll instead of once per pulse.  
+    * If the units don't fit in the valid count range they are added up to the range limit, and the rest are kept pending to be added by the next polls, together with the new pulses, see getPendingUnits().  
+    * 
+    * @return The success in adding the accumulated pulses to the count.
+    * @retval true There were no pulses accumulated, or all of them, including the ones pending from previous polls, were added to the count.
+    * @retval false There's no pulse source associated, or some units didn't fit in the valid count range and are kept pending.
+    */
+   bool pollPulseSource();
+   /**
+    * @brief Pushes the current count value to the display if a deferred refresh is pending. 
+    * 
+    * When the object is set to the deferred refresh mode (see setDeferredRefresh(const bool &)) the counting methods don't print to the display, they just flag the display as outdated. This method is the caller-driven way to bring the display up to date: it prints the latest count value only if the display was flagged AND the value to show is different from the one already shown. Any number of count modifications between two pumpDisplay() calls are collapsed in one display print.  
+    * 
+    * @return The success in updating the display.
+    * @retval true The display was updated, or there was no need to update it (no pending refresh, same value already displayed or no display associated).
+    * @retval false The display print failed.
+    */
+   bool pumpDisplay();
+   /**
+    * @brief Removes a watchpoint from the object.
+    * 
+    * @param wpType Type of the watchpoint to remove.
+    * @param wpVal Count value watched by the watchpoint to remove. Ignored for the ccWpMinHit and ccWpMaxHit watchpoint types.
+    * @param fnPtr Function associated to the watchpoint to remove.
+    * 
+    * @retval true A watchpoint with the provided parameters was found and removed.
+    * @retval false No watchpoint with the provided parameters was found.
+    */
+   bool removeWatchpoint(const ccWpType_t &wpType, const int32_t &wpVal, fncVdPtrPrmPtrType fnPtr);
    /**
     * @brief Changes the time parameters to use for the display blinking of the contents it shows.  
     * 
@@ -353,6 +1042,275 @@ public:
     * @endcode
     */
    bool setBlinkRate(const unsigned long &newOnRate, const unsigned long &newOffRate = 0);
+   /**
+    * @brief Sets the counter that receives the carries generated by the object in rollover mode.
+    * 
+    * Linking counters by their carries builds a cascade, as the wheels of a mechanical odometer, with optionally one display per stage. Each carry generated by a stage is added to (or subtracted from, when wrapping past the minimum) the count of the next higher order stage, which might be in rollover mode itself and have it's own carry counter. The count modification of a stage and the carries propagation through all the higher order stages are made as a single operation inside a critical section shared by all the stages of the cascade, so no other count modification of any stage can be interleaved. If the highest order stage is not in rollover mode and can't accept the carries the whole operation fails, and no stage is modified.  
+    * The count modifications of the stages made by count restarts and countToZero(const int32_t &) never wrap nor generate carries, the counting operations of apply(const ccBatchOp_t*, const size_t &, bool*) and applyAsync() do.  
+    * A counter receives the carries of a single lower order stage: a cascade is a chain, not a tree.  
+    * 
+    * @param carryCntrPtr Pointer to the next higher order ClickCounter object. A nullptr value removes the current link.
+    * 
+    * @return The success in setting the carry counter.
+    * @retval true The object was not begun, and the carry counter was set.
+    * @retval false The object was already begun, the carry counter would build a closed loop of counters, the carry counter already receives the carries of another counter, or the cascade would exceed 8 stages.
+    */
+   bool setCarryCounter(ClickCounter* carryCntrPtr);
+   /**
+    * @brief Sets the function to be executed when the count value reaches 0 (zero).
+    * 
+    * The function is managed as a ccWpReached watchpoint of value 0, see addWatchpoint(const ccWpType_t &, const int32_t &, fncVdPtrPrmPtrType, void*). Setting a new function replaces the previously set one.
+    * 
+    * @param newFnWhnCntValZero Function to execute, a nullptr value removes the previously set function.
+    * @param argPtr (Optional) Argument to pass to the function when executed. If not provided a nullptr will be passed.
+    * 
+    * @return The success in setting the function.
+    * @retval true The function was set or removed.
+    * @retval false The memory needed to keep the function watchpoint couldn't be allocated.
+    */
+   bool setFnWhnCntValZeroPtr(fncVdPtrPrmPtrType newFnWhnCntValZero, void* argPtr = nullptr);
+   /**
+    * @brief Sets the associated display to show the counting rate instead of the count value.
+    * 
+    * The value displayed is the one returned by getRate(), limited to the getMaxCountVal() value. As the rate changes with time even when the count doesn't, the display is updated: 
+    * - By the refresh task, if running, at least once per rate statistics time bucket.  
+    * - By each pumpDisplay() call, if the rate value changed.  
+    * - By each successful count modification, as when displaying the count value.  
+    * 
+    * @param dspRate Indicates if the display must show the counting rate (true) or the count value (false).
+    * 
+    * @return The success in setting the display mode.
+    * @retval true The display mode was set.
+    * @retval false The counting rate display was requested but the rate statistics are not enabled, or the display update failed.
+    */
+   bool setDisplayRate(const bool &dspRate);
+   /**
+    * @brief Sets the format used to render the count in the associated display.
+    * 
+    * With the default ccFmtCount format the count range is limited to the values the display can show. With any other format the count range is not taken from the display but set to the complete int32_t range, and the display renders the total (see getTotal()) in the selected format. To keep counting past the int32_t range the rollover mode must be set, see setRollover(const bool &).  
+    * The range of totals rendered with the same displayed digits is calculated when the rendering changes, so the count modifications that don't change the displayed digits cost a pair of comparisons and no display print. The storage of the texts printed is reserved by this method, so the rendering changes need no heap memory while counting.  
+    * 
+    * @param dspFmt Format to render the count, one of the ccDspFmt_t values.
+    * @param pageMs (Optional) Time, in milliseconds, each page is shown in the ccFmtPages format. The pages are switched by the refresh task if running (see startRefreshTask(const uint32_t &, const UBaseType_t &)), or by the pumpDisplay() calls. If not provided a value of 1000 will be used.
+    * 
+    * @return The success in setting the display format.
+    * @retval true The object was not begun, the format was set.
+    * @retval false The object was already begun, the format can't be changed while the counter is active. To change it an end() must be executed first.
+    */
+   bool setDisplayFormat(const ccDspFmt_t &dspFmt, const uint32_t &pageMs = 1000);
+   /**
+    * @brief Sets the display refresh mode of the object.
+    * 
+    * In the default (immediate) refresh mode every successful count modification prints the new value to the associated display before the counting method returns, making every counting call pay for a complete display bus transaction.  
+    * In the deferred refresh mode the counting methods just flag the display as outdated and return. The display is then updated by the refresh task (see startRefreshTask(const uint32_t &, const UBaseType_t &)) or by the application calling pumpDisplay(), collapsing bursts of count modifications into a single display print.  
+    * 
+    * @param deferred Indicates if the display refresh must be deferred (true) or immediate (false). When changing to immediate mode any pending refresh is executed before returning.  
+    * 
+    * @return The success in setting the refresh mode.
+    * @retval true The mode was set, and any pending refresh needed was successfuly done.
+    * @retval false The pending refresh execution failed.
+    */
+   bool setDeferredRefresh(const bool &deferred);
+   /**
+    * @brief Associates an instrumentation data block to the object.
+    * 
+    * The instrumentation data, see getInstrSnapshot(ccInstrSnap_t &, const bool &), is collected in a block provided by the application, so only the counters being analyzed carry it. The association must be set before the object is begun.  
+    * 
+    * @param instrPtr Pointer to the ccInstrData_t block, that must exist while it's associated. A nullptr value removes the current association.
+    * 
+    * @retval true The library was built with the CC_INSTR_ENABLED flag set to 1, the object was not begun and the association was set or removed.
+    * @retval false One of the previously described conditions failed, the association was not modified.
+    */
+   bool setInstrumentation(ccInstrData_t* instrPtr);
+   /**
+    * @brief Associates an event journal to the object.
+    * 
+    * Every successful count modification made after the association, including the ones made from ISRs, will be registered in the journal, see ClickEventJournal. A single journal might be shared by several ClickCounter objects. Registering a record is a lock-free operation that never blocks the counting method, if the journal is full the record is discarded and counted as lost.  
+    * 
+    * @param jrnlPtr Pointer to an instantiated ClickEventJournal object. A nullptr value removes the current association.
+    * 
+    * @return true
+    */
+   bool setJournal(ClickEventJournal* jrnlPtr);
+   /**
+    * @brief Enables, configures or disables the counting rate statistics.
+    * 
+    * The rate statistics are kept incrementally by each successful count modification: the clicks are accumulated in the current time bucket of **bcktMs** milliseconds, and when a bucket is completed it's added to a sliding window of the last 10 buckets, to the EWMA and to the peak rate calculation. The counting methods only add the clicks to the current bucket, with integer arithmetic, the rest of the calculations are done once per bucket, and the rate reading methods cost a constant time.  
+    * Any previously registered statistics are cleared.  
+    * 
+    * @param bcktMs Time bucket duration in milliseconds. The sliding window covers 10 buckets, so a value of 1000 gives the rate over the last 10 seconds, a value of 6000 gives the rate over the last minute. The value must be an exact divisor of 60000. A value of 0 disables the rate statistics.
+    * @param ewmaShft (Optional) Smoothing factor of the EWMA, each new bucket rate has a weight of 1/2^ewmaShft. The valid range is 1 <= ewmaShft <= 15. If not provided a value of 3 (a weight of 1/8) will be used.  
+    * 
+    * @return The success in setting the rate statistics.
+    * @retval true The parameters were valid, the rate statistics are set.
+    * @retval false The bcktMs value is not an exact divisor of 60000, or the ewmaShft value is out of range. No change is made.
+    */
+   bool setRateStats(const uint32_t &bcktMs, const uint8_t &ewmaShft = 3);
+   /**
+    * @brief Sets the counting concurrency mode of the object.
+    * 
+    * In the default mode every count related method takes the object's mutex, modifies or reads the count value and, if a display is associated, updates the display before releasing the mutex. Any task reading or modifying the count must wait for the current holder to finish its display update.  
+    * In the lock-free mode the count value is kept and modified by atomic compare-and-swap operations, with the same range validations as the default mode. Reading and modifying tasks never block each other, only the display refresh stays serialized by the object's mutex. The display refresh always prints the latest count value, so concurrent modifications might be shown as a single display update.  
+    * 
+    * @param lockFree Indicates if the object must work in lock-free mode (true) or in the mutex protected mode (false).
+    * 
+    * @return The success in setting the counting concurrency mode.
+    * @retval true The object was not begun, the mode is set.
+    * @retval false The object was already begun, the mode can't be changed while the counter is active. To change it an end() must be executed first.
+    */
+   bool setLockFree(const bool &lockFree);
+   /**
+    * @brief Sets the ratio of the object's pulses scaler. 
+    * 
+    * The scaler converts the raw pulses counted by countPulses(const int32_t &), countPulsesFromISR(const int32_t &, BaseType_t*) and pollPulseSource() to count units: each pulsesQty pulses are counted as unitsQty units. The ratio is applied in integer arithmetic, as an exact fraction, with no floating point operations and no accumulated rounding error: the fraction of a unit not reached is kept and carried to the next pulses. The remainder is cleared by the count restarts.  
+    * Use examples:  
+    * - A 60 teeth gear counting revolutions: setScaler(60), a divide by 60 prescaler.  
+    * - A flowmeter of 450 pulses per litre counting decilitres: setScaler(45), or setScaler(450, 10).  
+    * - An encoder of 2.5 pulses per millimetre counting millimetres: setScaler(5, 2).  
+    * 
+    * @param pulsesQty Quantity of raw pulses, must be greater than 0.  
+    * @param unitsQty (Optional) Quantity of count units corresponding to pulsesQty pulses, must be greater than 0. If not provided a value of 1 will be used.  
+    * 
+    * @return The success in setting the scaler ratio.
+    * @retval true The object was not begun and both parameters were greater than 0, the ratio is set. A ratio of 1 unit per pulse disables the scaler.
+    * @retval false The object was already begun, or one of the parameters was equal to 0. The ratio was not modified.
+    */
+   bool setScaler(const uint32_t &pulsesQty, const uint32_t &unitsQty = 1);
+   /**
+    * @brief Sets the count overflow mode of the object.
+    * 
+    * In the default mode a counting operation that would get the count out of the valid range fails, and the count keeps it's value.  
+    * In the rollover mode the count wraps within the valid range, as a mechanical odometer does: counting up past the maximum valid value continues from the minimum valid value, counting down past the minimum valid value continues from the maximum valid value. Each wrap generates a carry, see getCarryQty(const bool &) and setCarryCounter(ClickCounter*). Quantities spanning several wraps are resolved in a single step.  
+    * The rollover mode applies to the countUp(), countDown() and their FromISR versions, including the counts added by pollPulseSource().  
+    * 
+    * @param rollover Indicates if the object must work in rollover mode (true) or in the default mode (false).
+    * 
+    * @return The success in setting the overflow mode.
+    * @retval true The object was not begun, the mode is set.
+    * @retval false The object was already begun, the mode can't be changed while the counter is active. To change it an end() must be executed first.
+    */
+   bool setRollover(const bool &rollover);
+   /**
+    * @brief Associates a persistence object to keep the total count in a non volatile storage.
+    * 
+    * When the object is started the last total count committed to the storage is restored, replacing the startVal parameter of begin(const int32_t &), and the persistence commit task is started (see ClickCountPersist). If the storage holds no valid total (i.e. it was never used) the startVal parameter is used. If the restored total is out of the valid range and the rollover mode is not set begin(const int32_t &) fails and the object is not started: the total is never silently replaced. Remove the association, or set a range or mode that fits the total, before invoking begin(const int32_t &) again.  
+    * Every successful count modification after the object is started, including the ones made from ISRs, is registered in the persistence object by a lock-free operation, the counting methods never wait for the storage. When the object is ended the pending modifications are committed before the commit task is stopped.  
+    * 
+    * @param prstPtr Pointer to an instantiated ClickCountPersist object, it must be associated to a single ClickCounter object. A nullptr value removes the current association.
+    * 
+    * @return The success in associating the persistence object.
+    * @retval true The object was not begun yet, the association was set or removed.
+    * @retval false The object was already begun, the association was not modified.
+    * 
+    * @note To persist a count beyond the int32_t range, or the display range, set the rollover mode (see setRollover(const bool &)): the total count, including the rollover carries, is the value persisted and restored.
+    */
+   bool setPersistence(ClickCountPersist* prstPtr);
+   /**
+    * @brief Associates a telemetry encoder channel to the object.
+    * 
+    * The object's count is bound to the channel, and every count modification made after the association, including the ones made from ISRs, marks the channel as changed by a lock-free operation, so the next frame built by the encoder includes the new count value, see ClickTelemetryEncoder. A single encoder might be shared by several ClickCounter objects, each one bound to a different channel.  
+    * 
+    * @param tlmPtr Pointer to an instantiated ClickTelemetryEncoder object. A nullptr value removes the current association, unbinding the channel.
+    * @param chnl (Optional) Number of the encoder channel to bind the count to. If not provided the channel 0 will be used.
+    * 
+    * @return The success in associating the telemetry encoder.
+    * @retval true The object was not begun yet, the channel exists and the association was set or removed.
+    * @retval false The object was already begun, or the channel doesn't exist in the encoder. The association was not modified.
+    * 
+    * @note The encoder must exist while it's associated, and it must not be building a frame while the association is set or removed, including by the object destruction.
+    */
+   bool setTelemetry(ClickTelemetryEncoder* tlmPtr, const size_t &chnl = 0);
+   /**
+    * @brief Associates a pulse source to the object.
+    * 
+    * The pulse source will be read by each pollPulseSource() call. Any pulses accumulated in the source before the association will be added to the count in the first poll.  
+    * 
+    * @param pulseSrcPtr Pointer to an instantiated ClickPulseSource subclass object (PcntPulseSource, SimPulseSource, or user defined subclasses). A nullptr value removes the current association.
+    * 
+    * @return true
+    */
+   bool setPulseSource(ClickPulseSource* pulseSrcPtr);
+   /**
+    * @brief Returns a consistent snapshot of the counter state.
+    * 
+    * The count, the valid range limits, the start value and the begun state are read as a single consistent set, so a snapshot never mixes values from before and after a begin() or end() execution. The configuration members are guarded by a sequence lock: the reader retries the reading if they were modified meanwhile, instead of taking the object's mutex, so any quantity of tasks might read snapshots at any rate without delaying the counting methods, and the counting methods never delay the readers. The method might be invoked from ISRs.  
+    * 
+    * @return The snapshot of the counter state.
+    * 
+    * Use example:  
+    * @code {.cpp}
+    * ccCntSnap_t cntSnap{myClickCounter.snapshot()};
+    * if(cntSnap.begun)
+    *    Serial.printf("%ld of %ld\n", cntSnap.count, cntSnap.countMax);
+    * @endcode
+    */
+   ccCntSnap_t snapshot();
+   /**
+    * @brief Starts the task that applies the operations posted by applyAsync(const ccBatchOp_t &, ccAsyncRslt_t*, const TickType_t &), countUpAsync() and countDownAsync().
+    * 
+    * The task sleeps until an operation is queued, then takes all the queued operations (up to 32 in a drain) and applies them as a single batch. The more the posting tasks overload the counter, the more operations are folded in each drain, so the mutex taking and display printing costs don't grow with the posting rate.  
+    * 
+    * @param queueLen (Optional) Maximum quantity of operations waiting to be applied. When the queue is full new operations are rejected, see getAsyncStats(ccAsyncStats_t &, const bool &). If not provided a value of 32 will be used.  
+    * @param tskPrrty (Optional) Priority level given to the asynchronous task. If not provided a value of 2 will be used.  
+    * 
+    * @return The success in starting the asynchronous task.
+    * @retval true The task was created.
+    * @retval false The task was already running, the queueLen parameter was 0, or the task or queue creation failed.
+    */
+   bool startAsyncTask(const UBaseType_t &queueLen = 32, const UBaseType_t &tskPrrty = 2);
+   /**
+    * @brief Starts the task that executes the functions of the triggered watchpoints.
+    * 
+    * The triggered watchpoints functions are queued by the counting methods, and executed in order by this task. A function taking long to execute delays the execution of the next queued functions but never the counting.  
+    * 
+    * @param queueLen (Optional) Maximum quantity of functions waiting to be executed. When the queue is full the functions of new triggered watchpoints are lost, see getWatchpointLostQty(const bool &). If not provided a value of 16 will be used.  
+    * @param tskPrrty (Optional) Priority level given to the dispatcher task. If not provided a value of 1 will be used.  
+    * 
+    * @return The success in starting the dispatcher task.
+    * @retval true The task was created.
+    * @retval false The task was already running, the queueLen parameter was 0, or the task or queue creation failed.
+    */
+   bool startDispatchTask(const UBaseType_t &queueLen = 16, const UBaseType_t &tskPrrty = 1);
+   /**
+    * @brief Starts a background task to keep the display updated in deferred refresh mode.
+    * 
+    * The task sets the object in deferred refresh mode, sleeps until a count modification flags the display as outdated, prints the latest count value and then stays idle for a frame period before attending the next request. Count modifications made during that period are collapsed in a single print, so the display is never printed more than **maxFps** times per second, and it's not printed at all if the value to show didn't change.  
+    * 
+    * @param maxFps (Optional) Maximum display refreshes per second. If not provided a value of 25 will be used. 
+    * @param tskPrrty (Optional) Priority level given to the refresh task. If not provided a value of 1 will be used.  
+    * 
+    * @return The success in starting the refresh task.
+    * @retval true The task was created and the object set to the deferred refresh mode.  
+    * @retval false The task was already running, the maxFps parameter was 0, or the task creation failed.
+    */
+   bool startRefreshTask(const uint32_t &maxFps = 25, const UBaseType_t &tskPrrty = 1);
+   /**
+    * @brief Stops the asynchronous task started by startAsyncTask(const UBaseType_t &, const UBaseType_t &).
+    * 
+    * The operations already queued are applied before the task is stopped, the operations posted after the method is invoked are rejected.
+    * 
+    * @retval true The asynchronous task was running and it was stopped.
+    * @retval false There was no asynchronous task running.
+    */
+   bool stopAsyncTask();
+   /**
+    * @brief Stops the watchpoints dispatcher task started by startDispatchTask(const UBaseType_t &, const UBaseType_t &).
+    * 
+    * The functions already queued are executed before the task is stopped.
+    * 
+    * @retval true The dispatcher task was running and it was stopped.
+    * @retval false There was no dispatcher task running.
+    */
+   bool stopDispatchTask();
+   /**
+    * @brief Stops the display refresh task started by startRefreshTask(const uint32_t &, const UBaseType_t &).
+    * 
+    * The object is kept in deferred refresh mode, so the display will only be updated by pumpDisplay() calls until a setDeferredRefresh(false) is executed.  
+    * 
+    * @retval true The refresh task was running and it was stopped.
+    * @retval false There was no refresh task running.
+    */
+   bool stopRefreshTask();
    /**
     * @brief Updates the SevenSegDisplays object associated to the ClickCounter with the current object's count value.
     * 
@@ -361,6 +1319,48 @@ public:
     * @retval false The SevenSegDisplays object associated to the ClickCounter failed updating it's display. 
     */
    bool updDisplay();
+   /**
+    * @brief Blocks the calling task until the count is modified.
+    * 
+    * The task waits in the Blocked state, consuming no CPU time, and is woken by the counting method (including the ones invoked from ISRs) that modifies the count. Up to 24 tasks might be waiting at the same time, in this method and in waitUntil(fncBlnCntPrmPtrType, void*, const TickType_t &): each one waits on its own event group bit, and all of them are woken by the same modification. The counting methods only check an atomic mask of waiting tasks, so the feature adds no cost to the counting while no task is waiting.  
+    * 
+    * @param tmOut (Optional) Maximum time to wait, in ticks. If not provided the task will wait indefinitely.  
+    * 
+    * @retval true The count was modified after the method was invoked.
+    * @retval false The time out expired with no count modification, the method was invoked from an ISR, the synchronization object couldn't be created, or 24 tasks were already waiting for changes.
+    * 
+    * @note Count restarts to the current count value are not considered modifications.  
+    */
+   bool waitForChange(const TickType_t &tmOut = portMAX_DELAY);
+   /**
+    * @brief Blocks the calling task until the count meets a watchpoint condition.
+    * 
+    * The calling task is registered as a watchpoint with no function, so the counting methods check it with the rest of the watchpoints, in a logarithmic time on the quantity of watchpoints and waiting tasks, and wake it directly with a task notification when the condition is met. The task waits in the Blocked state, consuming no CPU time, and no dispatcher task is needed.  
+    * If the count already meets the condition when the method is invoked the method returns immediately. As the count is checked as a level in that case, the ccWpCrossUp condition is considered met when the count is equal or greater than the **wpVal**, and the ccWpCrossDown condition when the count is equal or less than the **wpVal**.  
+    * 
+    * @param wpType Type of the condition, one of the ccWpType_t values, as described for addWatchpoint(const ccWpType_t &, const int32_t &, fncVdPtrPrmPtrType, void*).  
+    * @param wpVal Count value watched. Ignored for the ccWpMinHit and ccWpMaxHit types.  
+    * @param tmOut (Optional) Maximum time to wait, in ticks. If not provided the task will wait indefinitely.  
+    * 
+    * @retval true The condition was met.
+    * @retval false The time out expired before the condition was met, the method was invoked from an ISR, or the memory needed to register the waiting task couldn't be allocated.
+    * 
+    * @note The task is woken by setting the bit 31 of its notification value, the calling task must not use that bit for other purposes.  
+    */
+   bool waitUntil(const ccWpType_t &wpType, const int32_t &wpVal, const TickType_t &tmOut = portMAX_DELAY);
+   /**
+    * @brief Blocks the calling task until the count satisfies a predicate.
+    * 
+    * The predicate is evaluated by the waiting task, never by the counting methods: it's evaluated when the method is invoked, and then each time the task is woken by a count modification as in waitForChange(const TickType_t &). Count values held for a very short time might not be evaluated if the waiting task is not executed before the next modification, use waitUntil(const ccWpType_t &, const int32_t &, const TickType_t &) to wait for conditions that must not be missed.  
+    * 
+    * @param predFn Function evaluating the condition. It receives the current count value and the **argPtr** argument, and returns true when the condition is satisfied.  
+    * @param argPtr (Optional) Argument to pass to the predFn function. If not provided a nullptr will be passed.  
+    * @param tmOut (Optional) Maximum time to wait, in ticks. If not provided the task will wait indefinitely.  
+    * 
+    * @retval true The predicate was satisfied.
+    * @retval false The time out expired before the predicate was satisfied, the predFn parameter was nullptr, the method was invoked from an ISR, the synchronization object couldn't be created, or 24 tasks were already waiting for changes.
+    */
+   bool waitUntil(fncBlnCntPrmPtrType predFn, void* argPtr = nullptr, const TickType_t &tmOut = portMAX_DELAY);
 };
    
 #endif   // _CLICKCOUNTER_ESP32_H_
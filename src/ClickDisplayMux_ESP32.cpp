@@ -0,0 +1,208 @@
+/**
+ ******************************************************************************
+ * @file ClickDisplayMux_Esp32.cpp
+ *
+ * @brief Code file for the ClickDisplayMux class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickDisplayMux class shares a single SevenSegDisplays object among several ClickCounter objects, showing one counter at a time and paging between them.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <ClickDisplayMux_Esp32.h>
+#include <ClickCounter_Esp32.h>
+
+ClickDisplayMux::ClickDisplayMux(SevenSegDisplays* dsplyPtr, const uint32_t &dwellMs, const bool &lblShow, const uint32_t &pollMs)
+:_dsplyPtr{dsplyPtr}, _lblShow{lblShow}
+{
+   int64_t pow{1};
+
+   if(_dsplyPtr != nullptr){
+      while(pow <= _dsplyPtr->getDspValMax()){
+         _dspDgts++;
+         pow *= 10;
+      }
+   }
+   _dwellTcks = pdMS_TO_TICKS(dwellMs);
+   if((dwellMs > 0) && (_dwellTcks == 0))
+      _dwellTcks = 1;
+   _pollTcks = pdMS_TO_TICKS(pollMs);
+   if(_pollTcks == 0)
+      _pollTcks = 1;
+   _prntTxt.reserve(_txtSz);
+}
+
+ClickDisplayMux::~ClickDisplayMux()
+{
+   end();
+}
+
+bool ClickDisplayMux::addCounter(ClickCounter* cntrPtr, const char &lbl){
+   bool result{false};
+
+   if((_muxTskHndl.load() == nullptr) && (cntrPtr != nullptr) && (_pagesQty < _pagesMax)){
+      _pagesArr[_pagesQty].cntrPtr = cntrPtr;
+      _pagesArr[_pagesQty].lbl = (lbl != '\0')?(lbl):("0123456789ABCDEF"[_pagesQty]);
+      _pagesQty++;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ClickDisplayMux::begin(const UBaseType_t &tskPrrty){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   if((_muxTskHndl.load() == nullptr) && (_dsplyPtr != nullptr) && (_pagesQty > 0)){
+      _muxTskStop.store(false);
+      if(xTaskCreate(_muxTsk, "CCDspMuxTsk", _muxTskStckSz, this, tskPrrty, &tskHndl) == pdPASS){
+         _muxTskHndl.store(tskHndl);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ClickDisplayMux::end(){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   _muxTskUsrs.fetch_add(1);
+   tskHndl = _muxTskHndl.load();
+   if(tskHndl != nullptr){
+      _muxTskStop.store(true);
+      xTaskNotifyGive(tskHndl);
+   }
+   _muxTskUsrs.fetch_sub(1);
+   if(tskHndl != nullptr){
+      while(_muxTskStop.load())   // Cleared by the task as its last access to the object
+         vTaskDelay(1);
+      result = true;
+   }
+
+   return result;
+}
+
+uint8_t ClickDisplayMux::getCurPage(){
+
+   return _curPg.load();
+}
+
+uint8_t ClickDisplayMux::getPagesQty(){
+
+   return _pagesQty;
+}
+
+bool ClickDisplayMux::showPage(const uint8_t &page){
+   bool result{false};
+   TaskHandle_t tskHndl{nullptr};
+
+   _muxTskUsrs.fetch_add(1);
+   tskHndl = _muxTskHndl.load();
+   if((tskHndl != nullptr) && (page < _pagesQty)){
+      _rqstPg.store(page);
+      xTaskNotifyGive(tskHndl);
+      result = true;
+   }
+   _muxTskUsrs.fetch_sub(1);
+
+   return result;
+}
+
+void ClickDisplayMux::_muxTsk(void* argp){
+   ClickDisplayMux* muxPtr = static_cast<ClickDisplayMux*>(argp);
+   ClickCounter* cntrPtr{nullptr};
+   uint8_t page{0};
+   uint8_t ttlPg{0};
+   int16_t rqstPg{-1};
+   TickType_t flipTck{xTaskGetTickCount()};
+   TickType_t ttlPgTck{flipTck};
+   TickType_t ttlPgTcks{0};
+   TickType_t curTck{0};
+   TickType_t wtTcks{0};
+   bool shown{false};
+
+   muxPtr->_curPg.store(0);
+   for(;;){
+      curTck = xTaskGetTickCount();
+      rqstPg = muxPtr->_rqstPg.exchange(-1);
+      if(rqstPg >= 0){
+         page = static_cast<uint8_t>(rqstPg);
+         flipTck = curTck;
+         shown = false;
+      }
+      else if((muxPtr->_dwellTcks != 0) && ((curTck - flipTck) >= muxPtr->_dwellTcks)){
+         page = (page + 1) % muxPtr->_pagesQty;
+         flipTck = curTck;
+         shown = false;
+      }
+      muxPtr->_curPg.store(page);
+      cntrPtr = muxPtr->_pagesArr[page].cntrPtr;
+      ttlPgTcks = 0;
+      if(cntrPtr->getDisplayFormat() == ccFmtPages){   // The pages of the total alternate, starting with the low order page each time the counter is shown
+         ttlPgTcks = pdMS_TO_TICKS(cntrPtr->getDisplayPageMs());
+         if(ttlPgTcks == 0)
+            ttlPgTcks = 1;
+         if(!shown){
+            ttlPg = 0;
+            ttlPgTck = curTck;
+         }
+         else if((curTck - ttlPgTck) >= ttlPgTcks){
+            ttlPg ^= 1;
+            ttlPgTck = curTck;
+         }
+      }
+      shown = muxPtr->_prntPg(page, ttlPg, shown);   // A failed print is retried in the next check
+      curTck = xTaskGetTickCount();
+      wtTcks = muxPtr->_pollTcks;
+      if((muxPtr->_dwellTcks != 0) && ((flipTck + muxPtr->_dwellTcks - curTck) < wtTcks))
+         wtTcks = flipTck + muxPtr->_dwellTcks - curTck;
+      if((ttlPgTcks != 0) && ((ttlPgTck + ttlPgTcks - curTck) < wtTcks))
+         wtTcks = ttlPgTck + ttlPgTcks - curTck;
+      ulTaskNotifyTake(pdTRUE, wtTcks);
+      if(muxPtr->_muxTskStop.load())
+         break;
+   }
+   muxPtr->_muxTskHndl.store(nullptr);
+   while(muxPtr->_muxTskUsrs.load() != 0)   // showPage() callers that read the handle before it was cleared finish notifying the task
+      vTaskDelay(1);
+   muxPtr->_muxTskStop.store(false);   // The last access to the object, end() returns after it
+   vTaskDelete(NULL);
+}
+
+bool ClickDisplayMux::_prntPg(const uint8_t &page, const uint8_t &ttlPg, const bool &shown){
+   bool result{shown};
+   char dspTxt[_txtSz]{};
+   uint8_t valDgts{_dspDgts};
+   size_t txtLen{0};
+
+   if(_lblShow && (valDgts > 0)){
+      dspTxt[txtLen++] = _pagesArr[page].lbl;
+      valDgts--;
+   }
+   _pagesArr[page].cntrPtr->getDisplayText(dspTxt + txtLen, sizeof(dspTxt) - txtLen, valDgts, ttlPg);   // Rendered by the counter, as it would show the value in its own display
+   if(!shown || (strcmp(dspTxt, _lastTxt) != 0)){
+      _prntTxt = dspTxt;   // Copied to the reserved storage, no String is built for each print
+      result = _dsplyPtr->print(_prntTxt);
+      if(result)
+         strcpy(_lastTxt, dspTxt);
+   }
+
+   return result;
+}
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file ClickDisplayMux_Esp32.h
+ *
+ * @brief Header file for the ClickDisplayMux class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickDisplayMux class shares a single SevenSegDisplays object among several ClickCounter objects, showing one counter at a time and paging between them. The display is printed only by the multiplexer task, so the counting methods of the counters never wait for the display bus.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKDISPLAYMUX_ESP32_H_
+#define _CLICKDISPLAYMUX_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+#include <SevenSegDisplays.h>
+
+class ClickCounter;
+
+/**
+ * @class ClickDisplayMux
+ *
+ * @brief Models a display scheduler that time-slices a SevenSegDisplays object among several counters.
+ *
+ * Each counter added is a page of the multiplexer. A task shows each page for the dwell time and then moves to the next one, and checks the shown counter periodically, printing the display only when a new page is shown or the shown text changed. The counts are read by ClickCounter::snapshot() and ClickCounter::getTotal(), that never take the counter mutex, so the multiplexer never delays the counting methods, and the counters never wait for the display.
+ *
+ * Each counter is shown in its own display format, see ClickCounter::setDisplayFormat(): the count value, or the total as a low order window, scaled, or split in pages shown alternately for the counter page time. A value that doesn't fit in the digits available is shown as dashes.
+ *
+ * Optionally the leftmost digit of the display shows a label identifying the page shown, by default the page index as a hexadecimal digit. The value is then shown right aligned in the rest of the digits.
+ *
+ * @note The counters added must be built without a display, the multiplexer is the only object printing to its display.
+ */
+class ClickDisplayMux{
+private:
+   struct ccMuxPage_t{
+      ClickCounter* cntrPtr;
+      char lbl;
+   };
+   static const uint8_t _pagesMax{16};
+   static const uint8_t _txtSz{24};
+   static const uint32_t _muxTskStckSz{4096};
+
+   SevenSegDisplays* _dsplyPtr{nullptr};
+   ccMuxPage_t _pagesArr[_pagesMax]{};
+   uint8_t _pagesQty{0};
+   bool _lblShow{false};
+   uint8_t _dspDgts{0};
+   TickType_t _dwellTcks{0};
+   TickType_t _pollTcks{1};
+   std::atomic<uint8_t> _curPg{0};
+   std::atomic<int16_t> _rqstPg{-1};
+   std::atomic<TaskHandle_t> _muxTskHndl{nullptr};
+   std::atomic<uint32_t> _muxTskUsrs{0};   // showPage() callers between reading _muxTskHndl and notifying the task, the task waits for them before ending
+   std::atomic<bool> _muxTskStop{false};
+   char _lastTxt[_txtSz]{};
+   String _prntTxt{};   // Reused by every text print, so printing needs no heap memory once the capacity is reserved
+
+   static void _muxTsk(void* argp);
+   bool _prntPg(const uint8_t &page, const uint8_t &ttlPg, const bool &shown);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param dsplyPtr Pointer to the instantiated SevenSegDisplays object to share among the counters.
+    * @param dwellMs (Optional) Time each page is shown before moving to the next one, in milliseconds. A value of 0 disables the automatic paging, the pages are then selected only by showPage(const uint8_t &). If not provided a value of 2000 will be used.
+    * @param lblShow (Optional) Indicates if the leftmost digit of the display must show the page label. If not provided the label will not be shown.
+    * @param pollMs (Optional) Period of the shown counter value checks, in milliseconds, the maximum time a count modification waits to be shown. If not provided a value of 50 will be used.
+    */
+   ClickDisplayMux(SevenSegDisplays* dsplyPtr, const uint32_t &dwellMs = 2000, const bool &lblShow = false, const uint32_t &pollMs = 50);
+   /**
+    * @brief Class destructor.
+    *
+    * Stops the multiplexer task, if running.
+    */
+   ~ClickDisplayMux();
+   /**
+    * @brief Adds a counter as the next page of the multiplexer.
+    *
+    * The counters must be added before the multiplexer is started.
+    *
+    * @param cntrPtr Pointer to the ClickCounter object to add, it must have no display associated.
+    * @param lbl (Optional) Character shown as the page label if the labels are shown, it must be a character the display can show. If not provided, or '\0', the page index is shown as a hexadecimal digit.
+    *
+    * @retval true The multiplexer was not started, the cntrPtr parameter was not nullptr and there was room for another page. The counter was added.
+    * @retval false One of the previously described conditions failed, the counter was not added.
+    */
+   bool addCounter(ClickCounter* cntrPtr, const char &lbl = '\0');
+   /**
+    * @brief Starts the multiplexer task.
+    *
+    * The first page is shown immediately.
+    *
+    * @param tskPrrty (Optional) Priority level given to the multiplexer task. If not provided a value of 1 will be used.
+    *
+    * @retval true The task was created.
+    * @retval false The task was already running, no display was provided, no counter was added, or the task creation failed.
+    */
+   bool begin(const UBaseType_t &tskPrrty = 1);
+   /**
+    * @brief Stops the multiplexer task.
+    *
+    * The display keeps the last value printed. The caller is blocked until the task is stopped.
+    *
+    * @retval true The task was running and it was stopped.
+    * @retval false The task was not running.
+    */
+   bool end();
+   /**
+    * @brief Returns the page currently shown.
+    *
+    * @return The index of the page shown, the counters are numbered from 0 in the order they were added.
+    */
+   uint8_t getCurPage();
+   /**
+    * @brief Returns the quantity of pages of the multiplexer.
+    *
+    * @return The quantity of counters added.
+    */
+   uint8_t getPagesQty();
+   /**
+    * @brief Shows a page immediately.
+    *
+    * The page is shown for a complete dwell time, then the automatic paging continues from it.
+    *
+    * @param page Index of the page to show.
+    *
+    * @retval true The multiplexer is running and the page exists, the task was notified to show it.
+    * @retval false One of the previously described conditions failed.
+    */
+   bool showPage(const uint8_t &page);
+};
+
+#endif   // _CLICKDISPLAYMUX_ESP32_H_
@@ -0,0 +1,141 @@
+/**
+ ******************************************************************************
+ * @file ClickEventJournal_Esp32.cpp
+ *
+ * @brief Code file for the ClickEventJournal class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickEventJournal class models a lock-free, fixed capacity journal of count change events.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <new>
+#include <ClickEventJournal_Esp32.h>
+
+ClickEventJournal::ClickEventJournal(ccJrnlSlot_t* slotsPtr, const size_t &slotsQty)
+:_slotsPtr{slotsPtr}
+{
+   size_t pwrOf2{1};
+
+   if((_slotsPtr != nullptr) && (slotsQty > 0)){
+      while((pwrOf2 << 1) <= slotsQty)
+         pwrOf2 <<= 1;
+      _initSlots(pwrOf2);
+   }
+}
+
+ClickEventJournal::ClickEventJournal(const size_t &slotsQty)
+{
+   size_t pwrOf2{1};
+
+   if(slotsQty > 0){
+      while(pwrOf2 < slotsQty)
+         pwrOf2 <<= 1;
+      _slotsPtr = new(std::nothrow) ccJrnlSlot_t[pwrOf2];
+      if(_slotsPtr != nullptr){
+         _ownSlots = true;
+         _initSlots(pwrOf2);
+      }
+   }
+}
+
+ClickEventJournal::~ClickEventJournal()
+{
+   if(_ownSlots)
+      delete [] _slotsPtr;
+}
+
+size_t ClickEventJournal::getCapacity(){
+   size_t result{0};
+
+   if(_slotsPtr != nullptr)
+      result = _slotsMask + 1;
+
+   return result;
+}
+
+uint32_t ClickEventJournal::getLostQty(const bool &reset){
+   uint32_t result{0};
+
+   if(reset)
+      result = _lostQty.exchange(0);
+   else
+      result = _lostQty.load();
+
+   return result;
+}
+
+bool IRAM_ATTR ClickEventJournal::push(const ccEvntRcrd_t &rcrd){
+   bool result{false};
+   uint32_t pos{_wrtPos.load(std::memory_order_relaxed)};
+   ccJrnlSlot_t* slotPtr{nullptr};
+   int32_t seqDiff{0};
+
+   if(_slotsPtr != nullptr){
+      for(;;){
+         slotPtr = &_slotsPtr[pos & _slotsMask];
+         seqDiff = static_cast<int32_t>(slotPtr->seq.load(std::memory_order_acquire) - pos);
+         if(seqDiff == 0){
+            if(_wrtPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+               result = true;
+               break;
+            }
+         }
+         else if(seqDiff < 0){
+            break;   // The slot still holds a record not drained: the journal is full
+         }
+         else{
+            pos = _wrtPos.load(std::memory_order_relaxed);
+         }
+      }
+      if(result){
+         slotPtr->rcrd = rcrd;
+         slotPtr->seq.store(pos + 1, std::memory_order_release);
+      }
+      else
+         _lostQty.fetch_add(1, std::memory_order_relaxed);
+   }
+
+   return result;
+}
+
+size_t ClickEventJournal::take(ccEvntRcrd_t* dstPtr, const size_t &maxQty){
+   size_t result{0};
+   ccJrnlSlot_t* slotPtr{nullptr};
+
+   if((_slotsPtr != nullptr) && (dstPtr != nullptr)){
+      while(result < maxQty){
+         slotPtr = &_slotsPtr[_rdPos & _slotsMask];
+         if(slotPtr->seq.load(std::memory_order_acquire) != (_rdPos + 1))
+            break;   // No more records completely registered
+         dstPtr[result] = slotPtr->rcrd;
+         slotPtr->seq.store(_rdPos + _slotsMask + 1, std::memory_order_release);
+         _rdPos++;
+         result++;
+      }
+   }
+
+   return result;
+}
+
+void ClickEventJournal::_initSlots(const size_t &slotsQty){
+   _slotsMask = slotsQty - 1;
+   for(size_t i{0}; i < slotsQty; i++)
+      _slotsPtr[i].seq.store(i, std::memory_order_relaxed);
+
+   return;
+}
@@ -0,0 +1,129 @@
+/**
+ ******************************************************************************
+ * @file ClickEventJournal_Esp32.h
+ *
+ * @brief Header file for the ClickEventJournal class of the ClickCounter_Esp32 library
+ *
+ * @details The ClickEventJournal class models a fixed capacity journal of count change events. Each successful count modification of the ClickCounter objects associated to the journal is registered as a compact record, holding the time of the modification, the operation executed, the count change and the resulting count value. The records are kept in a lock-free ring buffer, so the counting methods never block while registering, and a consumer task can drain the records in bulk without blocking the counting.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKEVENTJOURNAL_ESP32_H_
+#define _CLICKEVENTJOURNAL_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief Count change event record
+ */
+struct ccEvntRcrd_t{
+   uint32_t tmStmp;  /*!< Time of the count modification, in microseconds since the MCU start, as returned by esp_timer_get_time() truncated to 32 bits (restarts from 0 every 71.5 minutes) */
+   int32_t count; /*!< Count value resulting from the modification */
+   int32_t delta; /*!< Count change produced by the modification, saturated to the int32_t range (a restart from one end of a full int32_t range to the other) */
+   uint8_t opType;   /*!< Operation that produced the modification, one of the ccBatchOpType_t values */
+};
+
+/**
+ * @brief Journal ring buffer slot.
+ *
+ * The slots storage might be provided by the application to build a journal without dynamic memory allocation, see ClickEventJournal::ClickEventJournal(ccJrnlSlot_t*, const size_t &).
+ */
+struct ccJrnlSlot_t{
+   std::atomic<uint32_t> seq;
+   ccEvntRcrd_t rcrd;
+};
+
+/**
+ * @class ClickEventJournal
+ *
+ * @brief Models a lock-free, fixed capacity journal of count change events.
+ *
+ * Any quantity of producers (counting tasks and ISRs) might register records simultaneously without locking, while a single consumer task drains them. When the journal is full the new records are discarded and counted as lost, the producers are never delayed.
+ */
+class ClickEventJournal{
+private:
+   ccJrnlSlot_t* _slotsPtr{nullptr};
+   uint32_t _slotsMask{0};
+   bool _ownSlots{false};
+   std::atomic<uint32_t> _wrtPos{0};
+   uint32_t _rdPos{0};
+   std::atomic<uint32_t> _lostQty{0};
+
+   void _initSlots(const size_t &slotsQty);
+
+public:
+   /**
+    * @brief Class constructor, with the slots storage provided by the application.
+    *
+    * No dynamic memory allocation is made by this constructor.
+    *
+    * @param slotsPtr Pointer to an array of ccJrnlSlot_t to be used as the journal storage. The array must exist for the complete life of the journal.
+    * @param slotsQty Quantity of elements in the slotsPtr array. Must be a power of 2, if it isn't only the biggest power of 2 smaller than slotsQty elements will be used.
+    */
+   ClickEventJournal(ccJrnlSlot_t* slotsPtr, const size_t &slotsQty);
+   /**
+    * @brief Class constructor, with the slots storage allocated by the journal.
+    *
+    * @param slotsQty Quantity of records the journal must be able to hold. Must be a power of 2, if it isn't the next power of 2 bigger than slotsQty will be used.
+    */
+   ClickEventJournal(const size_t &slotsQty);
+   /**
+    * @brief Class destructor.
+    */
+   ~ClickEventJournal();
+   /**
+    * @brief Returns the quantity of records the journal can hold.
+    *
+    * @return The journal capacity, 0 if the storage couldn't be allocated.
+    */
+   size_t getCapacity();
+   /**
+    * @brief Returns the quantity of records discarded because the journal was full.
+    *
+    * @param reset (Optional) Indicates if the lost records counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of records discarded since the journal was built or since the last reset.
+    */
+   uint32_t getLostQty(const bool &reset = false);
+   /**
+    * @brief Registers a record in the journal.
+    *
+    * This method is ISR safe, and might be invoked simultaneously by any quantity of tasks.
+    *
+    * @param rcrd The record to register.
+    *
+    * @retval true The record was registered.
+    * @retval false The journal was full, the record was discarded and counted as lost.
+    */
+   bool push(const ccEvntRcrd_t &rcrd);
+   /**
+    * @brief Drains records from the journal, in registering order.
+    *
+    * Only one task must drain the journal.
+    *
+    * @param dstPtr Pointer to the array where the drained records will be copied.
+    * @param maxQty Maximum quantity of records to drain, usually the dstPtr array size.
+    *
+    * @return The quantity of records drained and copied to the dstPtr array.
+    */
+   size_t take(ccEvntRcrd_t* dstPtr, const size_t &maxQty);
+};
+
+#endif   // _CLICKEVENTJOURNAL_ESP32_H_
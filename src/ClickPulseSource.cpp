@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource.cpp
+ *
+ * @brief Code file for the platform independent pulse sources of the ClickCounter_Esp32 library
+ *
+ * @details The pulse sources model the 'increment count' signal providers of a counter, accumulating the pulses received to be delivered in bulk to a ClickCounter object.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: None
+ * Platform: Any
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <ClickPulseSource.h>
+#if __has_include(<esp_attr.h>)
+#include <esp_attr.h>
+#endif
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+ClickPulseSource::~ClickPulseSource()
+{
+}
+
+//==========================================================>>
+
+SimPulseSource::SimPulseSource()
+{
+}
+
+SimPulseSource::~SimPulseSource()
+{
+}
+
+void IRAM_ATTR SimPulseSource::addPulses(const int32_t &qty){
+   _pulses.fetch_add(qty, std::memory_order_relaxed);
+
+   return;
+}
+
+int32_t SimPulseSource::takePulses(){
+
+   return _pulses.exchange(0);
+}
@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource.h
+ *
+ * @brief Header file for the platform independent pulse sources of the ClickCounter_Esp32 library
+ *
+ * @details The pulse sources model the 'increment count' signal providers of a counter. Instead of the application code invoking a ClickCounter countUp() for every single pulse, the pulses are accumulated by the source (a counting peripheral, an ISR, a simulation) and the ClickCounter object polls the source, adding all the pulses accumulated since the last poll with a single countUp(const int32_t &) call.
+ * This file holds the ClickPulseSource base class and the SimPulseSource class, that depend on no platform service, so they might be used and tested in any C++ host. The hardware based sources are declared in ClickPulseSource_Esp32.h.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: None
+ * Platform: Any
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKPULSESOURCE_H_
+#define _CLICKPULSESOURCE_H_
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @class ClickPulseSource
+ *
+ * @brief Abstract class that models a source of pulses to be counted by a ClickCounter object.
+ *
+ * A pulse source accumulates the pulses received and delivers them in bulk when polled, making thousands of pulses per second become a single count modification per poll. Subclasses must implement the takePulses() method.
+ */
+class ClickPulseSource{
+public:
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~ClickPulseSource();
+   /**
+    * @brief Returns the net quantity of pulses accumulated since the previous call, and restarts the accumulation.
+    *
+    * @return The net quantity of pulses accumulated. Positive values must be added to the count, negative values (for sources able to detect counting direction) must be subtracted from the count.
+    */
+   virtual int32_t takePulses() = 0;
+};
+
+//==========================================================>>
+
+/**
+ * @class SimPulseSource
+ *
+ * @brief Models a software pulse source, to simulate pulse inputs or to collect pulses from code.
+ *
+ * The pulses are accumulated in an atomic variable by addPulses(const int32_t &), that might be invoked from any task or from an ISR, and delivered in bulk when polled.
+ */
+class SimPulseSource: public ClickPulseSource{
+private:
+   std::atomic<int32_t> _pulses{0};
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   SimPulseSource();
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~SimPulseSource();
+   /**
+    * @brief Adds pulses to the source accumulated pulses.
+    *
+    * This method is ISR safe.
+    *
+    * @param qty Quantity of pulses to add. Negative values simulate pulses in the reverse counting direction.
+    */
+   void addPulses(const int32_t &qty = 1);
+   /**
+    * @brief See ClickPulseSource::takePulses()
+    */
+   virtual int32_t takePulses();
+};
+
+#endif   // _CLICKPULSESOURCE_H_
@@ -0,0 +1,295 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource_Esp32.cpp
+ *
+ * @brief Code file for the pulse sources of the ClickCounter_Esp32 library
+ *
+ * @details The pulse sources model the 'increment count' signal providers of a counter, accumulating the pulses received to be delivered in bulk to a ClickCounter object.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <new>
+#include <ClickPulseSource_Esp32.h>
+
+PcntPulseSource::PcntPulseSource(const uint8_t &pulsePin, const pcnt_unit_t &pcntUnit, const uint16_t &fltrVal)
+:_pulsePin{pulsePin}, _pcntUnit{pcntUnit}, _fltrVal{fltrVal}
+{
+}
+
+PcntPulseSource::~PcntPulseSource()
+{
+   if(_begun)
+      pcnt_counter_pause(_pcntUnit);
+}
+
+bool PcntPulseSource::begin(){
+   bool result{false};
+   pcnt_config_t pcntCnfg{};
+
+   if(!_begun){
+      pcntCnfg.pulse_gpio_num = _pulsePin;
+      pcntCnfg.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+      pcntCnfg.lctrl_mode = PCNT_MODE_KEEP;
+      pcntCnfg.hctrl_mode = PCNT_MODE_KEEP;
+      pcntCnfg.pos_mode = PCNT_COUNT_INC;
+      pcntCnfg.neg_mode = PCNT_COUNT_DIS;
+      pcntCnfg.counter_h_lim = _pcntHLim;
+      pcntCnfg.counter_l_lim = 0;
+      pcntCnfg.unit = _pcntUnit;
+      pcntCnfg.channel = PCNT_CHANNEL_0;
+
+      if(pcnt_unit_config(&pcntCnfg) == ESP_OK){
+         if(_fltrVal > 0){
+            pcnt_set_filter_value(_pcntUnit, _fltrVal);
+            pcnt_filter_enable(_pcntUnit);
+         }
+         else
+            pcnt_filter_disable(_pcntUnit);
+         pcnt_counter_pause(_pcntUnit);
+         pcnt_counter_clear(_pcntUnit);
+         _lastPcntVal = 0;
+         pcnt_counter_resume(_pcntUnit);
+         _begun = true;
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+int32_t PcntPulseSource::takePulses(){
+   int32_t result{0};
+   int16_t curPcntVal{0};
+
+   if(_begun){
+      if(pcnt_get_counter_value(_pcntUnit, &curPcntVal) == ESP_OK){
+         if(curPcntVal >= _lastPcntVal)
+            result = curPcntVal - _lastPcntVal;
+         else
+            result = (_pcntHLim - _lastPcntVal) + curPcntVal;   // The unit restarted from 0 when reaching the upper limit
+         _lastPcntVal = curPcntVal;
+      }
+   }
+
+   return result;
+}
+
+//==========================================================>>
+
+DebouncedPulseSource::DebouncedPulseSource(const size_t &edgesQty, const uint32_t &stblUs, const uint32_t &lockoutUs, const bool &actvHigh)
+:_stblUs{stblUs}, _lockoutUs{lockoutUs}, _actvLvl{actvHigh}, _stblLvl{!actvHigh}
+{
+   size_t pwrOf2{1};
+
+   if(edgesQty > 0){
+      while(pwrOf2 < edgesQty)
+         pwrOf2 <<= 1;
+      _edgesPtr = new(std::nothrow) ccEdgeRcrd_t[pwrOf2];
+      if(_edgesPtr != nullptr)
+         _edgesMask = pwrOf2 - 1;
+   }
+}
+
+DebouncedPulseSource::~DebouncedPulseSource()
+{
+   if(_begun)
+      detachInterrupt(digitalPinToInterrupt(_inputPin));
+   delete [] _edgesPtr;
+}
+
+bool DebouncedPulseSource::begin(const uint8_t &inputPin){
+   bool result{false};
+
+   if(!_begun && (_edgesPtr != nullptr)){
+      _inputPin = inputPin;
+      pinMode(_inputPin, INPUT);
+      _stblLvl = (digitalRead(_inputPin) == HIGH);
+      _pndng = false;
+      attachInterruptArg(digitalPinToInterrupt(_inputPin), _edgeIsr, this, CHANGE);
+      _begun = true;
+      result = true;
+   }
+
+   return result;
+}
+
+uint32_t DebouncedPulseSource::getLostQty(const bool &reset){
+   uint32_t result{0};
+
+   if(reset)
+      result = _lostQty.exchange(0);
+   else
+      result = _lostQty.load();
+
+   return result;
+}
+
+int32_t DebouncedPulseSource::processEdges(const uint32_t &nowUs){
+   int32_t result{0};
+   uint32_t rdPos{_rdPos.load(std::memory_order_relaxed)};
+   uint32_t wrtPos{_wrtPos.load(std::memory_order_acquire)};
+   const ccEdgeRcrd_t* edgePtr{nullptr};
+
+   while(rdPos != wrtPos){
+      edgePtr = &_edgesPtr[rdPos & _edgesMask];
+      if(_pndng && ((edgePtr->tmStmp - _pndngTm) >= _stblUs))   // The pending level stayed unchanged long enough before this edge
+         _cnfrmLvl(result);
+      if(edgePtr->level != _stblLvl){
+         if(!_pndng){
+            _pndng = true;
+            _pndngTm = edgePtr->tmStmp;
+         }
+      }
+      else
+         _pndng = false;   // The input returned to the accepted level before the stable time, the pulse is a glitch
+      rdPos++;
+   }
+   _rdPos.store(rdPos, std::memory_order_release);
+   if(_pndng && (static_cast<int32_t>(nowUs - _pndngTm) >= static_cast<int32_t>(_stblUs)))
+      _cnfrmLvl(result);
+
+   return result;
+}
+
+bool IRAM_ATTR DebouncedPulseSource::pushEdge(const uint32_t &tmStmp, const bool &level){
+   bool result{false};
+   uint32_t wrtPos{_wrtPos.load(std::memory_order_relaxed)};
+
+   if((_edgesPtr != nullptr) && ((wrtPos - _rdPos.load(std::memory_order_acquire)) <= _edgesMask)){
+      _edgesPtr[wrtPos & _edgesMask].tmStmp = tmStmp;
+      _edgesPtr[wrtPos & _edgesMask].level = level;
+      _wrtPos.store(wrtPos + 1, std::memory_order_release);
+      result = true;
+   }
+   else
+      _lostQty.fetch_add(1, std::memory_order_relaxed);
+
+   return result;
+}
+
+int32_t DebouncedPulseSource::takePulses(){
+
+   return processEdges(static_cast<uint32_t>(esp_timer_get_time()));
+}
+
+void DebouncedPulseSource::_cnfrmLvl(int32_t &clicks){
+   _stblLvl = !_stblLvl;
+   _pndng = false;
+   if(_stblLvl == _actvLvl){
+      if(!_clkd || ((_pndngTm - _lastClkTm) >= _lockoutUs)){
+         clicks++;
+         _lastClkTm = _pndngTm;
+         _clkd = true;
+      }
+   }
+
+   return;
+}
+
+void IRAM_ATTR DebouncedPulseSource::_edgeIsr(void* argp){
+   DebouncedPulseSource* srcPtr = static_cast<DebouncedPulseSource*>(argp);
+
+   srcPtr->pushEdge(static_cast<uint32_t>(esp_timer_get_time()), gpio_get_level(static_cast<gpio_num_t>(srcPtr->_inputPin)) != 0);
+
+   return;
+}
+
+//==========================================================>>
+
+const int8_t QuadraturePulseSource::_qdrtrLut[16]{   // Indexed by (previous state << 2) | current state, phase A in bit 1 and phase B in bit 0
+    0, -1,  1,  0,
+    1,  0,  0, -1,
+   -1,  0,  0,  1,
+    0,  1, -1,  0
+};
+
+QuadraturePulseSource::QuadraturePulseSource(const ccQdrtrRes_t &res)
+{
+   if(res == ccQdrtrX2)
+      _resShft = 1;
+   else if(res == ccQdrtrX1)
+      _resShft = 2;
+}
+
+QuadraturePulseSource::~QuadraturePulseSource()
+{
+   if(_begun){
+      detachInterrupt(digitalPinToInterrupt(_phsAPin));
+      detachInterrupt(digitalPinToInterrupt(_phsBPin));
+   }
+}
+
+bool QuadraturePulseSource::begin(const uint8_t &phsAPin, const uint8_t &phsBPin){
+   bool result{false};
+
+   if(!_begun){
+      _phsAPin = phsAPin;
+      _phsBPin = phsBPin;
+      pinMode(_phsAPin, INPUT);
+      pinMode(_phsBPin, INPUT);
+      _prevState = ((digitalRead(_phsAPin) == HIGH)?2:0) | ((digitalRead(_phsBPin) == HIGH)?1:0);
+      attachInterruptArg(digitalPinToInterrupt(_phsAPin), _phsIsr, this, CHANGE);
+      attachInterruptArg(digitalPinToInterrupt(_phsBPin), _phsIsr, this, CHANGE);
+      _begun = true;
+      result = true;
+   }
+
+   return result;
+}
+
+uint32_t QuadraturePulseSource::getErrorQty(const bool &reset){
+   uint32_t result{0};
+
+   if(reset)
+      result = _errQty.exchange(0);
+   else
+      result = _errQty.load();
+
+   return result;
+}
+
+void IRAM_ATTR QuadraturePulseSource::pushState(const uint8_t &abState){
+   uint8_t trnstn = (_prevState << 2) | (abState & 0x03);
+
+   _qrtrs.store(_qrtrs.load(std::memory_order_relaxed) + _qdrtrLut[trnstn], std::memory_order_relaxed);   // Single producer, no read-modify-write needed
+   if((_illglMask >> trnstn) & 0x01)
+      _errQty.fetch_add(1, std::memory_order_relaxed);
+   _prevState = abState & 0x03;
+
+   return;
+}
+
+int32_t QuadraturePulseSource::takePulses(){
+   int32_t result{0};
+   uint32_t curQrtrs{_qrtrs.load(std::memory_order_relaxed)};
+
+   _rmndr += static_cast<int32_t>(curQrtrs - _lastQrtrs);   // Wrapping difference, valid while less than 2^31 quarter steps are registered between polls
+   _lastQrtrs = curQrtrs;
+   result = _rmndr >> _resShft;   // Rounds towards negative infinity, the remainder is always positive
+   _rmndr -= result * (1 << _resShft);
+
+   return result;
+}
+
+void IRAM_ATTR QuadraturePulseSource::_phsIsr(void* argp){
+   QuadraturePulseSource* srcPtr = static_cast<QuadraturePulseSource*>(argp);
+
+   srcPtr->pushState(((gpio_get_level(static_cast<gpio_num_t>(srcPtr->_phsAPin)) != 0)?2:0) | ((gpio_get_level(static_cast<gpio_num_t>(srcPtr->_phsBPin)) != 0)?1:0));
+
+   return;
+}
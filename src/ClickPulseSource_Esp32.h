@@ -0,0 +1,278 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource_Esp32.h
+ *
+ * @brief Header file for the pulse sources of the ClickCounter_Esp32 library
+ *
+ * @details The pulse sources model the 'increment count' signal providers of a counter. Instead of the application code invoking a ClickCounter countUp() for every single pulse, the pulses are accumulated by the source (a counting peripheral, an ISR, a simulation) and the ClickCounter object polls the source, adding all the pulses accumulated since the last poll with a single countUp(const int32_t &) call.
+ * The ClickPulseSource base class and the SimPulseSource class are declared in the platform independent ClickPulseSource.h file, included by this one.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKPULSESOURCE_ESP32_H_
+#define _CLICKPULSESOURCE_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+#include <ClickPulseSource.h>
+#include <driver/pcnt.h>
+#include <driver/gpio.h>
+
+/**
+ * @class PcntPulseSource
+ *
+ * @brief Models a pulse source built over an ESP32 Pulse Counter (PCNT) unit.
+ *
+ * The PCNT peripheral counts the rising edges of the signal in the selected input pin by hardware, with an optional glitch filter, without any CPU intervention. Each takePulses() call reads the accumulated value and returns the pulses counted since the previous reading.
+ *
+ * @attention The PCNT unit counter is 16 bits wide, and it restarts from 0 when it reaches its upper limit (32767). The source must be polled at least once every 32767 pulses to avoid losing pulses.
+ */
+class PcntPulseSource: public ClickPulseSource{
+private:
+   static const int16_t _pcntHLim{32767};
+
+   uint8_t _pulsePin{};
+   pcnt_unit_t _pcntUnit{PCNT_UNIT_0};
+   uint16_t _fltrVal{0};
+   int16_t _lastPcntVal{0};
+   bool _begun{false};
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param pulsePin GPIO pin number to which the pulse signal is connected.
+    * @param pcntUnit (Optional) PCNT unit to use. Each PcntPulseSource object must use a different unit. If not provided PCNT_UNIT_0 will be used.
+    * @param fltrVal (Optional) Glitch filter value, in APB clock cycles (12.5 nanoseconds), pulses shorter than this value will be ignored. The maximum valid value is 1023, a value of 0 disables the filter. If not provided the filter will be disabled.
+    */
+   PcntPulseSource(const uint8_t &pulsePin, const pcnt_unit_t &pcntUnit = PCNT_UNIT_0, const uint16_t &fltrVal = 0);
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~PcntPulseSource();
+   /**
+    * @brief Configures the PCNT unit and starts counting the pulses.
+    *
+    * @return The success in starting the pulse counting.
+    * @retval true The PCNT unit was configured and the counting started.
+    * @retval false The object was already begun, or the PCNT unit configuration failed.
+    */
+   bool begin();
+   /**
+    * @brief See ClickPulseSource::takePulses()
+    */
+   virtual int32_t takePulses();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Input edge record, see DebouncedPulseSource
+ */
+struct ccEdgeRcrd_t{
+   uint32_t tmStmp;  /*!< Time of the edge, in microseconds, as returned by esp_timer_get_time() truncated to 32 bits */
+   bool level; /*!< Input level after the edge */
+};
+
+/**
+ * @class DebouncedPulseSource
+ *
+ * @brief Models a pulse source that debounces the timestamped edges of a digital input.
+ *
+ * The edges are registered by pushEdge(const uint32_t &, const bool &), from the input pin interrupt set by begin(const uint8_t &) or by any other single producer (a task sampling the input, a recorded edges stream), in a lock-free ring buffer. The edges are debounced in bulk when the source is polled, and the accepted clicks are delivered as a single quantity, so the counter is modified once per poll whatever the input frequency is.
+ *
+ * The debouncing is configured by two time windows, each one disabled by a value of 0:
+ * - Stable time: a new level must stay unchanged at least this time to be accepted, pulses of either level shorter than it are discarded as glitches (integrating debounce).
+ * - Lockout time: after a click is accepted, new clicks are ignored until this time elapses since the accepted one (lockout debounce).
+ *
+ * A click is counted each time the accepted level changes to the active level.
+ *
+ * @note The timestamps are 32 bits microseconds values, the source must be polled more often than every 35 minutes.
+ */
+class DebouncedPulseSource: public ClickPulseSource{
+private:
+   ccEdgeRcrd_t* _edgesPtr{nullptr};
+   uint32_t _edgesMask{0};
+   std::atomic<uint32_t> _wrtPos{0};
+   std::atomic<uint32_t> _rdPos{0};
+   std::atomic<uint32_t> _lostQty{0};
+   uint32_t _stblUs{0};
+   uint32_t _lockoutUs{0};
+   bool _actvLvl{true};
+   bool _stblLvl{false};
+   bool _pndng{false};
+   uint32_t _pndngTm{0};
+   bool _clkd{false};
+   uint32_t _lastClkTm{0};
+   uint8_t _inputPin{0};
+   bool _begun{false};
+
+   void _cnfrmLvl(int32_t &clicks);
+   static void _edgeIsr(void* argp);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param edgesQty (Optional) Quantity of edges the ring buffer must be able to hold between polls. Must be a power of 2, if it isn't the next power of 2 bigger than edgesQty will be used. If not provided a value of 64 will be used.
+    * @param stblUs (Optional) Stable time in microseconds, a value of 0 disables the glitch filtering. If not provided a value of 1000 will be used.
+    * @param lockoutUs (Optional) Lockout time in microseconds, a value of 0 disables the lockout. If not provided the lockout will be disabled.
+    * @param actvHigh (Optional) Indicates if the clicks are counted when the input changes to high level (true) or to low level (false). If not provided a value of true will be used.
+    *
+    * @note If the ring buffer can't be allocated every edge will be discarded and counted as lost.
+    */
+   DebouncedPulseSource(const size_t &edgesQty = 64, const uint32_t &stblUs = 1000, const uint32_t &lockoutUs = 0, const bool &actvHigh = true);
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~DebouncedPulseSource();
+   /**
+    * @brief Sets an input pin interrupt to register the pin edges.
+    *
+    * The accepted level is initialized to the current pin level. Using this method is optional, the edges might be registered by any other single producer through pushEdge(const uint32_t &, const bool &).
+    *
+    * @param inputPin GPIO pin number to which the input signal is connected. The pin is configured as input, any pull resistor needed must be set after this method.
+    *
+    * @retval true The interrupt was set.
+    * @retval false The object was already begun, or the ring buffer couldn't be allocated.
+    */
+   bool begin(const uint8_t &inputPin);
+   /**
+    * @brief Returns the quantity of edges discarded because the ring buffer was full.
+    *
+    * @param reset (Optional) Indicates if the lost edges counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of edges discarded since the object was built or since the last reset.
+    */
+   uint32_t getLostQty(const bool &reset = false);
+   /**
+    * @brief Debounces the edges registered since the previous call.
+    *
+    * The edges are processed in registering order. A level pending of being accepted is accepted if it stayed unchanged from its edge up to the nowUs time for at least the stable time. Must be invoked from a single task, as takePulses() does.
+    *
+    * @param nowUs Current time, in the same time base as the edges timestamps.
+    *
+    * @return The quantity of clicks accepted.
+    */
+   int32_t processEdges(const uint32_t &nowUs);
+   /**
+    * @brief Registers an input edge.
+    *
+    * This method is ISR safe. Only one task or ISR must register edges.
+    *
+    * @param tmStmp Time of the edge in microseconds. The timestamps must be registered in non decreasing order.
+    * @param level Input level after the edge. Registering a level equal to the previous one is valid, so the method might be used to register input samples.
+    *
+    * @retval true The edge was registered.
+    * @retval false The ring buffer was full, the edge was discarded and counted as lost.
+    */
+   bool pushEdge(const uint32_t &tmStmp, const bool &level);
+   /**
+    * @brief See ClickPulseSource::takePulses()
+    *
+    * Debounces the registered edges by processEdges(const uint32_t &) with the current esp_timer_get_time() value.
+    */
+   virtual int32_t takePulses();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Resolutions available for the QuadraturePulseSource decoding
+ */
+enum ccQdrtrRes_t{
+   ccQdrtrX1,  /*!< One pulse per complete quadrature cycle (encoder line) */
+   ccQdrtrX2,  /*!< Two pulses per complete quadrature cycle */
+   ccQdrtrX4   /*!< Four pulses per complete quadrature cycle, one per phase edge */
+};
+
+/**
+ * @class QuadraturePulseSource
+ *
+ * @brief Models a pulse source that decodes two phase quadrature signals (incremental encoders, direction sensing dual beam sensors) into signed pulses.
+ *
+ * Every phase state change is decoded by a single lookup in a 16 entries state transition table indexed by the previous and the current phases state, with no branching: the table holds the quarter step produced by each transition (+1, -1, or 0 for no change), and the transitions changing both phases at once, which can't be decoded, are counted as errors. The quarter steps are accumulated and delivered in bulk when the source is polled, scaled to the selected resolution. The fraction of a pulse not yet completed is kept for the next poll, so no quarter step is lost.
+ *
+ * The phases states are registered by pushState(const uint8_t &), from the phases pins interrupts set by begin(const uint8_t &, const uint8_t &) or by any other single producer.
+ */
+class QuadraturePulseSource: public ClickPulseSource{
+private:
+   static const int8_t _qdrtrLut[16];
+   static const uint16_t _illglMask{0x1248};
+
+   uint8_t _prevState{0};
+   std::atomic<uint32_t> _qrtrs{0};
+   std::atomic<uint32_t> _errQty{0};
+   uint32_t _lastQrtrs{0};
+   int32_t _rmndr{0};
+   uint8_t _resShft{0};
+   uint8_t _phsAPin{0};
+   uint8_t _phsBPin{0};
+   bool _begun{false};
+
+   static void _phsIsr(void* argp);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param res (Optional) Decoding resolution. If not provided ccQdrtrX4 will be used.
+    */
+   QuadraturePulseSource(const ccQdrtrRes_t &res = ccQdrtrX4);
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~QuadraturePulseSource();
+   /**
+    * @brief Sets the phases pins interrupts to register the phases states.
+    *
+    * The previous state is initialized to the current pins levels. Using this method is optional, the states might be registered by any other single producer through pushState(const uint8_t &).
+    *
+    * @param phsAPin GPIO pin number to which the phase A signal is connected. The count increments when phase A leads phase B.
+    * @param phsBPin GPIO pin number to which the phase B signal is connected.
+    *
+    * @retval true The interrupts were set.
+    * @retval false The object was already begun.
+    */
+   bool begin(const uint8_t &phsAPin, const uint8_t &phsBPin);
+   /**
+    * @brief Returns the quantity of undecodable transitions registered.
+    *
+    * An undecodable transition changes both phases at once, usually because a phase edge was missed. A high quantity of errors indicates the phases change faster than they are being registered.
+    *
+    * @param reset (Optional) Indicates if the errors counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of undecodable transitions since the object was built or since the last reset.
+    */
+   uint32_t getErrorQty(const bool &reset = false);
+   /**
+    * @brief Registers the current phases state.
+    *
+    * This method is ISR safe. Only one task or ISR must register states. Registering a state equal to the previous one is valid and produces no quarter step, so the method might be used to register phases samples.
+    *
+    * @param abState Phases state, with the phase A level in the bit 1 and the phase B level in the bit 0. The rest of the bits are ignored.
+    */
+   void pushState(const uint8_t &abState);
+   /**
+    * @brief See ClickPulseSource::takePulses()
+    */
+   virtual int32_t takePulses();
+};
+
+#endif   // _CLICKPULSESOURCE_ESP32_H_
@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file ClickStorage.cpp
+ *
+ * @brief Code file for the platform independent ClickStorage classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickStorage classes model the non volatile storage used to persist the counters values.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: None
+ * Platform: Any
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <string.h>
+#include <ClickStorage.h>
+
+ClickStorage::~ClickStorage()
+{
+}
+
+//==========================================================>>
+
+FileStorage::FileStorage(const char* filePath, const uint32_t &sctrSize, const uint32_t &sctrsQty)
+{
+   long fileSize{0};
+   long strgSize{static_cast<long>(sctrSize) * sctrsQty};
+   uint8_t erasedBlck[64];
+
+   if((filePath != nullptr) && (sctrSize > 0) && (sctrsQty > 0)){
+      _filePtr = fopen(filePath, "r+b");
+      if(_filePtr == nullptr)
+         _filePtr = fopen(filePath, "w+b");
+      if(_filePtr != nullptr){
+         memset(erasedBlck, 0xFF, sizeof(erasedBlck));
+         fseek(_filePtr, 0, SEEK_END);
+         fileSize = ftell(_filePtr);
+         while((fileSize >= 0) && (fileSize < strgSize)){   // A new or shorter file is completed with erased sectors
+            if(fwrite(erasedBlck, 1, ((strgSize - fileSize) < static_cast<long>(sizeof(erasedBlck)))?(strgSize - fileSize):(sizeof(erasedBlck)), _filePtr) == 0)
+               break;
+            fileSize = ftell(_filePtr);
+         }
+         fflush(_filePtr);
+         if(fileSize >= strgSize){
+            _sctrSize = sctrSize;
+            _sctrsQty = sctrsQty;
+         }
+      }
+   }
+}
+
+FileStorage::~FileStorage()
+{
+   if(_filePtr != nullptr)
+      fclose(_filePtr);
+}
+
+bool FileStorage::erase(const uint32_t &sctr){
+   bool result{false};
+   uint8_t erasedBlck[64];
+   uint32_t pndngLen{_sctrSize};
+   size_t blckLen{0};
+
+   if(sctr < _sctrsQty){
+      memset(erasedBlck, 0xFF, sizeof(erasedBlck));
+      if(fseek(_filePtr, static_cast<long>(sctr) * _sctrSize, SEEK_SET) == 0){
+         result = true;
+         while(result && (pndngLen > 0)){
+            blckLen = (pndngLen < sizeof(erasedBlck))?(pndngLen):(sizeof(erasedBlck));
+            result = (fwrite(erasedBlck, 1, blckLen, _filePtr) == blckLen);
+            pndngLen -= blckLen;
+         }
+         if(fflush(_filePtr) != 0)
+            result = false;
+      }
+   }
+
+   return result;
+}
+
+uint32_t FileStorage::getSctrSize(){
+
+   return _sctrSize;
+}
+
+uint32_t FileStorage::getSctrsQty(){
+
+   return _sctrsQty;
+}
+
+bool FileStorage::read(const uint32_t &offset, void* dstPtr, const size_t &len){
+   bool result{false};
+
+   if((dstPtr != nullptr) && _inRng(offset, len)){
+      if(fseek(_filePtr, offset, SEEK_SET) == 0)
+         result = (fread(dstPtr, 1, len, _filePtr) == len);
+   }
+
+   return result;
+}
+
+bool FileStorage::write(const uint32_t &offset, const void* srcPtr, const size_t &len){
+   bool result{false};
+
+   if((srcPtr != nullptr) && _inRng(offset, len)){
+      if(fseek(_filePtr, offset, SEEK_SET) == 0)
+         result = ((fwrite(srcPtr, 1, len, _filePtr) == len) && (fflush(_filePtr) == 0));
+   }
+
+   return result;
+}
+
+bool FileStorage::_inRng(const uint32_t &offset, const size_t &len){
+
+   return ((_sctrsQty > 0) && (len <= (static_cast<uint64_t>(_sctrSize) * _sctrsQty)) && (offset <= ((static_cast<uint64_t>(_sctrSize) * _sctrsQty) - len)));
+}
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file ClickStorage.h
+ *
+ * @brief Header file for the platform independent ClickStorage classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickStorage classes model the non volatile storage used to persist the counters values. The storage is seen as a fixed quantity of equally sized sectors, that must be erased before being written, as a NOR flash memory is.
+ * This file holds the ClickStorage base class and the FileStorage class, that depend only on the standard C streams, so they might be used and tested in any C++ host. The ESP32 flash partition based storage is declared in ClickStorage_Esp32.h.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: None
+ * Platform: Any
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKSTORAGE_H_
+#define _CLICKSTORAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @class ClickStorage
+ *
+ * @brief Abstract class that models a sectored non volatile storage.
+ *
+ * The storage is divided in getSctrsQty() sectors of getSctrSize() bytes each. An erased sector reads as all bytes set to 0xFF, and each byte of it must be written only once until the sector is erased again. Subclasses must implement all the pure virtual methods.
+ */
+class ClickStorage{
+public:
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~ClickStorage();
+   /**
+    * @brief Erases a sector, setting all its bytes to 0xFF.
+    *
+    * @param sctr Number of the sector to erase.
+    *
+    * @retval true The sector was erased.
+    * @retval false The sector doesn't exist, or the erase failed.
+    */
+   virtual bool erase(const uint32_t &sctr) = 0;
+   /**
+    * @brief Returns the size of each sector.
+    *
+    * @return The sector size in bytes, 0 if the storage is not available.
+    */
+   virtual uint32_t getSctrSize() = 0;
+   /**
+    * @brief Returns the quantity of sectors of the storage.
+    *
+    * @return The quantity of sectors, 0 if the storage is not available.
+    */
+   virtual uint32_t getSctrsQty() = 0;
+   /**
+    * @brief Reads data from the storage.
+    *
+    * @param offset Position of the first byte to read, from the start of the storage.
+    * @param dstPtr Pointer to the buffer where the data will be copied.
+    * @param len Quantity of bytes to read.
+    *
+    * @retval true The data was read.
+    * @retval false The range exceeds the storage size, or the reading failed.
+    */
+   virtual bool read(const uint32_t &offset, void* dstPtr, const size_t &len) = 0;
+   /**
+    * @brief Writes data to the storage.
+    *
+    * @param offset Position of the first byte to write, from the start of the storage. The bytes written must be erased since the last sector erase.
+    * @param srcPtr Pointer to the data to write.
+    * @param len Quantity of bytes to write.
+    *
+    * @retval true The data was written.
+    * @retval false The range exceeds the storage size, or the writing failed.
+    */
+   virtual bool write(const uint32_t &offset, const void* srcPtr, const size_t &len) = 0;
+};
+
+//==========================================================>>
+
+/**
+ * @class FileStorage
+ *
+ * @brief Models a storage built over a file.
+ *
+ * The file is accessed through the standard C streams, so it might reside in any file system mounted in the Virtual File System (SPIFFS, LittleFS, FAT over SD cards), or in the file system of a host computer when the library is built to run simulations or tests. The file is created with all its sectors erased if it doesn't exist.
+ */
+class FileStorage: public ClickStorage{
+private:
+   FILE* _filePtr{nullptr};
+   uint32_t _sctrSize{0};
+   uint32_t _sctrsQty{0};
+
+   bool _inRng(const uint32_t &offset, const size_t &len);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param filePath Path of the file to use.
+    * @param sctrSize Size of each sector in bytes.
+    * @param sctrsQty Quantity of sectors.
+    *
+    * @note If the file can't be opened or created the storage is built with no sectors, and getSctrsQty() will return 0.
+    */
+   FileStorage(const char* filePath, const uint32_t &sctrSize, const uint32_t &sctrsQty);
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~FileStorage();
+   /**
+    * @brief See ClickStorage::erase(const uint32_t &)
+    */
+   virtual bool erase(const uint32_t &sctr);
+   /**
+    * @brief See ClickStorage::getSctrSize()
+    */
+   virtual uint32_t getSctrSize();
+   /**
+    * @brief See ClickStorage::getSctrsQty()
+    */
+   virtual uint32_t getSctrsQty();
+   /**
+    * @brief See ClickStorage::read(const uint32_t &, void*, const size_t &)
+    */
+   virtual bool read(const uint32_t &offset, void* dstPtr, const size_t &len);
+   /**
+    * @brief See ClickStorage::write(const uint32_t &, const void*, const size_t &)
+    *
+    * The data is flushed to the file before returning.
+    */
+   virtual bool write(const uint32_t &offset, const void* srcPtr, const size_t &len);
+};
+
+#endif   // _CLICKSTORAGE_H_
@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file ClickStorage_Esp32.cpp
+ *
+ * @brief Code file for the ClickStorage classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickStorage classes model the non volatile storage used to persist the counters values.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <ClickStorage_Esp32.h>
+
+PartitionStorage::PartitionStorage(const char* prttnLabel)
+{
+   if(prttnLabel != nullptr)
+      _prttnPtr = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, prttnLabel);
+}
+
+PartitionStorage::~PartitionStorage()
+{
+}
+
+bool PartitionStorage::erase(const uint32_t &sctr){
+   bool result{false};
+
+   if(sctr < getSctrsQty())
+      result = (esp_partition_erase_range(_prttnPtr, sctr * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE) == ESP_OK);
+
+   return result;
+}
+
+uint32_t PartitionStorage::getSctrSize(){
+   uint32_t result{0};
+
+   if(_prttnPtr != nullptr)
+      result = SPI_FLASH_SEC_SIZE;
+
+   return result;
+}
+
+uint32_t PartitionStorage::getSctrsQty(){
+   uint32_t result{0};
+
+   if(_prttnPtr != nullptr)
+      result = _prttnPtr->size / SPI_FLASH_SEC_SIZE;
+
+   return result;
+}
+
+bool PartitionStorage::read(const uint32_t &offset, void* dstPtr, const size_t &len){
+   bool result{false};
+
+   if((_prttnPtr != nullptr) && (dstPtr != nullptr))
+      result = (esp_partition_read(_prttnPtr, offset, dstPtr, len) == ESP_OK);
+
+   return result;
+}
+
+bool PartitionStorage::write(const uint32_t &offset, const void* srcPtr, const size_t &len){
+   bool result{false};
+
+   if((_prttnPtr != nullptr) && (srcPtr != nullptr))
+      result = (esp_partition_write(_prttnPtr, offset, srcPtr, len) == ESP_OK);
+
+   return result;
+}
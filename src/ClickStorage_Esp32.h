@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file ClickStorage_Esp32.h
+ *
+ * @brief Header file for the ClickStorage classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickStorage classes model the non volatile storage used to persist the counters values. The storage is seen as a fixed quantity of equally sized sectors, that must be erased before being written, as a NOR flash memory is. This file holds the implementation over an ESP32 flash data partition.
+ * The ClickStorage base class and the FileStorage class, to be used in file systems (SPIFFS, LittleFS, SD cards) or in hosts without flash memory, are declared in the platform independent ClickStorage.h file, included by this one.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   17/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKSTORAGE_ESP32_H_
+#define _CLICKSTORAGE_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <ClickStorage.h>
+#include <esp_partition.h>
+
+/**
+ * @class PartitionStorage
+ *
+ * @brief Models a storage built over an ESP32 flash data partition.
+ *
+ * The partition must be declared in the partitions table used to build the application, for example with a line like `cntrlog, data, 0x40, , 16K`. Each 4 KB flash sector of the partition is a storage sector, the data written is spread over all the sectors by the ClickCountPersist class to level the flash wear.
+ */
+class PartitionStorage: public ClickStorage{
+private:
+   const esp_partition_t* _prttnPtr{nullptr};
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param prttnLabel Label of the data partition to use, as declared in the partitions table.
+    *
+    * @note If the partition is not found the storage is built with no sectors, and getSctrsQty() will return 0.
+    */
+   PartitionStorage(const char* prttnLabel);
+   /**
+    * @brief Class destructor.
+    */
+   virtual ~PartitionStorage();
+   /**
+    * @brief See ClickStorage::erase(const uint32_t &)
+    */
+   virtual bool erase(const uint32_t &sctr);
+   /**
+    * @brief See ClickStorage::getSctrSize()
+    */
+   virtual uint32_t getSctrSize();
+   /**
+    * @brief See ClickStorage::getSctrsQty()
+    */
+   virtual uint32_t getSctrsQty();
+   /**
+    * @brief See ClickStorage::read(const uint32_t &, void*, const size_t &)
+    */
+   virtual bool read(const uint32_t &offset, void* dstPtr, const size_t &len);
+   /**
+    * @brief See ClickStorage::write(const uint32_t &, const void*, const size_t &)
+    */
+   virtual bool write(const uint32_t &offset, const void* srcPtr, const size_t &len);
+};
+
+#endif   // _CLICKSTORAGE_ESP32_H_
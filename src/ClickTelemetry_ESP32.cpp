@@ -0,0 +1,493 @@
+/**
+ ******************************************************************************
+ * @file ClickTelemetry_Esp32.cpp
+ *
+ * @brief Code file for the ClickTelemetry classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickTelemetry classes encode and decode the values of many counters as a compact binary stream of delta frames.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino, or none
+ * Platform: ESP32, or any C++11 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <new>
+#include <string.h>
+#include <ClickTelemetry_Esp32.h>
+
+#if defined(ESP_PLATFORM)
+#include <esp_attr.h>
+#else
+#define IRAM_ATTR
+#endif
+
+static const uint8_t _tlmSync{0xA5};
+static const uint8_t _tlmTypeDlt{0};
+static const uint8_t _tlmTypeKey{1};
+static const size_t _tlmHdrSz{5};
+static const size_t _tlmCrcSz{2};
+static const size_t _tlmPldMax{UINT16_MAX};
+static const size_t _tlmEntryMax{10};   // Two 32 bits varints, 5 bytes each
+static const size_t _tlmChnlsMax{_tlmPldMax / _tlmEntryMax};
+
+static const uint16_t _crcNbblTbl[16]{
+   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+   0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t ccCrc16(const void* dataPtr, const size_t &len, const uint16_t &crc){
+   uint16_t result{crc};
+   const uint8_t* bytePtr{static_cast<const uint8_t*>(dataPtr)};
+
+   for(size_t i{0}; i < len; i++){   // A nibble table keeps the table small, with two lookups per byte
+      result = static_cast<uint16_t>((result << 4) ^ _crcNbblTbl[(result >> 12) ^ (bytePtr[i] >> 4)]);
+      result = static_cast<uint16_t>((result << 4) ^ _crcNbblTbl[(result >> 12) ^ (bytePtr[i] & 0x0F)]);
+   }
+
+   return result;
+}
+
+static size_t _vrntRd(const uint8_t* bufPtr, const size_t &len, uint32_t &val){
+   size_t result{0};
+   uint32_t locVal{0};
+
+   for(size_t i{0}; (i < len) && (i < 5); i++){
+      locVal |= static_cast<uint32_t>(bufPtr[i] & 0x7F) << (7 * i);
+      if((bufPtr[i] & 0x80) == 0){
+         if((i < 4) || (bufPtr[i] <= 0x0F)){   // The fifth byte holds only the 4 most significant bits
+            val = locVal;
+            result = i + 1;
+         }
+         break;
+      }
+   }
+
+   return result;
+}
+
+static size_t _vrntWrt(uint8_t* bufPtr, uint32_t val){
+   size_t result{0};
+
+   while(val >= 0x80){
+      bufPtr[result++] = static_cast<uint8_t>(val | 0x80);
+      val >>= 7;
+   }
+   bufPtr[result++] = static_cast<uint8_t>(val);
+
+   return result;
+}
+
+static uint32_t _zzEnc(const uint32_t &delta){
+
+   return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+static uint32_t _zzDec(const uint32_t &val){
+
+   return (val >> 1) ^ (0 - (val & 1));
+}
+
+//==========================================================>>
+
+ClickTelemetryEncoder::ClickTelemetryEncoder(const size_t &chnlsQty, const uint16_t &keyFrmIntvl)
+:_keyFrmIntvl{keyFrmIntvl}
+{
+   size_t dirtyWrdsQty{(chnlsQty + 31) / 32};
+   size_t smryWrdsQty{(dirtyWrdsQty + 31) / 32};
+
+   if((chnlsQty > 0) && (chnlsQty <= _tlmChnlsMax)){
+      _dirtyArr = new(std::nothrow) std::atomic<uint32_t>[dirtyWrdsQty];
+      _smryArr = new(std::nothrow) std::atomic<uint32_t>[smryWrdsQty];
+      _srcArr = new(std::nothrow) const std::atomic<int32_t>*[chnlsQty]();
+      _lastArr = new(std::nothrow) int32_t[chnlsQty]();
+      if((_dirtyArr != nullptr) && (_smryArr != nullptr) && (_srcArr != nullptr) && (_lastArr != nullptr)){
+         for(size_t i{0}; i < dirtyWrdsQty; i++)
+            _dirtyArr[i].store(0, std::memory_order_relaxed);
+         for(size_t i{0}; i < smryWrdsQty; i++)
+            _smryArr[i].store(0, std::memory_order_relaxed);
+         _dirtyWrdsQty = dirtyWrdsQty;
+         _smryWrdsQty = smryWrdsQty;
+         _chnlsQty = chnlsQty;
+      }
+   }
+}
+
+ClickTelemetryEncoder::~ClickTelemetryEncoder()
+{
+   delete [] _dirtyArr;
+   delete [] _smryArr;
+   delete [] _srcArr;
+   delete [] _lastArr;
+}
+
+bool ClickTelemetryEncoder::bindChannel(const size_t &chnl, const std::atomic<int32_t>* srcPtr){
+   bool result{false};
+
+   if(chnl < _chnlsQty){
+      if((_srcArr[chnl] == nullptr) && (srcPtr != nullptr))
+         _bndQty++;
+      else if((_srcArr[chnl] != nullptr) && (srcPtr == nullptr))
+         _bndQty--;
+      _srcArr[chnl] = srcPtr;
+      _keyRqst.store(true);
+      result = true;
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryEncoder::buildFrame(uint8_t* bufPtr, const size_t &bufSz){
+   size_t result{0};
+   size_t pldLen{0};
+   size_t maxPldLen{0};
+   bool keyFrm{false};
+   uint16_t crc{0};
+
+   if((_chnlsQty > 0) && (bufPtr != nullptr) && (bufSz > (_tlmHdrSz + _tlmCrcSz))){
+      maxPldLen = bufSz - (_tlmHdrSz + _tlmCrcSz);
+      if(maxPldLen > _tlmPldMax)
+         maxPldLen = _tlmPldMax;
+      keyFrm = _keyRqst.load() || ((_keyFrmIntvl != 0) && (_dltFrmsQty >= _keyFrmIntvl));
+      if(keyFrm){
+         if((_bndQty * _tlmEntryMax) <= maxPldLen){   // The key frame must be complete, it's checked for its worst case size before any channel is consumed
+            _keyRqst.store(false);
+            pldLen = _bldKeyPld(bufPtr + _tlmHdrSz);
+            _dltFrmsQty = 0;
+            result = 1;
+         }
+      }
+      else{
+         pldLen = _bldDltPld(bufPtr + _tlmHdrSz, maxPldLen);
+         if(pldLen > 0){
+            _dltFrmsQty++;
+            result = 1;
+         }
+      }
+      if(result != 0){
+         bufPtr[0] = _tlmSync;
+         bufPtr[1] = static_cast<uint8_t>(pldLen);
+         bufPtr[2] = static_cast<uint8_t>(pldLen >> 8);
+         bufPtr[3] = _seq++;
+         bufPtr[4] = keyFrm?_tlmTypeKey:_tlmTypeDlt;
+         crc = ccCrc16(bufPtr + 1, _tlmHdrSz - 1 + pldLen);
+         bufPtr[_tlmHdrSz + pldLen] = static_cast<uint8_t>(crc);
+         bufPtr[_tlmHdrSz + pldLen + 1] = static_cast<uint8_t>(crc >> 8);
+         result = _tlmHdrSz + pldLen + _tlmCrcSz;
+      }
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryEncoder::getChnlsQty(){
+
+   return _chnlsQty;
+}
+
+size_t ClickTelemetryEncoder::getMaxFrameSize(){
+
+   return _tlmHdrSz + (_chnlsQty * _tlmEntryMax) + _tlmCrcSz;
+}
+
+void IRAM_ATTR ClickTelemetryEncoder::markChanged(const size_t &chnl){
+   if(chnl < _chnlsQty){
+      _dirtyArr[chnl >> 5].fetch_or(1UL << (chnl & 31));   // The summary bit is set after the channel bit, so a summary bit found clear by the builder implies no pending channel bit was missed
+      _smryArr[chnl >> 10].fetch_or(1UL << ((chnl >> 5) & 31));
+   }
+
+   return;
+}
+
+void ClickTelemetryEncoder::requestKeyFrame(){
+   _keyRqst.store(true);
+
+   return;
+}
+
+size_t ClickTelemetryEncoder::_bldDltPld(uint8_t* bufPtr, const size_t &maxLen){
+   size_t result{0};
+   size_t nxtChnl{0};
+   size_t chnl{0};
+   size_t dirtyWrd{0};
+   uint32_t smryBits{0};
+   uint32_t dirtyBits{0};
+   uint32_t delta{0};
+   int32_t curVal{0};
+   bool bufFull{false};
+
+   for(size_t smryWrd{0}; (smryWrd < _smryWrdsQty) && !bufFull; smryWrd++){
+      if(_smryArr[smryWrd].load(std::memory_order_relaxed) == 0)
+         continue;
+      smryBits = _smryArr[smryWrd].exchange(0);
+      while((smryBits != 0) && !bufFull){
+         dirtyWrd = (smryWrd << 5) + __builtin_ctz(smryBits);
+         smryBits &= smryBits - 1;
+         dirtyBits = _dirtyArr[dirtyWrd].exchange(0);   // The channel bits are cleared before the values are read, a modification made after the reading marks the channel again
+         while(dirtyBits != 0){
+            if((result + _tlmEntryMax) > maxLen){   // The channels pending are marked again for the next frame
+               _dirtyArr[dirtyWrd].fetch_or(dirtyBits);
+               _smryArr[smryWrd].fetch_or(smryBits | (1UL << (dirtyWrd & 31)));
+               bufFull = true;
+               break;
+            }
+            chnl = (dirtyWrd << 5) + __builtin_ctz(dirtyBits);
+            dirtyBits &= dirtyBits - 1;
+            if(_srcArr[chnl] != nullptr){
+               curVal = _srcArr[chnl]->load(std::memory_order_acquire);
+               delta = static_cast<uint32_t>(curVal) - static_cast<uint32_t>(_lastArr[chnl]);
+               if(delta != 0){
+                  result += _vrntWrt(bufPtr + result, static_cast<uint32_t>(chnl - nxtChnl));
+                  result += _vrntWrt(bufPtr + result, _zzEnc(delta));
+                  _lastArr[chnl] = curVal;
+                  nxtChnl = chnl + 1;
+               }
+            }
+         }
+      }
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryEncoder::_bldKeyPld(uint8_t* bufPtr){
+   size_t result{0};
+   size_t nxtChnl{0};
+   int32_t curVal{0};
+
+   for(size_t i{0}; i < _smryWrdsQty; i++)
+      _smryArr[i].store(0);
+   for(size_t i{0}; i < _dirtyWrdsQty; i++)
+      _dirtyArr[i].store(0);
+   for(size_t chnl{0}; chnl < _chnlsQty; chnl++){
+      if(_srcArr[chnl] != nullptr){
+         curVal = _srcArr[chnl]->load(std::memory_order_acquire);
+         result += _vrntWrt(bufPtr + result, static_cast<uint32_t>(chnl - nxtChnl));
+         result += _vrntWrt(bufPtr + result, _zzEnc(static_cast<uint32_t>(curVal)));
+         _lastArr[chnl] = curVal;
+         nxtChnl = chnl + 1;
+      }
+      else
+         _lastArr[chnl] = 0;
+   }
+
+   return result;
+}
+
+//==========================================================>>
+
+ClickTelemetryDecoder::ClickTelemetryDecoder(const size_t &chnlsQty)
+{
+   size_t frmBufSz{_tlmHdrSz + (chnlsQty * _tlmEntryMax) + _tlmCrcSz};
+
+   if((chnlsQty > 0) && (chnlsQty <= _tlmChnlsMax)){
+      _valsArr = new(std::nothrow) int32_t[chnlsQty]();
+      _frmBufPtr = new(std::nothrow) uint8_t[frmBufSz];
+      if((_valsArr != nullptr) && (_frmBufPtr != nullptr)){
+         _frmBufSz = frmBufSz;
+         _chnlsQty = chnlsQty;
+      }
+   }
+}
+
+ClickTelemetryDecoder::~ClickTelemetryDecoder()
+{
+   delete [] _valsArr;
+   delete [] _frmBufPtr;
+}
+
+bool ClickTelemetryDecoder::decodeFrame(const uint8_t* frmPtr, const size_t &len){
+   bool result{false};
+
+   if((_chnlsQty > 0) && (frmPtr != nullptr)){
+      if(!_frmChk(frmPtr, len))
+         _frmErrQty++;
+      else
+         result = _frmApply(frmPtr, len);
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryDecoder::feed(const uint8_t* dataPtr, const size_t &len){
+   size_t result{0};
+   size_t pos{0};
+   size_t cpyQty{0};
+
+   if((_chnlsQty > 0) && (dataPtr != nullptr)){
+      while(pos < len){
+         if(_rcvdQty == 0){   // Bytes received out of a frame are discarded until the next sync byte
+            while((pos < len) && (dataPtr[pos] != _tlmSync))
+               pos++;
+         }
+         cpyQty = _frmBufSz - _rcvdQty;   // Never 0, the bytes left by the scan are less than a frame
+         if(cpyQty > (len - pos))
+            cpyQty = len - pos;
+         memcpy(_frmBufPtr + _rcvdQty, dataPtr + pos, cpyQty);
+         _rcvdQty += cpyQty;
+         pos += cpyQty;
+         result += _frmScan();
+      }
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryDecoder::getChnlsQty(){
+
+   return _chnlsQty;
+}
+
+uint32_t ClickTelemetryDecoder::getFrameErrQty(const bool &reset){
+   uint32_t result{_frmErrQty};
+
+   if(reset)
+      _frmErrQty = 0;
+
+   return result;
+}
+
+uint32_t ClickTelemetryDecoder::getLostQty(const bool &reset){
+   uint32_t result{_lostQty};
+
+   if(reset)
+      _lostQty = 0;
+
+   return result;
+}
+
+int32_t ClickTelemetryDecoder::getValue(const size_t &chnl){
+   int32_t result{0};
+
+   if(chnl < _chnlsQty)
+      result = _valsArr[chnl];
+
+   return result;
+}
+
+bool ClickTelemetryDecoder::isSynced(){
+
+   return _synced;
+}
+
+bool ClickTelemetryDecoder::_applyPld(const uint8_t* pldPtr, const size_t &pldLen, const bool &keyFrm){
+   bool result{true};
+   size_t pos{0};
+   size_t chnl{0};
+   size_t rdLen{0};
+   uint32_t gap{0};
+   uint32_t zzDelta{0};
+
+   while(result && (pos < pldLen)){   // The payload is validated completely before any value is modified
+      rdLen = _vrntRd(pldPtr + pos, pldLen - pos, gap);
+      if(rdLen != 0){
+         pos += rdLen;
+         rdLen = _vrntRd(pldPtr + pos, pldLen - pos, zzDelta);
+      }
+      if((rdLen == 0) || (gap >= (_chnlsQty - chnl)))
+         result = false;
+      else{
+         pos += rdLen;
+         chnl += gap + 1;
+      }
+   }
+   if(result){
+      if(keyFrm)
+         memset(_valsArr, 0, _chnlsQty * sizeof(int32_t));
+      pos = 0;
+      chnl = 0;
+      while(pos < pldLen){
+         pos += _vrntRd(pldPtr + pos, pldLen - pos, gap);
+         pos += _vrntRd(pldPtr + pos, pldLen - pos, zzDelta);
+         chnl += gap;
+         _valsArr[chnl] = static_cast<int32_t>(static_cast<uint32_t>(_valsArr[chnl]) + _zzDec(zzDelta));
+         chnl++;
+      }
+   }
+
+   return result;
+}
+
+bool ClickTelemetryDecoder::_frmApply(const uint8_t* frmPtr, const size_t &len){
+   bool result{false};
+   uint8_t seq{frmPtr[3]};
+   bool keyFrm{frmPtr[4] == _tlmTypeKey};
+
+   if(_synced && (seq != static_cast<uint8_t>(_lastSeq + 1))){
+      _lostQty += static_cast<uint8_t>(seq - _lastSeq - 1);
+      _synced = false;
+   }
+   if(keyFrm || _synced){
+      result = _applyPld(frmPtr + _tlmHdrSz, len - (_tlmHdrSz + _tlmCrcSz), keyFrm);
+      if(result)
+         _synced = true;
+      else
+         _frmErrQty++;
+   }
+   _lastSeq = seq;
+
+   return result;
+}
+
+bool ClickTelemetryDecoder::_frmChk(const uint8_t* frmPtr, const size_t &len){
+   bool result{false};
+   size_t pldLen{0};
+
+   if((len >= (_tlmHdrSz + _tlmCrcSz)) && (frmPtr[0] == _tlmSync)){
+      pldLen = frmPtr[1] | (static_cast<size_t>(frmPtr[2]) << 8);
+      if((len == (_tlmHdrSz + pldLen + _tlmCrcSz)) && (frmPtr[4] <= _tlmTypeKey))
+         result = ((frmPtr[len - 2] | (frmPtr[len - 1] << 8)) == ccCrc16(frmPtr + 1, len - 3));
+   }
+
+   return result;
+}
+
+size_t ClickTelemetryDecoder::_frmScan(){
+   size_t result{0};
+   size_t strt{0};
+   size_t frmLen{0};
+   bool done{false};
+
+   while(!done){
+      done = true;
+      while((strt < _rcvdQty) && (_frmBufPtr[strt] != _tlmSync))
+         strt++;
+      if((_rcvdQty - strt) >= 3){
+         frmLen = _tlmHdrSz + (_frmBufPtr[strt + 1] | (static_cast<size_t>(_frmBufPtr[strt + 2]) << 8)) + _tlmCrcSz;
+         if(frmLen > _frmBufSz){   // No valid frame is that long, the sync byte was part of the data
+            _frmErrQty++;
+            strt++;
+            done = false;
+         }
+         else if((_rcvdQty - strt) >= frmLen){
+            if(_frmChk(_frmBufPtr + strt, frmLen)){
+               if(_frmApply(_frmBufPtr + strt, frmLen))
+                  result++;
+               strt += frmLen;
+            }
+            else{   // A corrupted frame, or a sync byte that was part of the data: the frames might start in the bytes that follow it
+               _frmErrQty++;
+               strt++;
+            }
+            done = false;
+         }
+      }
+   }
+   if(strt != 0){   // The bytes of the frame not completed yet are kept at the start of the buffer
+      memmove(_frmBufPtr, _frmBufPtr + strt, _rcvdQty - strt);
+      _rcvdQty -= strt;
+   }
+
+   return result;
+}
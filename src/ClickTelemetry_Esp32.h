@@ -0,0 +1,261 @@
+/**
+ ******************************************************************************
+ * @file ClickTelemetry_Esp32.h
+ *
+ * @brief Header file for the ClickTelemetry classes of the ClickCounter_Esp32 library
+ *
+ * @details The ClickTelemetry classes encode and decode the values of many counters as a compact binary stream, to export them through slow links (UART, RS-485, radio modules). Each frame carries only the counters (channels) that changed since the previous frame, as the difference from the last value sent, so a frame for a few changed counters takes a few bytes, independently of the quantity of counters exported.
+ *
+ * The classes don't depend on the Arduino or ESP-IDF frameworks, so the decoder, and the encoder, might be built for a host computer (i.e. a Linux line PC receiving the stream) with any C++11 compiler, with no more than this file and its code file.
+ *
+ * Frame format, all multibyte fixed size fields are little endian:
+ * |Field|Size|Content|
+ * |---|---|---|
+ * |Sync|1|0xA5|
+ * |Length|2|Quantity of payload bytes|
+ * |Sequence|1|Frame sequence number, incremented by 1 for each frame built, wrapping from 255 to 0|
+ * |Type|1|0: Delta frame, 1: Key frame|
+ * |Payload|Length|Channel entries, in increasing channel order|
+ * |CRC|2|CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF) of the Length, Sequence, Type and Payload fields|
+ *
+ * Each channel entry is made of two unsigned LEB128 varints:
+ * - The channel number minus the number of the previous entry channel plus 1 (for the first entry, the channel number), so consecutive channels take a single byte.
+ * - The zigzag encoded difference between the channel value and the value previously sent for it. In a key frame the difference is taken from 0, so the entry carries the absolute value, and the channels not included are 0.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino, or none
+ * Platform: ESP32, or any C++11 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _CLICKTELEMETRY_ESP32_H_
+#define _CLICKTELEMETRY_ESP32_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @brief Calculates the CRC-16/CCITT-FALSE (polynomial 0x1021) of a data block.
+ *
+ * Used as the telemetry frames check value, and as the persistence log records and checkpoints check value, see ClickCountPersist.
+ *
+ * @param dataPtr Pointer to the data block.
+ * @param len Quantity of bytes of the data block.
+ * @param crc (Optional) Initial value, the CRC of the preceding data when a block is checked in several parts. If not provided the CRC-16/CCITT-FALSE initial value 0xFFFF will be used.
+ *
+ * @return The CRC of the data block.
+ */
+uint16_t ccCrc16(const void* dataPtr, const size_t &len, const uint16_t &crc = 0xFFFF);
+
+/**
+ * @class ClickTelemetryEncoder
+ *
+ * @brief Models a binary telemetry frames encoder for a fixed quantity of channels.
+ *
+ * Each channel is bound to an atomic count value (the count of a ClickCounter object, a ClickCounterBank slot, or any std::atomic<int32_t> of the application). The counter objects mark their channel as changed on every count modification, setting a bit in a two levels bitmap: a single atomic operation in each level, ISR safe and lock-free. Building a frame visits only the marked channels, so its cost is proportional to the quantity of changed channels, and not to the quantity of channels exported.
+ *
+ * A key frame, with the absolute values of all the bound channels, is built as the first frame, every keyFrmIntvl frames if configured, and when requested by requestKeyFrame(), so a decoder started or desynchronized in the middle of the stream recovers the values.
+ *
+ * @note Only one task must build frames. The channels might be marked by any quantity of tasks and ISRs simultaneously.
+ */
+class ClickTelemetryEncoder{
+private:
+   size_t _chnlsQty{0};
+   size_t _bndQty{0};
+   size_t _dirtyWrdsQty{0};
+   size_t _smryWrdsQty{0};
+   std::atomic<uint32_t>* _dirtyArr{nullptr};
+   std::atomic<uint32_t>* _smryArr{nullptr};
+   const std::atomic<int32_t>** _srcArr{nullptr};
+   int32_t* _lastArr{nullptr};
+   uint16_t _keyFrmIntvl{0};
+   uint16_t _dltFrmsQty{0};
+   uint8_t _seq{0};
+   std::atomic<bool> _keyRqst{true};
+
+   size_t _bldDltPld(uint8_t* bufPtr, const size_t &maxLen);
+   size_t _bldKeyPld(uint8_t* bufPtr);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param chnlsQty Quantity of channels to encode, up to 6553, the quantity of channels whose worst case entries fit in a single frame.
+    * @param keyFrmIntvl (Optional) Quantity of delta frames built between key frames. A value of 0 builds key frames only when requested by requestKeyFrame(). If not provided a value of 0 will be used.
+    *
+    * @note If the arrays can't be allocated, or chnlsQty exceeds the maximum, the encoder is built with no channels, and getChnlsQty() will return 0.
+    */
+   ClickTelemetryEncoder(const size_t &chnlsQty, const uint16_t &keyFrmIntvl = 0);
+   /**
+    * @brief Class destructor.
+    */
+   ~ClickTelemetryEncoder();
+   /**
+    * @brief Binds a channel to an atomic count value.
+    *
+    * This method is invoked by ClickCounter::setTelemetry(ClickTelemetryEncoder*, const size_t &) and ClickCounterBank::setTelemetry(ClickTelemetryEncoder*, const size_t &), and might be invoked by the application to export other values. The value source must exist while it's bound. A key frame is requested, so the decoder gets the new channel value.
+    *
+    * @param chnl Number of the channel.
+    * @param srcPtr Pointer to the atomic value to encode for the channel, nullptr to unbind the channel.
+    *
+    * @retval true The channel exists, it was bound or unbound.
+    * @retval false The channel doesn't exist.
+    *
+    * @warning The channels must not be bound or unbound while a frame is being built.
+    */
+   bool bindChannel(const size_t &chnl, const std::atomic<int32_t>* srcPtr);
+   /**
+    * @brief Builds the next frame.
+    *
+    * A delta frame includes the marked channels whose value differs from the value last sent. If the buffer is not big enough for all of them, the channels that didn't fit are kept marked, and will be included in the next frame. A buffer of getMaxFrameSize() bytes is never exceeded.
+    *
+    * @param bufPtr Pointer to the buffer where the frame will be built.
+    * @param bufSz Size of the bufPtr buffer. A key frame is built only if the buffer size is at least getMaxFrameSize().
+    *
+    * @return The size in bytes of the frame built, ready to be sent. 0 if no channel changed since the last frame, or a pending key frame doesn't fit in the buffer, no frame was built.
+    */
+   size_t buildFrame(uint8_t* bufPtr, const size_t &bufSz);
+   /**
+    * @brief Returns the quantity of channels of the encoder.
+    *
+    * @return The quantity of channels, 0 if the arrays couldn't be allocated.
+    */
+   size_t getChnlsQty();
+   /**
+    * @brief Returns the worst case frame size.
+    *
+    * @return The size in bytes of the biggest frame the encoder might build, the size of a key frame with all the channels bound and with the values needing the longest encodings.
+    */
+   size_t getMaxFrameSize();
+   /**
+    * @brief Marks a channel as changed.
+    *
+    * This method is invoked by the counting methods of the ClickCounter and ClickCounterBank objects bound, after the count is modified. It's ISR safe and never blocks.
+    *
+    * @param chnl Number of the channel.
+    */
+   void markChanged(const size_t &chnl);
+   /**
+    * @brief Requests the next frame to be a key frame.
+    *
+    * Use it when the receiving side reports it lost the synchronization, i.e. after the line PC software restarts.
+    */
+   void requestKeyFrame();
+};
+
+//==========================================================>>
+
+/**
+ * @class ClickTelemetryDecoder
+ *
+ * @brief Models a binary telemetry frames decoder for a fixed quantity of channels.
+ *
+ * The decoder might be fed with complete frames, or with the raw bytes received from the link in chunks of any size, resynchronizing by itself after corrupted or lost bytes. The delta frames are applied only while the decoder is synchronized: after a sequence gap the values are kept unmodified until the next key frame is received.
+ */
+class ClickTelemetryDecoder{
+private:
+   size_t _chnlsQty{0};
+   int32_t* _valsArr{nullptr};
+   uint8_t* _frmBufPtr{nullptr};
+   size_t _frmBufSz{0};
+   size_t _rcvdQty{0};
+   bool _synced{false};
+   uint8_t _lastSeq{0};
+   uint32_t _frmErrQty{0};
+   uint32_t _lostQty{0};
+
+   bool _applyPld(const uint8_t* pldPtr, const size_t &pldLen, const bool &keyFrm);
+   bool _frmApply(const uint8_t* frmPtr, const size_t &len);
+   bool _frmChk(const uint8_t* frmPtr, const size_t &len);
+   size_t _frmScan();
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param chnlsQty Quantity of channels to decode, must be the same quantity of channels of the encoder.
+    *
+    * @note If the arrays can't be allocated the decoder is built with no channels, and getChnlsQty() will return 0.
+    */
+   ClickTelemetryDecoder(const size_t &chnlsQty);
+   /**
+    * @brief Class destructor.
+    */
+   ~ClickTelemetryDecoder();
+   /**
+    * @brief Decodes a complete frame.
+    *
+    * @param frmPtr Pointer to the first byte (the sync byte) of the frame.
+    * @param len Size of the frame in bytes.
+    *
+    * @retval true The frame was valid and its values were applied.
+    * @retval false The frame was invalid (counted as a frame error), or it was a delta frame received while not synchronized. No value was modified.
+    */
+   bool decodeFrame(const uint8_t* frmPtr, const size_t &len);
+   /**
+    * @brief Feeds the decoder with bytes received from the link.
+    *
+    * The bytes are accumulated until a complete frame is received, and then the frame is decoded. Bytes received out of a frame are discarded until the next sync byte. If the frame started by a sync byte has an invalid length or CRC, the search of the next sync byte resumes right after that sync byte, so a data byte taken as a sync byte, or a corrupted frame, doesn't make the valid frames received after it be lost.
+    *
+    * @param dataPtr Pointer to the received bytes.
+    * @param len Quantity of received bytes.
+    *
+    * @return The quantity of frames whose values were applied.
+    */
+   size_t feed(const uint8_t* dataPtr, const size_t &len);
+   /**
+    * @brief Returns the quantity of channels of the decoder.
+    *
+    * @return The quantity of channels, 0 if the arrays couldn't be allocated.
+    */
+   size_t getChnlsQty();
+   /**
+    * @brief Returns the quantity of frames discarded for errors.
+    *
+    * A frame is discarded if its CRC doesn't match, its length exceeds the maximum for the channels quantity, or its payload is malformed (i.e. references a channel that doesn't exist).
+    *
+    * @param reset (Optional) Indicates if the errors counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of frames discarded since the decoder was built or since the last reset.
+    */
+   uint32_t getFrameErrQty(const bool &reset = false);
+   /**
+    * @brief Returns the quantity of frames lost.
+    *
+    * The frames lost are detected by the gaps in the frames sequence numbers.
+    *
+    * @param reset (Optional) Indicates if the lost frames counter must be restarted to 0 after reading it. If not provided the counter will not be restarted.
+    *
+    * @return The quantity of frames lost since the decoder was built or since the last reset.
+    */
+   uint32_t getLostQty(const bool &reset = false);
+   /**
+    * @brief Returns a channel value.
+    *
+    * @param chnl Number of the channel.
+    *
+    * @return The last value decoded for the channel, 0 if the channel doesn't exist.
+    */
+   int32_t getValue(const size_t &chnl);
+   /**
+    * @brief Returns the synchronization status of the decoder.
+    *
+    * @retval true A key frame was received, and no frame was lost since then. The values are those of the last frame.
+    * @retval false No key frame was received yet, or a frame was lost since the last key frame. The values are not reliable until a key frame is received.
+    */
+   bool isSynced();
+};
+
+#endif   // _CLICKTELEMETRY_ESP32_H_
@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @file ShardedClickCounter_Esp32.cpp
+ *
+ * @brief Code file for the ShardedClickCounter class of the ClickCounter_Esp32 library
+ *
+ * @details The ShardedClickCounter class models a counter intended to be modified simultaneously by tasks running in different cores of the MCU, keeping one count shard per core.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <ShardedClickCounter_Esp32.h>
+
+ShardedClickCounter::ShardedClickCounter(int32_t countMin, int32_t countMax, int32_t rsrvSlack)
+:_countMin{countMin}, _countMax{countMax}, _rsrvSlack{rsrvSlack}
+{
+   portMUX_INITIALIZE(&_poolMux);
+   for(int i{0}; i < portNUM_PROCESSORS; i++){
+      portMUX_INITIALIZE(&_shards[i].shardMux);
+      _shards[i].delta.store(0);
+      _shards[i].upAlw = 0;
+      _shards[i].dnAlw = 0;
+   }
+   if(_rsrvSlack < 0)
+      _rsrvSlack = 0;
+}
+
+ShardedClickCounter::~ShardedClickCounter()
+{
+}
+
+bool ShardedClickCounter::begin(const int32_t &startVal){
+   bool result{false};
+
+   if(!_begun){
+      if(_countMin < _countMax){
+         _begun = true;
+         result = countRestart(startVal);
+         if(result)
+            _beginStartVal = startVal;
+         else
+            _begun = false;
+      }
+   }
+
+   return result;
+}
+
+bool ShardedClickCounter::countDown(const int32_t &qty){
+
+   return _countAdd(qty, false);
+}
+
+bool ShardedClickCounter::countReset(){
+
+   return countRestart(_beginStartVal);
+}
+
+bool ShardedClickCounter::countRestart(const int32_t &restartValue){
+   bool result{false};
+
+   if(_begun && (restartValue >= _countMin) && (restartValue <= _countMax)){
+      portENTER_CRITICAL(&_poolMux);
+      _seq.fetch_add(1);
+      for(int i{0}; i < portNUM_PROCESSORS; i++){
+         portENTER_CRITICAL(&_shards[i].shardMux);
+         _shards[i].delta.store(0);
+         _shards[i].upAlw = 0;
+         _shards[i].dnAlw = 0;
+         portEXIT_CRITICAL(&_shards[i].shardMux);
+      }
+      _base.store(restartValue);
+      _poolUp = static_cast<int64_t>(_countMax) - restartValue;
+      _poolDn = static_cast<int64_t>(restartValue) - _countMin;
+      _seq.fetch_add(1);
+      portEXIT_CRITICAL(&_poolMux);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShardedClickCounter::countUp(const int32_t &qty){
+
+   return _countAdd(qty, true);
+}
+
+bool ShardedClickCounter::end(){
+   bool result{false};
+
+   if(_begun){
+      _begun = false;
+      result = true;
+   }
+
+   return result;
+}
+
+int32_t ShardedClickCounter::getCount(){
+   uint32_t result{0};
+   uint32_t seqBfr{0};
+
+   do{
+      seqBfr = _seq.load();
+      result = static_cast<uint32_t>(_base.load());
+      for(int i{0}; i < portNUM_PROCESSORS; i++)
+         result += static_cast<uint32_t>(_shards[i].delta.load());   // A shard contribution may exceed the int32_t range between folds, the modulo 2^32 sum is exact as the count is always in range
+   }while((seqBfr & 1) || (seqBfr != _seq.load()));   // Retry if shards were folded into the base while reading
+
+   return static_cast<int32_t>(result);
+}
+
+int32_t ShardedClickCounter::getMaxCountVal(){
+
+   return _countMax;
+}
+
+int32_t ShardedClickCounter::getMinCountVal(){
+
+   return _countMin;
+}
+
+int32_t ShardedClickCounter::getStartVal(){
+
+   return _beginStartVal;
+}
+
+bool ShardedClickCounter::_countAdd(const int32_t &qty, const bool &up){
+   bool result{false};
+   int64_t locQty{qty};
+   ccShard_t* shardPtr{nullptr};
+
+   if(locQty < 0)
+      locQty = -locQty;
+   if(_begun && (locQty > 0)){
+      shardPtr = &_shards[xPortGetCoreID()];
+      portENTER_CRITICAL(&shardPtr->shardMux);
+      result = _useAlw(*shardPtr, locQty, up);
+      portEXIT_CRITICAL(&shardPtr->shardMux);
+      if(!result){
+         portENTER_CRITICAL(&_poolMux);
+         result = _rsrvAlw(*shardPtr, locQty, up);
+         portEXIT_CRITICAL(&_poolMux);
+      }
+   }
+
+   return result;
+}
+
+bool ShardedClickCounter::_rsrvAlw(ccShard_t &shard, const int64_t &qty, const bool &up){
+   bool result{false};
+   int64_t &pool = up?_poolUp:_poolDn;
+   int64_t grant{0};
+
+   if(pool < qty)
+      _rtrnAllAlw();
+   if(pool >= qty){
+      grant = qty + _rsrvSlack;
+      if(grant > pool)
+         grant = pool;
+      pool -= grant;
+      portENTER_CRITICAL(&shard.shardMux);
+      if(up)
+         shard.upAlw += grant;
+      else
+         shard.dnAlw += grant;
+      result = _useAlw(shard, qty, up);
+      portEXIT_CRITICAL(&shard.shardMux);
+   }
+
+   return result;
+}
+
+void ShardedClickCounter::_rtrnAllAlw(){
+   _seq.fetch_add(1);
+   for(int i{0}; i < portNUM_PROCESSORS; i++){
+      portENTER_CRITICAL(&_shards[i].shardMux);
+      _poolUp += _shards[i].upAlw;
+      _poolDn += _shards[i].dnAlw;
+      _shards[i].upAlw = 0;
+      _shards[i].dnAlw = 0;
+      _base.fetch_add(_shards[i].delta.exchange(0));   // Fold the shard into the base to keep the shard contributions from overflowing
+      portEXIT_CRITICAL(&_shards[i].shardMux);
+   }
+   _seq.fetch_add(1);
+
+   return;
+}
+
+bool ShardedClickCounter::_useAlw(ccShard_t &shard, const int64_t &qty, const bool &up){
+   bool result{false};
+
+   if(up){
+      if(shard.upAlw >= qty){
+         shard.upAlw -= qty;
+         shard.dnAlw += qty;
+         shard.delta.fetch_add(static_cast<int32_t>(qty), std::memory_order_relaxed);
+         result = true;
+      }
+   }
+   else{
+      if(shard.dnAlw >= qty){
+         shard.dnAlw -= qty;
+         shard.upAlw += qty;
+         shard.delta.fetch_sub(static_cast<int32_t>(qty), std::memory_order_relaxed);
+         result = true;
+      }
+   }
+
+   return result;
+}
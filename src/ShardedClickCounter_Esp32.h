@@ -0,0 +1,174 @@
+/**
+ ******************************************************************************
+ * @file ShardedClickCounter_Esp32.h
+ *
+ * @brief Header file for the ShardedClickCounter class of the ClickCounter_Esp32 library
+ *
+ * @details The ShardedClickCounter class models a counter intended to be modified simultaneously by tasks running in different cores of the MCU. The count is split in one shard per core, each task modifies only the shard of the core it's running in, so tasks running in different cores don't compete for the same lock. The count valid range is enforced through a reservation scheme, where each shard holds an allowance of counts it may add or subtract without consulting the other shards.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_Esp32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 1.0.0
+ *
+ * @date First release: 16/10/2026
+ *       Last update:   16/10/2026 12:00 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _SHARDEDCLICKCOUNTER_ESP32_H_
+#define _SHARDEDCLICKCOUNTER_ESP32_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief Size in bytes of the memory blocks each shard is aligned and padded to.
+ *
+ * Each shard is placed in its own block so the writes made by a core don't invalidate the cached shard of the other core (false sharing). The default covers the cache lines of the usual host and MCU cores, it can be redefined as a global build flag.
+ */
+#ifndef CC_SHARD_ALIGN
+#define CC_SHARD_ALIGN 64
+#endif
+
+/**
+ * @class ShardedClickCounter
+ *
+ * @brief Models a display-less counter with one count shard per MCU core.
+ *
+ * Each shard keeps the count modifications made by the tasks running in its core, and two allowances: the quantity it may still add to the count (up allowance) and the quantity it may still subtract (down allowance) without getting the count out of the valid range. Counting up consumes up allowance and generates the same quantity of down allowance, and vice versa, so the shard allowances always keep the sum of the count and of all the outstanding allowances inside the valid range.
+ * When a shard has not enough allowance to execute a counting operation it reserves a new one from a common pool, reserving **rsrvSlack** counts more than needed to serve the next operations locally. When the pool can't provide the allowance needed the allowances of all the shards are returned to the pool and the reservation is retried, so a counting operation only fails when the real count would get out of the valid range.
+ * The count value is calculated on read, adding the contributions of all the shards.
+ */
+class ShardedClickCounter{
+private:
+   struct alignas(CC_SHARD_ALIGN) ccShard_t{   // Aligned to the block size, the compiler pads its size to a multiple of it
+      portMUX_TYPE shardMux;
+      std::atomic<int32_t> delta;
+      int64_t upAlw;
+      int64_t dnAlw;
+   };
+
+   ccShard_t _shards[portNUM_PROCESSORS];
+   alignas(CC_SHARD_ALIGN) portMUX_TYPE _poolMux;   // The pool and the read sequence don't share the last shard block
+   int64_t _poolUp{0};
+   int64_t _poolDn{0};
+   std::atomic<int32_t> _base{0};
+   std::atomic<uint32_t> _seq{0};
+
+   int32_t _countMin{0};
+   int32_t _countMax{0};
+   int32_t _rsrvSlack{0};
+   int32_t _beginStartVal{0};
+   bool _begun{false};
+
+   bool _countAdd(const int32_t &qty, const bool &up);
+   bool _rsrvAlw(ccShard_t &shard, const int64_t &qty, const bool &up);
+   void _rtrnAllAlw();
+   bool _useAlw(ccShard_t &shard, const int64_t &qty, const bool &up);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param countMin Left side limit (minimum) for the counter values valid range segment. The valid count range minimum value is included as a valid counting value.
+    * @param countMax Right side limit (maximum) for the counter values valid range segment. The valid count range maximum value is included as a valid counting value.
+    * @param rsrvSlack (Optional) Quantity of counts reserved for each shard in excess of the needed for the current operation when the shard runs out of allowance. Bigger values reduce the access to the common pool, smaller values reduce the chances of a shard holding the allowance other shard needs. If not provided a value of 64 will be used.
+    */
+   ShardedClickCounter(int32_t countMin, int32_t countMax, int32_t rsrvSlack = 64);
+   /**
+    * @brief Class destructor.
+    */
+   ~ShardedClickCounter();
+   /**
+    * @brief Sets the basic required parameters for the object to start working.
+    *
+    * @param startVal (Optional) Initial value for the counter, if no parameter is provided a default value of 0 (zero) will be used. The parameter must be within the valid range provided as constructor parameters.
+    *
+    * @return The success in setting the needed attribute values for the object to start working.
+    * @retval true The object was not previously begun, the valid range is correctly defined and the startVal parameter is in the valid range. The object is started.
+    * @retval false One of the previously described conditions failed, the object is not ready to be used.
+    */
+   bool begin(const int32_t &startVal = 0);
+   /**
+    * @brief Decrements the value of the current count.
+    *
+    * See ClickCounter::countDown(const int32_t &). The decrement is made in the shard of the core the calling task is running in.
+    *
+    * @param qty Optional integer value, its **absolute** value will be decremented from the current count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.
+    *
+    * @retval true The count could be decremented by the corresponding value without setting count out of range.
+    * @retval false The qty parameter was equal to 0, the object was not begun, or the count couldn't be decremented by the parameter value without getting out of range. The counter will keep its current value.
+    */
+   bool countDown(const int32_t &qty = 1);
+   /**
+    * @brief Resets the counter to the value provided when the counter was started with the begin(const int32_t &) method.
+    *
+    * @return See countRestart(const int32_t &)
+    */
+   bool countReset();
+   /**
+    * @brief Restarts the count from the value provided as parameter.
+    *
+    * All the shards contributions and allowances are cleared.
+    *
+    * @param restartValue Optional integer value, a value of 0 is set if no parameter is provided. The parameter must be in the range getMinCountVal() <= restartValue <= getMaxCountVal().
+    * @return true The object was begun and the parameter value was within valid range, count restart succeeded.
+    * @return false The object was not begun, or the parameter value was NOT within valid range, count restart failed.
+    */
+   bool countRestart(const int32_t &restartValue = 0);
+   /**
+    * @brief Increments the value of the current count.
+    *
+    * See ClickCounter::countUp(const int32_t &). The increment is made in the shard of the core the calling task is running in.
+    *
+    * @param qty Optional integer value, its **absolute** value will be incremented in the current count value. If no parameter is passed a value of one will be used. If qty = 0 the method will return false.
+    *
+    * @retval true The count could be incremented by the corresponding value without setting count out of range.
+    * @retval false The qty parameter was equal to 0, the object was not begun, or the count couldn't be incremented by the parameter value without getting out of range. The counter will keep its current value.
+    */
+   bool countUp(const int32_t &qty = 1);
+   /**
+    * @brief Disables the counter for further activities.
+    *
+    * @retval true The counter was active, and it was disabled for further actions.
+    * @retval false The counter was NOT active, no change of it's status was done.
+    */
+   bool end();
+   /**
+    * @brief Get the object's count value, adding the contributions of all the shards.
+    *
+    * @return int32_t The current count value of the object.
+    *
+    * @note The shards are read one after the other without stopping the counting tasks, so operations in progress while reading might or might not be reflected in the returned value.
+    */
+   int32_t getCount();
+   /**
+    * @brief Returns the Maximum Counter Value.
+    *
+    * @return The Maximum Counter Value
+    */
+   int32_t getMaxCountVal();
+   /**
+    * @brief Returns the Minimum Counter Value.
+    *
+    * @return The Minimum Counter Value
+    */
+   int32_t getMinCountVal();
+   /**
+    * @brief Returns the value that was used to begin() the object.
+    *
+    * @return startVal attribute value.
+    */
+   int32_t getStartVal();
+};
+
+#endif   // _SHARDEDCLICKCOUNTER_ESP32_H_
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterAlloc_test.cpp
+ *
+ * @brief Host tests of the ClickCounter heap use
+ *
+ * @details The global operator new is replaced by the ccAllocHook.h counting version, so any heap allocation made while counters are built, begun, modified, ended and destroyed fails the tests. The counters are built in static storage, in the stack and in memory provided by the test, as an application without heap would. The counters bound to a display are checked in every display format, the texts printed use the storage reserved by setDisplayFormat().
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <new>
+#include <type_traits>
+#include <ClickCounter_Esp32.h>
+#include <ClickCounterBank_Esp32.h>
+#include "ccAllocHook.h"
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+static ClickCounter stcCntr(-1000, 1000);   // Built before main(), as a global object of an application
+
+/**
+ * @brief Runs the counting paths of a begun counter, every modification is expected to succeed.
+ */
+static void cntPaths(ClickCounter &cntr){
+   ccBatchOp_t ops[3]{{ccOpUp, 5}, {ccOpDown, 2}, {ccOpToZero, 1}};
+   bool rslts[3]{};
+   BaseType_t xHigherPriorityTaskWoken{pdFALSE};
+
+   for(int i{0}; i < 100; i++){
+      CC_CHECK(cntr.countUp());
+      CC_CHECK(cntr.countUp(3));
+      CC_CHECK(cntr.countDown(2));
+      CC_CHECK(cntr.countToZero(1));
+   }
+   {
+      ShimIsrScope isr;
+
+      CC_CHECK(cntr.countUpFromISR(2, &xHigherPriorityTaskWoken));
+      CC_CHECK(cntr.countDownFromISR(1, &xHigherPriorityTaskWoken));
+   }
+   CC_CHECK(cntr.apply(ops, 3, rslts));
+   CC_CHECK(cntr.countRestart(7));
+   CC_CHECK_EQ(cntr.getCount(), 7);
+   CC_CHECK_EQ(cntr.snapshot().count, 7);
+   CC_CHECK(!cntr.countIsZero());
+   CC_CHECK(cntr.countReset());
+   CC_CHECK_EQ(cntr.getStartVal(), 0);
+
+   return;
+}
+//================================================>> Test helpers END
+
+CC_TEST(countersAreNotCopyable){
+   CC_CHECK(!std::is_copy_constructible<ClickCounter>::value);
+   CC_CHECK(!std::is_copy_assignable<ClickCounter>::value);
+   CC_CHECK(!std::is_copy_constructible<ClickCounterBank>::value);
+   CC_CHECK(!std::is_copy_assignable<ClickCounterBank>::value);
+}
+
+CC_TEST(staticCounterUsesNoHeap){
+   ccAllocs_t strtAllocs{ccAllocs()};
+
+   CC_CHECK(stcCntr.begin());
+   for(int cycle{0}; cycle < 10; cycle++)
+      cntPaths(stcCntr);
+   CC_CHECK(stcCntr.end());   // The range of an ended counter is cleared, it's not begun again
+   CC_CHECK_EQ(ccAllocs().qty, strtAllocs.qty);
+}
+
+CC_TEST(counterCyclesUseNoHeap){
+   alignas(ClickCounter) unsigned char cntrStrg[sizeof(ClickCounter)];   // Memory provided by the application
+   ClickCounter* cntrPtr{nullptr};
+   ccAllocs_t strtAllocs{ccAllocs()};
+
+   for(int cycle{0}; cycle < 10; cycle++){
+      ClickCounter stckCntr(-1000, 1000);
+      ClickCounter lckFreeCntr(-1000, 1000);
+
+      CC_CHECK(stckCntr.begin());
+      cntPaths(stckCntr);
+      CC_CHECK(stckCntr.end());
+      lckFreeCntr.setLockFree(true);
+      CC_CHECK(lckFreeCntr.begin());
+      cntPaths(lckFreeCntr);
+      CC_CHECK(lckFreeCntr.end());
+      cntrPtr = new(cntrStrg) ClickCounter(-1000, 1000);
+      CC_CHECK(cntrPtr->begin());
+      cntPaths(*cntrPtr);
+      CC_CHECK(cntrPtr->end());
+      cntrPtr->~ClickCounter();
+   }
+   CC_CHECK_EQ(ccAllocs().qty, strtAllocs.qty);
+   CC_CHECK_EQ(ccAllocs().bytes, strtAllocs.bytes);
+}
+
+CC_TEST(displayCountingUsesNoHeap){
+   SevenSegDisplays dsply(4);
+   ClickCounter cntCntr(&dsply);
+   ClickCounter scldCntr(&dsply);
+   ClickCounter pgsCntr(&dsply);
+   ccAllocs_t strtAllocs{};
+   std::string hiPgTxt{};
+
+   CC_CHECK(scldCntr.setDisplayFormat(ccFmtScaled));   // The texts storage is reserved here, before counting
+   CC_CHECK(pgsCntr.setDisplayFormat(ccFmtPages, 1000));
+   strtAllocs = ccAllocs();
+   CC_CHECK(cntCntr.begin());
+   cntPaths(cntCntr);
+   CC_CHECK_EQ(dsply.lastVal(), 0);
+   CC_CHECK(cntCntr.end());
+   CC_CHECK(scldCntr.begin());
+   cntPaths(scldCntr);
+   CC_CHECK(scldCntr.countRestart(-12345));
+   for(int i{0}; i < 100; i++)   // Each thousand counted changes the scaled text
+      CC_CHECK(scldCntr.countUp(250));
+   CC_CHECK(dsply.lastTxt() == " 12k");
+   CC_CHECK(scldCntr.end());
+   CC_CHECK(pgsCntr.begin(123456));
+   for(int i{0}; i < 20; i++){   // The pages alternate, the high order page is printed as a text
+      shimAdvanceTime(1000000);
+      CC_CHECK(pgsCntr.countUp(10000));
+      CC_CHECK(pgsCntr.pumpDisplay());
+      if(i == 18)
+         hiPgTxt = dsply.lastTxt();
+   }
+   CC_CHECK(hiPgTxt == "  31.");
+   CC_CHECK(pgsCntr.end());
+   CC_CHECK_EQ(ccAllocs().qty, strtAllocs.qty);
+}
+
+CC_TEST(defaultCounterUsesNoHeap){
+   ccAllocs_t strtAllocs{ccAllocs()};
+
+   for(int cycle{0}; cycle < 10; cycle++){
+      ClickCounter cntr;
+
+      CC_CHECK(!cntr.begin());   // Empty valid range
+      CC_CHECK(!cntr.countUp());
+   }
+   CC_CHECK_EQ(ccAllocs().qty, strtAllocs.qty);
+}
+
+CC_TEST(bankCountingUsesNoHeap){
+   ClickCounterBank bank(16, -1000, 1000);   // The slots arrays are the only allocations, made by the constructor
+   int32_t deltas[16]{};
+   int32_t vals[16]{};
+   ccAllocs_t strtAllocs{ccAllocs()};
+
+   for(int32_t &delta : deltas)
+      delta = 3;
+   CC_CHECK(bank.begin());
+   for(int cycle{0}; cycle < 10; cycle++){
+      CC_CHECK(bank.countUp(3, 2));
+      CC_CHECK(bank.countDown(4));
+      CC_CHECK(bank.addDeltas(deltas, 0, 16));
+      CC_CHECK_EQ(bank.snapshot(vals), 16U);
+      CC_CHECK(bank.countRestart(5, 9));
+      CC_CHECK(bank.countResetAll());
+   }
+   CC_CHECK(bank.end());
+   CC_CHECK_EQ(ccAllocs().qty, strtAllocs.qty);
+}
+
+CC_TEST_MAIN()
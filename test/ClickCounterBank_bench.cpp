@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterBank_bench.cpp
+ *
+ * @brief Host benchmark of the ClickCounterBank against individual ClickCounter objects
+ *
+ * @details For several quantities of counters, compares a ClickCounterBank of that many slots with the same quantity of begun ClickCounter objects:
+ * - footprint: the object sizes plus the rest of the heap bytes and allocations made to build and begin them, measured by the ccAllocHook.h counters.
+ * - bulk operations: reset all, snapshot all and add a vector of deltas, against a loop over the individual objects, in nanoseconds per counter.
+ * - single counter: countUp() of one counter after another.
+ *
+ * Run it with --quick for a short run, as ctest does.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include <ClickCounterBank_Esp32.h>
+#include "ccAllocHook.h"
+#include "ccBench.h"
+
+static const size_t slotsQtys[]{16, 256, 1024};
+
+static void benchSlots(const size_t &slotsQty, const uint32_t &iters){
+   std::vector<ClickCounter*> cntrs(slotsQty, nullptr);
+   std::vector<int32_t> deltas(slotsQty, 0);
+   std::vector<int32_t> vals(slotsQty, 0);
+   ClickCounterBank* bankPtr{nullptr};
+   ccAllocs_t strtAllocs{};
+   ccAllocs_t cntrsAllocs{};
+   ccAllocs_t bankAllocs{};
+   uint32_t rounds{static_cast<uint32_t>((iters / slotsQty > 0)?(iters / slotsQty):(1))};
+
+   for(size_t slot{0}; slot < slotsQty; slot++)
+      deltas[slot] = ((slot & 1) == 0)?(3):(-2);
+   strtAllocs = ccAllocs();
+   for(size_t slot{0}; slot < slotsQty; slot++){
+      cntrs[slot] = new ClickCounter(-1000000000, 1000000000);
+      cntrs[slot]->begin();
+   }
+   cntrsAllocs = {ccAllocs().qty - strtAllocs.qty, ccAllocs().bytes - strtAllocs.bytes - (slotsQty * sizeof(ClickCounter))};   // The objects themselves are reported apart
+   strtAllocs = ccAllocs();
+   bankPtr = new ClickCounterBank(slotsQty, -1000000000, 1000000000);
+   bankPtr->begin();
+   bankAllocs = {ccAllocs().qty - strtAllocs.qty, ccAllocs().bytes - strtAllocs.bytes - sizeof(ClickCounterBank)};
+
+   printf("%zu counters\n", slotsQty);
+   printf("   %-22s %14s %14s\n", "", "ClickCounter", "Bank");
+   printf("   %-22s %14zu %14zu\n", "object bytes", slotsQty * sizeof(ClickCounter), sizeof(ClickCounterBank));
+   printf("   %-22s %14llu %14llu\n", "other heap bytes", static_cast<unsigned long long>(cntrsAllocs.bytes), static_cast<unsigned long long>(bankAllocs.bytes));
+   printf("   %-22s %14llu %14llu\n", "heap allocations", static_cast<unsigned long long>(cntrsAllocs.qty), static_cast<unsigned long long>(bankAllocs.qty));
+   printf("   %-22s %14.1f %14.1f\n", "bytes per counter", static_cast<double>(slotsQty * sizeof(ClickCounter) + cntrsAllocs.bytes) / slotsQty, static_cast<double>(sizeof(ClickCounterBank) + bankAllocs.bytes) / slotsQty);
+   printf("   %-22s %14.1f %14.1f\n", "reset all, ns/counter", ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      for(ClickCounter* cntrPtr : cntrs)
+         cntrPtr->countReset();
+   }) / slotsQty, ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      bankPtr->countResetAll();
+   }) / slotsQty);
+   printf("   %-22s %14.1f %14.1f\n", "snapshot, ns/counter", ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      for(size_t slot{0}; slot < slotsQty; slot++)
+         vals[slot] = cntrs[slot]->getCount();
+      ccBenchKeep(vals[0]);
+   }) / slotsQty, ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      bankPtr->snapshot(vals.data());
+      ccBenchKeep(vals[0]);
+   }) / slotsQty);
+   printf("   %-22s %14.1f %14.1f\n", "add deltas, ns/counter", ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      for(size_t slot{0}; slot < slotsQty; slot++){
+         if(deltas[slot] > 0)
+            cntrs[slot]->countUp(deltas[slot]);
+         else
+            cntrs[slot]->countDown(deltas[slot]);
+      }
+   }) / slotsQty, ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      bankPtr->addDeltas(deltas.data(), 0, slotsQty);
+   }) / slotsQty);
+   printf("   %-22s %14.1f %14.1f\n", "countUp, ns/counter", ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      for(ClickCounter* cntrPtr : cntrs)
+         cntrPtr->countUp();
+   }) / slotsQty, ccBenchNsPerOp(rounds, [&](uint32_t iter){
+      for(size_t slot{0}; slot < slotsQty; slot++)
+         bankPtr->countUp(slot);
+   }) / slotsQty);
+
+   delete bankPtr;
+   for(ClickCounter* cntrPtr : cntrs)
+      delete cntrPtr;
+
+   return;
+}
+
+int main(int argc, char* argv[]){
+   uint32_t iters{ccBenchIters(argc, argv, 4000000, 4096)};
+
+   printf("ClickCounterBank against individual ClickCounter objects, %u counter operations per measure\n", iters);
+   for(size_t slotsQty : slotsQtys)
+      benchSlots(slotsQty, iters);
+
+   return 0;
+}
@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterBank_test.cpp
+ *
+ * @brief Host unit tests of the ClickCounterBank class
+ *
+ * @details Every public method of the ClickCounterBank class is exercised: the slots valid ranges, the counting boundaries of each slot, the bulk operations partial failures, the slots displays binding and refresh, and the per slot exactness of concurrent counting.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <thread>
+#include <vector>
+#include <ClickCounterBank_Esp32.h>
+#include "ccTest.h"
+
+CC_TEST(bankBeginAndRanges){
+   ClickCounterBank bank(4, -10, 10);
+   ClickCounterBank emptyBank(0, -10, 10);
+
+   CC_CHECK_EQ(emptyBank.getSlotsQty(), 0U);
+   CC_CHECK(!emptyBank.begin());
+   CC_CHECK_EQ(bank.getSlotsQty(), 4U);
+   CC_CHECK(!bank.countUp(0));   // Not begun
+   CC_CHECK(!bank.setSlotRange(4, 0, 5));   // No such slot
+   CC_CHECK(!bank.setSlotRange(1, 5, 5));   // Empty range
+   CC_CHECK(bank.setSlotRange(1, 0, 100));
+   CC_CHECK(!bank.begin(-1));   // Out of the slot 1 range
+   CC_CHECK(bank.begin(3));
+   CC_CHECK(!bank.begin(3));
+   CC_CHECK(!bank.setSlotRange(2, 0, 5));   // Ranges are set before the begin
+   CC_CHECK_EQ(bank.getStartVal(), 3);
+   CC_CHECK_EQ(bank.getMinCountVal(1), 0);
+   CC_CHECK_EQ(bank.getMaxCountVal(1), 100);
+   CC_CHECK_EQ(bank.getMinCountVal(0), -10);
+   CC_CHECK_EQ(bank.getMaxCountVal(3), 10);
+   CC_CHECK_EQ(bank.getMaxCountVal(4), 0);
+   CC_CHECK_EQ(bank.getCount(4), 0);
+   for(size_t slot{0}; slot < 4; slot++)
+      CC_CHECK_EQ(bank.getCount(slot), 3);
+   CC_CHECK(bank.end());
+   CC_CHECK(!bank.end());
+   CC_CHECK(!bank.countUp(0));
+   CC_CHECK(bank.begin());   // An ended bank keeps its ranges and might be begun again
+   CC_CHECK_EQ(bank.getCount(1), 0);
+}
+
+CC_TEST(bankSlotBounds){
+   ClickCounterBank bank(3, -10, 10);
+
+   CC_CHECK(bank.setSlotRange(2, INT32_MIN, INT32_MAX));
+   CC_CHECK(bank.begin());
+   CC_CHECK(!bank.countUp(3));
+   CC_CHECK(!bank.countUp(0, 0));
+   CC_CHECK(bank.countUp(0, 10));
+   CC_CHECK(!bank.countUp(0));   // At the slot maximum
+   CC_CHECK_EQ(bank.getCount(0), 10);
+   CC_CHECK_EQ(bank.getCount(1), 0);   // Other slots are unaffected
+   CC_CHECK(bank.countDown(1, -10));   // The absolute value is used
+   CC_CHECK(!bank.countDown(1));
+   CC_CHECK_EQ(bank.getCount(1), -10);
+   CC_CHECK(!bank.countDown(0, 21));
+   CC_CHECK_EQ(bank.getCount(0), 10);
+   CC_CHECK(bank.countDown(0, 20));
+   CC_CHECK_EQ(bank.getCount(0), -10);
+   CC_CHECK(bank.countRestart(2, INT32_MAX));
+   CC_CHECK(!bank.countUp(2, INT32_MAX));   // Wouldn't fit in an int32_t
+   CC_CHECK(bank.countDown(2, INT32_MIN));   // Taken as INT32_MAX
+   CC_CHECK_EQ(bank.getCount(2), 0);
+   CC_CHECK(bank.countDown(2, INT32_MAX));
+   CC_CHECK(bank.countDown(2));
+   CC_CHECK(!bank.countDown(2));
+   CC_CHECK_EQ(bank.getCount(2), INT32_MIN);
+}
+
+CC_TEST(bankAddDeltasPartialFailure){
+   ClickCounterBank bank(5, 0, 100);
+   int32_t deltas[4]{10, 200, 0, -1};
+   bool rslts[4]{};
+
+   CC_CHECK(!bank.addDeltas(deltas, 0, 4));   // Not begun
+   CC_CHECK(bank.begin(50));
+   CC_CHECK(!bank.addDeltas(deltas, 2, 4));   // Past the last slot
+   CC_CHECK(!bank.addDeltas(deltas, 5, 0));
+   CC_CHECK(!bank.addDeltas(nullptr, 0, 4));
+   CC_CHECK_EQ(bank.getCount(2), 50);
+   CC_CHECK(!bank.addDeltas(deltas, 1, 4, rslts));
+   CC_CHECK(rslts[0]);
+   CC_CHECK(!rslts[1]);   // Out of range, the other deltas are added anyway
+   CC_CHECK(rslts[2]);
+   CC_CHECK(rslts[3]);
+   CC_CHECK_EQ(bank.getCount(0), 50);
+   CC_CHECK_EQ(bank.getCount(1), 60);
+   CC_CHECK_EQ(bank.getCount(2), 50);
+   CC_CHECK_EQ(bank.getCount(3), 50);
+   CC_CHECK_EQ(bank.getCount(4), 49);
+   deltas[1] = -50;
+   CC_CHECK(bank.addDeltas(deltas, 0, 4, rslts));
+   CC_CHECK(rslts[0] && rslts[1] && rslts[2] && rslts[3]);
+   CC_CHECK_EQ(bank.getCount(0), 60);
+   CC_CHECK_EQ(bank.getCount(1), 10);
+}
+
+CC_TEST(bankSnapshotAndResets){
+   ClickCounterBank bank(4, -100, 100);
+   int32_t vals[6]{};
+
+   CC_CHECK(bank.begin(7));
+   for(size_t slot{1}; slot < 4; slot++)
+      CC_CHECK(bank.countUp(slot, static_cast<int32_t>(slot)));
+   CC_CHECK(!bank.countUp(0, 0));
+   CC_CHECK_EQ(bank.snapshot(vals), 4U);
+   CC_CHECK_EQ(vals[3], 10);
+   CC_CHECK_EQ(bank.snapshot(vals, 1, 2), 2U);
+   CC_CHECK_EQ(vals[0], 8);
+   CC_CHECK_EQ(vals[1], 9);
+   CC_CHECK_EQ(bank.snapshot(vals, 2), 2U);   // Clipped to the last slot
+   CC_CHECK_EQ(vals[1], 10);
+   CC_CHECK_EQ(bank.snapshot(vals, 4), 0U);
+   CC_CHECK_EQ(bank.snapshot(nullptr), 0U);
+   CC_CHECK(!bank.countRestart(1, 101));
+   CC_CHECK(!bank.countRestart(4, 0));
+   CC_CHECK(bank.countRestart(1, -100));
+   CC_CHECK(bank.countReset(3));
+   CC_CHECK_EQ(bank.getCount(3), 7);
+   CC_CHECK_EQ(bank.getCount(1), -100);
+   CC_CHECK(bank.countResetAll());
+   CC_CHECK_EQ(bank.snapshot(vals), 4U);
+   for(size_t slot{0}; slot < 4; slot++)
+      CC_CHECK_EQ(vals[slot], 7);
+   CC_CHECK(bank.end());
+   CC_CHECK(!bank.countResetAll());
+}
+
+CC_TEST(bankSlotDisplays){
+   SevenSegDisplays dsplyA(4);
+   SevenSegDisplays dsplyB(2);
+   ClickCounterBank bank(3, -1000, 1000);
+
+   CC_CHECK(!bank.setSlotDisplay(3, &dsplyA));
+   CC_CHECK(bank.setSlotDisplay(0, &dsplyA, true, true));
+   CC_CHECK(bank.setSlotDisplay(1, &dsplyB));
+   CC_CHECK(bank.setSlotDisplay(1, nullptr));   // Unbound, keeps the display range
+   CC_CHECK(bank.setSlotDisplay(2, &dsplyB, false));
+   CC_CHECK_EQ(bank.getMinCountVal(0), -999);   // The range of the values the display shows
+   CC_CHECK_EQ(bank.getMaxCountVal(0), 9999);
+   CC_CHECK_EQ(bank.getMinCountVal(2), -9);
+   CC_CHECK_EQ(bank.getMaxCountVal(2), 99);
+   CC_CHECK(bank.begin(5));
+   CC_CHECK(!bank.setSlotDisplay(1, &dsplyA));
+   CC_CHECK_EQ(dsplyA.lastVal(), 5);   // The begin() prints every bound slot
+   CC_CHECK(dsplyA.lastRgthAlgn());
+   CC_CHECK(dsplyA.lastZeroPad());
+   CC_CHECK(bank.countUp(0, 37));
+   CC_CHECK_EQ(dsplyA.lastVal(), 42);
+   CC_CHECK(bank.countUp(2, 90));
+   CC_CHECK_EQ(dsplyB.lastVal(), 95);
+   CC_CHECK(!dsplyB.lastRgthAlgn());
+   CC_CHECK(!bank.countUp(2, 5));   // Past the display maximum
+   CC_CHECK(bank.countUp(1, 50));   // Unbound slots aren't printed
+   CC_CHECK_EQ(dsplyB.lastVal(), 95);
+   dsplyA.failPrnt = true;
+   CC_CHECK(!bank.updDisplay(0));
+   CC_CHECK(!bank.countResetAll());   // The slots are reset, the display failure is reported
+   CC_CHECK_EQ(bank.getCount(0), 5);
+   dsplyA.failPrnt = false;
+   CC_CHECK(bank.updDisplay(0));
+   CC_CHECK_EQ(dsplyA.lastVal(), 5);
+   CC_CHECK(bank.updDisplay(1));   // No display bound
+   CC_CHECK(!bank.updDisplay(3));
+}
+
+CC_TEST(bankConcurrentSlotsAreExact){
+   const int thrdsQty{4};
+   const int32_t perThrd{20000};
+   const size_t slotsQty{8};
+   SevenSegDisplays dsply(8);
+   ClickCounterBank bank(slotsQty + 1, INT32_MIN, INT32_MAX);
+   std::atomic<int32_t> accptd{0};
+   std::vector<std::thread> thrds;
+   int32_t vals[slotsQty]{};
+
+   CC_CHECK(bank.setSlotDisplay(0, &dsply));   // Slot 0 counts through the display mutex path, the rest lock-free
+   CC_CHECK(bank.setSlotRange(slotsQty, 0, 10000));   // The last slot is filled up to its maximum
+   CC_CHECK(bank.begin());
+   for(int thrd{0}; thrd < thrdsQty; thrd++){
+      thrds.emplace_back([&, thrd](){
+         for(int32_t i{0}; i < perThrd; i++){
+            bank.countUp(i % slotsQty, thrd + 1);
+            bank.countDown(i % slotsQty);
+            if(bank.countUp(slotsQty, 7))
+               accptd.fetch_add(7);
+         }
+      });
+   }
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   CC_CHECK_EQ(bank.snapshot(vals, 0, slotsQty), slotsQty);
+   for(size_t slot{0}; slot < slotsQty; slot++)
+      CC_CHECK_EQ(vals[slot], static_cast<int32_t>((perThrd / slotsQty) * (0 + 1 + 2 + 3)));   // Each thread adds its number to every slot perThrd / slotsQty times
+   CC_CHECK_EQ(dsply.lastVal(), vals[0]);   // The last print shows the last value
+   CC_CHECK_EQ(bank.getCount(slotsQty), accptd.load());
+   CC_CHECK(bank.getCount(slotsQty) > (10000 - 7));
+}
+
+CC_TEST_MAIN()
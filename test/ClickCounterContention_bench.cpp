@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterContention_bench.cpp
+ *
+ * @brief Host contention benchmark of the mutex, lock-free and sharded counters
+ *
+ * @details Several threads count in a single counter as fast as they can, the throughput in millions of operations per second is reported for each quantity of threads:
+ * - writers: every thread counts up.
+ * - 1 writer + readers: one thread counts up, the rest read the count, as display and reporting tasks do.
+ *
+ * Compares the ClickCounter mutex path, the ClickCounter lock-free mode (setLockFree(true)) and the ShardedClickCounter. Run it with --quick for a short run, as ctest does.
+ * The writers throughput can only grow with the threads quantity up to the host CPUs quantity, and the sharded counter spreads the writers in portNUM_PROCESSORS shards (2 in the shim, as in a dual core ESP32): both figures are printed in the report header.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include <ShardedClickCounter_Esp32.h>
+#include "ccBench.h"
+
+static const uint8_t thrdsQtys[]{1, 2, 4, 8};
+
+template <typename C>
+static void benchCntr(const char* namePtr, C &cntr, const uint32_t &iters){
+   printf("%-12s", namePtr);
+   for(uint8_t thrdsQty : thrdsQtys){
+      cntr.countRestart(0);
+      printf(" %9.2f", ccBenchMops(thrdsQty, iters / thrdsQty, [&cntr](uint8_t thrd, uint32_t iter){
+         cntr.countUp();
+      }));
+   }
+   printf("   |");
+   for(uint8_t thrdsQty : thrdsQtys){
+      cntr.countRestart(0);
+      printf(" %9.2f", ccBenchMops(thrdsQty, iters / thrdsQty, [&cntr](uint8_t thrd, uint32_t iter){
+         if(thrd == 0)
+            cntr.countUp();
+         else
+            ccBenchKeep(cntr.getCount());
+      }));
+   }
+   printf("\n");
+
+   return;
+}
+
+int main(int argc, char* argv[]){
+   uint32_t iters{ccBenchIters(argc, argv, 2000000, 4000)};
+   ClickCounter mtxCntr(0, INT32_MAX);
+   ClickCounter lckFreeCntr(0, INT32_MAX);
+   ShardedClickCounter shrdCntr(0, INT32_MAX, 256);
+
+   mtxCntr.begin();
+   lckFreeCntr.setLockFree(true);
+   lckFreeCntr.begin();
+   shrdCntr.begin();
+   printf("Counters contention benchmark, %u operations per measure, Mops/s\n", iters);
+   printf("Host CPUs: %u, shards: %d\n", std::thread::hardware_concurrency(), portNUM_PROCESSORS);
+   printf("%-12s", "threads");
+   for(int rep{0}; rep < 2; rep++){
+      for(uint8_t thrdsQty : thrdsQtys)
+         printf(" %9u", thrdsQty);
+      printf((rep == 0)?("   |"):("\n"));
+   }
+   printf("%-12s %-41s   | %s\n", "", "writers", "1 writer + readers");
+   benchCntr("mutex", mtxCntr, iters);
+   benchCntr("lock-free", lckFreeCntr, iters);
+   benchCntr("sharded", shrdCntr, iters);
+
+   return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterIsr_test.cpp
+ *
+ * @brief Host tests of the ClickCounter ISR safe counting methods, fed by simulated pulse trains
+ *
+ * @details Each pulse train is a thread toggling a shimmed input pin as fast as it can, the rising edges run the attached interrupt handler as an ISR (see shimPinSet()), so the counting methods run with xPortInIsrContext() true: any blocking service invoked from them is reported by the shim as a fault. Several trains, and tasks counting with the non ISR methods, feed the same counter at the same time to check that no count is lost, and that the display refresh and the watchpoints are handed to task context.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+struct isrCtx_t{
+   ClickCounter* cntrPtr;
+   bool countDown;
+   std::atomic<uint32_t> rjctdQty;
+   std::atomic<uint32_t> wokenQty;
+};
+
+static void IRAM_ATTR pulseIsr(void* argPtr){
+   isrCtx_t* ctxPtr{static_cast<isrCtx_t*>(argPtr)};
+   BaseType_t xHigherPriorityTaskWoken{pdFALSE};
+   bool cntd{false};
+
+   if(ctxPtr->countDown)
+      cntd = ctxPtr->cntrPtr->countDownFromISR(1, &xHigherPriorityTaskWoken);
+   else
+      cntd = ctxPtr->cntrPtr->countUpFromISR(1, &xHigherPriorityTaskWoken);
+   if(!cntd)
+      ctxPtr->rjctdQty++;
+   if(xHigherPriorityTaskWoken == pdTRUE)
+      ctxPtr->wokenQty++;
+   portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+   return;
+}
+
+static void IRAM_ATTR asyncPulseIsr(void* argPtr){
+   isrCtx_t* ctxPtr{static_cast<isrCtx_t*>(argPtr)};
+   BaseType_t xHigherPriorityTaskWoken{pdFALSE};
+
+   if(!ctxPtr->cntrPtr->applyAsyncFromISR(ccBatchOp_t{ctxPtr->countDown?ccOpDown:ccOpUp, 1}, nullptr, &xHigherPriorityTaskWoken))
+      ctxPtr->rjctdQty++;
+   if(xHigherPriorityTaskWoken == pdTRUE)
+      ctxPtr->wokenQty++;
+   portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+   return;
+}
+
+/**
+ * @brief Runs a pulse train of pulsesQty rising edges in the pin, in a new thread.
+ */
+static std::thread pulseTrain(const uint8_t &pin, isrCtx_t &ctx, const uint32_t &pulsesQty, void (*isrFn)(void*) = pulseIsr){
+   shimPinSet(pin, false);
+   attachInterruptArg(pin, isrFn, &ctx, RISING);
+
+   return std::thread([pin, pulsesQty](){
+      for(uint32_t pls{0}; pls < pulsesQty; pls++){
+         shimPinSet(pin, true);
+         shimPinSet(pin, false);
+      }
+   });
+}
+
+static bool wpInIsr{false};
+
+static void wpRecCtx(void* argPtr){
+   wpInIsr = (xPortInIsrContext() != pdFALSE);
+   static_cast<std::atomic<uint32_t>*>(argPtr)->fetch_add(1);
+
+   return;
+}
+//================================================>> Test helpers END
+
+CC_TEST(pulseTrainsAreExact){
+   const uint32_t plssQty{20000};
+
+   for(bool lckFree : {false, true}){
+      ClickCounter cntr(-1000000, 1000000);
+      isrCtx_t upCtx{&cntr, false, {0}, {0}};
+      isrCtx_t dwnCtx{&cntr, true, {0}, {0}};
+      std::vector<std::thread> thrds;
+
+      cntr.setLockFree(lckFree);
+      CC_CHECK(cntr.begin());
+      thrds.push_back(pulseTrain(4, upCtx, plssQty));
+      thrds.push_back(pulseTrain(5, upCtx, plssQty));
+      thrds.push_back(pulseTrain(6, dwnCtx, plssQty / 2));
+      thrds.emplace_back([&cntr, plssQty](){   // A task counting from task context meanwhile
+         for(uint32_t i{0}; i < plssQty; i++)
+            cntr.countUp();
+      });
+      for(std::thread &thrd : thrds)
+         thrd.join();
+      CC_CHECK_EQ(cntr.getCount(), static_cast<int32_t>(3 * plssQty - plssQty / 2));
+      CC_CHECK_EQ(upCtx.rjctdQty.load(), 0u);
+      CC_CHECK_EQ(dwnCtx.rjctdQty.load(), 0u);
+      for(uint8_t pin : {4, 5, 6})
+         detachInterrupt(pin);
+   }
+}
+
+CC_TEST(pulseTrainStopsAtRangeLimits){
+   ClickCounter cntr(-50, 100);
+   isrCtx_t upCtx{&cntr, false, {0}, {0}};
+   isrCtx_t dwnCtx{&cntr, true, {0}, {0}};
+   std::thread thrd;
+
+   CC_CHECK(cntr.begin());
+   thrd = pulseTrain(4, upCtx, 150);
+   thrd.join();
+   CC_CHECK_EQ(cntr.getCount(), 100);
+   CC_CHECK_EQ(upCtx.rjctdQty.load(), 50u);
+   thrd = pulseTrain(5, dwnCtx, 200);
+   thrd.join();
+   CC_CHECK_EQ(cntr.getCount(), -50);
+   CC_CHECK_EQ(dwnCtx.rjctdQty.load(), 50u);
+   detachInterrupt(4);
+   detachInterrupt(5);
+}
+
+CC_TEST(pulseTrainDefersDisplayToRefreshTask){
+   const uint32_t plssQty{20000};
+   SevenSegDisplays dsply(6);
+   ClickCounter cntr(&dsply);
+   isrCtx_t ctx{&cntr, false, {0}, {0}};
+   std::thread thrd;
+   uint32_t prntsQty{0};
+
+   cntr.setLockFree(true);
+   CC_CHECK(cntr.begin());
+   CC_CHECK(cntr.startRefreshTask(100, 2));
+   prntsQty = dsply.prntsQty.load();
+   thrd = pulseTrain(4, ctx, plssQty);
+   thrd.join();
+   CC_CHECK_EQ(cntr.getCount(), static_cast<int32_t>(plssQty));
+   CC_CHECK(waitFor([&](){return dsply.lastVal() == static_cast<int32_t>(plssQty);}));
+   CC_CHECK(dsply.prntsQty.load() - prntsQty < plssQty / 10);   // The prints are coalesced, not one per pulse
+   CC_CHECK(ctx.wokenQty.load() > 0);   // The refresh task, of higher priority, was woken from the ISR
+   CC_CHECK(cntr.stopRefreshTask());
+   detachInterrupt(4);
+}
+
+CC_TEST(pulseTrainWithoutRefreshTaskIsPumped){
+   SevenSegDisplays dsply(6);
+   ClickCounter cntr(&dsply);
+   isrCtx_t ctx{&cntr, false, {0}, {0}};
+   std::thread thrd;
+   uint32_t prntsQty{0};
+
+   CC_CHECK(cntr.begin());
+   prntsQty = dsply.prntsQty.load();
+   thrd = pulseTrain(4, ctx, 1000);
+   thrd.join();
+   CC_CHECK_EQ(dsply.prntsQty.load(), prntsQty);   // No display I/O from the ISR
+   CC_CHECK(cntr.pumpDisplay());
+   CC_CHECK_EQ(dsply.lastVal(), 1000);
+   detachInterrupt(4);
+}
+
+CC_TEST(pulseTrainWatchpointsRunInTask){
+   ClickCounter cntr(0, 100000);
+   isrCtx_t ctx{&cntr, false, {0}, {0}};
+   std::atomic<uint32_t> rchd{0};
+   std::atomic<uint32_t> crssd{0};
+   std::thread thrd;
+   bool wtRslt{false};
+   std::thread wtr;
+   int32_t trgtVal{5000};
+
+   CC_CHECK(cntr.startDispatchTask());
+   CC_CHECK(cntr.begin());
+   CC_CHECK(cntr.addWatchpoint(ccWpReached, 2500, wpRecCtx, &rchd));
+   CC_CHECK(cntr.addWatchpoint(ccWpCrossUp, 4000, cntCall, &crssd));
+   wtr = std::thread([&](){   // A task waiting for the count to reach a value set from the ISR
+      wtRslt = cntr.waitUntil([](int32_t count, void* argPtr){return count >= *static_cast<int32_t*>(argPtr);}, &trgtVal, pdMS_TO_TICKS(5000));
+   });
+   thrd = pulseTrain(4, ctx, 10000);
+   thrd.join();
+   wtr.join();
+   CC_CHECK(wtRslt);
+   CC_CHECK(waitFor([&](){return (rchd.load() == 1) && (crssd.load() == 1);}));
+   CC_CHECK(!wpInIsr);
+   CC_CHECK(ctx.wokenQty.load() > 0);   // The dispatcher or the waiter was unblocked from the ISR
+   CC_CHECK(cntr.stopDispatchTask());
+   detachInterrupt(4);
+}
+
+CC_TEST(pulseTrainPostsToAsyncTask){
+   const uint32_t plssQty{2000};
+   ClickCounter cntr(0, 100000);
+   isrCtx_t ctx{&cntr, false, {0}, {0}};
+   std::thread thrd;
+
+   CC_CHECK(cntr.begin());
+   CC_CHECK(cntr.startAsyncTask(plssQty, 2));
+   thrd = pulseTrain(4, ctx, plssQty, asyncPulseIsr);
+   thrd.join();
+   CC_CHECK_EQ(ctx.rjctdQty.load(), 0u);
+   CC_CHECK(waitFor([&](){return cntr.getCount() == static_cast<int32_t>(plssQty);}));
+   CC_CHECK(ctx.wokenQty.load() > 0);   // The asynchronous task, blocked on the empty queue, was woken from the ISR
+   CC_CHECK(cntr.stopAsyncTask());
+   detachInterrupt(4);
+}
+
+CC_TEST_MAIN()
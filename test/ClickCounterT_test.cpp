@@ -0,0 +1,178 @@
+/**
+ ******************************************************************************
+ * @file ClickCounterT_test.cpp
+ *
+ * @brief Host unit tests of the ClickCounterT class template
+ *
+ * @details The overflow, lock and display policies are exercised, and the FixedClickCounter alias is checked to give the same results as a ClickCounter object for the same operations sequence, with and without a display.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include <ClickCounterT_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+enum tstOp_t{
+   toUp,
+   toDown,
+   toToZero,
+   toRestart,
+   toReset
+};
+
+struct tstStep_t{
+   tstOp_t op;
+   int32_t qty;
+};
+
+static const tstStep_t tstSteps[]{{toUp, 3}, {toUp, -4}, {toDown, 2}, {toUp, 100000}, {toDown, 100000}, {toToZero, 2}, {toToZero, 10}, {toRestart, -5}, {toToZero, 5}, {toToZero, 1},
+   {toDown, 994}, {toDown, 1}, {toRestart, 9999}, {toUp, 1}, {toUp, 0}, {toDown, 0}, {toRestart, 10000}, {toReset, 0}, {toDown, INT32_MIN}, {toUp, INT32_MAX}};
+
+template <typename C>
+static bool runStep(C &cntr, const tstStep_t &step){
+   bool result{false};
+
+   switch(step.op){
+      case toUp:
+         result = cntr.countUp(step.qty);
+         break;
+      case toDown:
+         result = cntr.countDown(step.qty);
+         break;
+      case toToZero:
+         result = cntr.countToZero(step.qty);
+         break;
+      case toRestart:
+         result = cntr.countRestart(step.qty);
+         break;
+      case toReset:
+         result = cntr.countReset();
+         break;
+   }
+
+   return result;
+}
+
+static int32_t fnShown{0};
+
+static bool fnShow(const int32_t &val){
+   fnShown = val;
+
+   return true;
+}
+//================================================>> Test helpers END
+
+CC_TEST(fixedMatchesClickCounter){
+   ClickCounter cntr(-999, 9999);
+   FixedClickCounter<-999, 9999> fxd;
+   size_t stepNbr{0};
+
+   CC_CHECK_EQ(cntr.begin(7), fxd.begin(7));
+   CC_CHECK_EQ(fxd.getMinCountVal(), cntr.getMinCountVal());
+   CC_CHECK_EQ(fxd.getMaxCountVal(), cntr.getMaxCountVal());
+   for(const tstStep_t &step : tstSteps){
+      CC_CHECK_EQ(runStep(fxd, step), runStep(cntr, step));
+      CC_CHECK_EQ(fxd.getCount(), cntr.getCount());
+      CC_CHECK_EQ(fxd.countIsZero(), cntr.countIsZero());
+      stepNbr++;
+   }
+   CC_CHECK_EQ(stepNbr, sizeof(tstSteps) / sizeof(tstSteps[0]));
+   CC_CHECK_EQ(fxd.getStartVal(), cntr.getStartVal());
+   CC_CHECK_EQ(fxd.end(), cntr.end());
+   CC_CHECK_EQ(fxd.end(), cntr.end());
+}
+
+CC_TEST(fixedMatchesClickCounterDisplay){
+   SevenSegDisplays cntrDsply(4);
+   SevenSegDisplays fxdDsply(4);
+   ClickCounter cntr(&cntrDsply, true, true);
+   FixedClickCounter<-999, 9999, true, true> fxd(&fxdDsply);
+
+   CC_CHECK_EQ(cntr.begin(), fxd.begin());
+   CC_CHECK_EQ(fxd.getMinCountVal(), cntr.getMinCountVal());   // The ClickCounter range is taken from the display by begin()
+   CC_CHECK_EQ(fxd.getMaxCountVal(), cntr.getMaxCountVal());
+   for(const tstStep_t &step : tstSteps){
+      CC_CHECK_EQ(runStep(fxd, step), runStep(cntr, step));
+      CC_CHECK_EQ(fxd.getCount(), cntr.getCount());
+      CC_CHECK_EQ(fxdDsply.lastVal(), cntrDsply.lastVal());
+      CC_CHECK_EQ(fxdDsply.lastZeroPad(), cntrDsply.lastZeroPad());
+   }
+   CC_CHECK(fxd.updDisplay());
+}
+
+CC_TEST(overflowPolicies){
+   ClickCounterT<0, 9, ccOvfSaturate, ccLckNone> sat;
+   ClickCounterT<0, 9, ccOvfWrap, ccLckCritical> wrp;
+   ClickCounterT<-3, 3, ccOvfWrap> wrpNeg;
+
+   CC_CHECK(sat.begin(5));
+   CC_CHECK(sat.countUp(100));
+   CC_CHECK_EQ(sat.getCount(), 9);
+   CC_CHECK(sat.countDown(INT32_MAX));
+   CC_CHECK_EQ(sat.getCount(), 0);
+   CC_CHECK(!sat.countRestart(10));   // The restart value must be in range for every policy
+   CC_CHECK(wrp.begin(7));
+   CC_CHECK(wrp.countUp(5));
+   CC_CHECK_EQ(wrp.getCount(), 2);
+   CC_CHECK(wrp.countDown(23));
+   CC_CHECK_EQ(wrp.getCount(), 9);
+   CC_CHECK(wrpNeg.begin(-3));
+   CC_CHECK(wrpNeg.countDown(1));
+   CC_CHECK_EQ(wrpNeg.getCount(), 3);
+   CC_CHECK(!wrpNeg.countToZero(4));   // Never goes past zero
+   CC_CHECK(wrpNeg.countToZero(3));
+   CC_CHECK(wrpNeg.countIsZero());
+}
+
+CC_TEST(displayFunctionPolicy){
+   ClickCounterT<0, 100, ccOvfReject, ccLckAtomic, ccDspFn> cntr(fnShow);
+   ClickCounterT<0, 100, ccOvfReject, ccLckAtomic, ccDspFn> noFnCntr;
+
+   CC_CHECK(cntr.begin(10));
+   CC_CHECK_EQ(fnShown, 10);
+   CC_CHECK(cntr.countUp(5));
+   CC_CHECK_EQ(fnShown, 15);
+   CC_CHECK(!cntr.countUp(90));
+   CC_CHECK_EQ(fnShown, 15);
+   CC_CHECK(noFnCntr.begin());
+   CC_CHECK(noFnCntr.countUp());
+}
+
+CC_TEST(concurrentPoliciesAreExact){
+   ClickCounterT<0, INT32_MAX> atmc;
+   ClickCounterT<0, INT32_MAX, ccOvfReject, ccLckCritical> crtcl;
+   FixedClickCounter<0, INT32_MAX> mtx;
+   std::vector<std::thread> thrds;
+
+   atmc.begin();
+   crtcl.begin();
+   mtx.begin();
+   for(int thrd{0}; thrd < 4; thrd++){
+      thrds.emplace_back([&](){
+         for(int i{0}; i < 20000; i++){
+            atmc.countUp();
+            crtcl.countUp();
+            mtx.countUp();
+         }
+      });
+   }
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   CC_CHECK_EQ(atmc.getCount(), 80000);
+   CC_CHECK_EQ(crtcl.getCount(), 80000);
+   CC_CHECK_EQ(mtx.getCount(), 80000);
+}
+
+CC_TEST_MAIN()
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file ClickCounter_bench.cpp
+ *
+ * @brief Host benchmark of the ClickCounter counting modes
+ *
+ * @details Reports the per operation latency of the counting and reading methods, and the throughput of 1, 2 and 4 threads counting concurrently in the same counter, for each counting mode:
+ * - mutex: the default mode, no display.
+ * - lock-free: setLockFree(true), no display.
+ * - mutex + display: each modification prints the (mock) display.
+ * - lock-free + refresh task: the display prints are deferred to the refresh task and coalesced.
+ * - rollover: setRollover(true), the count wraps and the carries are accumulated.
+ *
+ * Run it with --quick for a short run, as ctest does.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include "ccBench.h"
+
+enum ccBenchMode_t{
+   bmMutex,
+   bmLockFree,
+   bmMutexDsp,
+   bmLockFreeRfrsh,
+   bmRollover,
+   bmModesQty
+};
+
+static const char* const modeNames[bmModesQty]{"mutex", "lock-free", "mutex + display", "lock-free + refresh task", "rollover"};
+
+static void benchMode(const ccBenchMode_t &mode, const uint32_t &iters){
+   SevenSegDisplays dsply(4);
+   ClickCounter dspCntr(&dsply);
+   ClickCounter rngCntr(-1000000, 1000000);
+   ClickCounter* cntrPtr{((mode == bmMutexDsp) || (mode == bmLockFreeRfrsh))?(&dspCntr):(&rngCntr)};
+   ccBatchOp_t ops[2]{{ccOpUp, 2}, {ccOpDown, 1}};
+   ccCntSnap_t snap{};
+
+   if((mode == bmLockFree) || (mode == bmLockFreeRfrsh))
+      cntrPtr->setLockFree(true);
+   if(mode == bmRollover)
+      cntrPtr->setRollover(true);
+   cntrPtr->begin();
+   if(mode == bmLockFreeRfrsh)
+      cntrPtr->startRefreshTask(50);
+   printf("%s\n", modeNames[mode]);
+   printf("   countUp/Down   %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr](uint32_t iter){
+      if((iter & 1) == 0)
+         cntrPtr->countUp();
+      else
+         cntrPtr->countDown();
+   }));
+   printf("   getCount       %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr](uint32_t iter){
+      ccBenchKeep(cntrPtr->getCount());
+   }));
+   printf("   snapshot       %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr, &snap](uint32_t iter){
+      snap = cntrPtr->snapshot();
+      ccBenchKeep(snap.count);
+   }));
+   printf("   apply (2 ops)  %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr, &ops](uint32_t iter){
+      ops[1].qty = 2 + (iter & 1);   // Keeps the count oscillating within the range
+      ops[0].qty = 2 + ((iter + 1) & 1);
+      cntrPtr->apply(ops, 2);
+   }));
+   printf("   countPulses    %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr](uint32_t iter){
+      cntrPtr->countPulses(((iter & 1) == 0)?(1):(-1));
+   }));
+   {
+      ShimIsrScope isr;
+
+      printf("   count FromISR  %8.1f ns/op\n", ccBenchNsPerOp(iters, [cntrPtr](uint32_t iter){
+         if((iter & 1) == 0)
+            cntrPtr->countUpFromISR();
+         else
+            cntrPtr->countDownFromISR();
+      }));
+   }
+   for(uint8_t thrdsQty : {1, 2, 4}){
+      printf("   %u thread(s)    %8.2f Mops/s\n", thrdsQty, ccBenchMops(thrdsQty, iters / thrdsQty, [cntrPtr](uint8_t thrd, uint32_t iter){
+         if((iter & 1) == 0)
+            cntrPtr->countUp();
+         else
+            cntrPtr->countDown();
+      }));
+   }
+   if(mode == bmLockFreeRfrsh)
+      cntrPtr->stopRefreshTask();
+   printf("   display prints %u\n", dsply.prntsQty.load());
+
+   return;
+}
+
+int main(int argc, char* argv[]){
+   uint32_t iters{ccBenchIters(argc, argv, 1000000, 2000)};
+
+   printf("ClickCounter counting modes benchmark, %u iterations per measure\n", iters);
+   for(uint8_t mode{0}; mode < bmModesQty; mode++)
+      benchMode(static_cast<ccBenchMode_t>(mode), iters);
+
+   return 0;
+}
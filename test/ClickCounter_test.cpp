@@ -0,0 +1,1476 @@
+/**
+ ******************************************************************************
+ * @file ClickCounter_test.cpp
+ *
+ * @brief Host unit tests of the ClickCounter class
+ *
+ * @details Every public method of the ClickCounter class is exercised, with and without a display, in the mutex and the lock-free modes, including the range boundaries and the quantities that would overflow an int32_t.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <thread>
+#include <vector>
+#include <esp_partition.h>
+#include <ClickCounter_Esp32.h>
+#include <ClickCountPersist_Esp32.h>
+#include <ClickStorage_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+static bool cntAtLeast(int32_t count, void* argPtr){
+
+   return count >= *static_cast<int32_t*>(argPtr);
+}
+
+static const uint32_t prstHdrSz{24};   // The ClickCountPersist log layout: a checkpoint header (magic, generation, total, check, reserved) and 8 bytes records (delta, check)
+static const uint32_t prstRcrdSz{8};
+
+/**
+ * @brief A FileStorage that keeps the quantity of bytes read, to check the restore time bounds.
+ */
+class RdCntStorage: public FileStorage{
+public:
+   uint32_t rdBytes{0};
+
+   RdCntStorage(const char* filePath, const uint32_t &sctrSize, const uint32_t &sctrsQty)
+   :FileStorage(filePath, sctrSize, sctrsQty)
+   {
+   }
+   virtual bool read(const uint32_t &offset, void* dstPtr, const size_t &len){
+      rdBytes += len;
+
+      return FileStorage::read(offset, dstPtr, len);
+   }
+};
+
+/**
+ * @brief Returns the sector holding the checkpoint of the highest generation, the check values are not verified.
+ */
+static uint32_t prstLastSctr(ClickStorage &strg){
+   uint32_t result{0};
+   uint32_t hdrWrds[2]{};
+   uint32_t lastGen{0};
+
+   for(uint32_t sctr{0}; sctr < strg.getSctrsQty(); sctr++){
+      if(strg.read(sctr * strg.getSctrSize(), hdrWrds, sizeof(hdrWrds)) && (hdrWrds[0] == 0x4343504C) && (hdrWrds[1] >= lastGen)){
+         lastGen = hdrWrds[1];
+         result = sctr;
+      }
+   }
+
+   return result;
+}
+
+/**
+ * @brief Returns the storage position of the last record written in a sector, 0 if the sector has no records.
+ */
+static uint32_t prstLastRcrd(ClickStorage &strg, const uint32_t &sctr){
+   uint32_t result{0};
+   uint32_t rcrdWrds[2]{};
+
+   for(uint32_t offs{prstHdrSz}; (offs + prstRcrdSz) <= strg.getSctrSize(); offs += prstRcrdSz){
+      if(!strg.read(sctr * strg.getSctrSize() + offs, rcrdWrds, sizeof(rcrdWrds)) || ((rcrdWrds[0] == UINT32_MAX) && (rcrdWrds[1] == UINT32_MAX)))
+         break;
+      result = sctr * strg.getSctrSize() + offs;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Flips bits of a stored byte, as a write cut by a power loss might leave it.
+ */
+static void strgFlip(ClickStorage &strg, const uint32_t &offs, const uint8_t &mask){
+   uint8_t val{0};
+
+   strg.read(offs, &val, 1);
+   val ^= mask;
+   strg.write(offs, &val, 1);
+
+   return;
+}
+//================================================>> Test helpers END
+
+//==========================================>> Construction, begin, end BEGIN
+CC_TEST(defaultCtorHasEmptyRange){
+   ClickCounter cntr;
+
+   CC_CHECK_EQ(cntr.getMinCountVal(), 0);
+   CC_CHECK_EQ(cntr.getMaxCountVal(), 0);
+   CC_CHECK(!cntr.begin());   // An empty range can't be begun
+   CC_CHECK(!cntr.countUp());
+}
+
+CC_TEST(rangeCtorBeginEnd){
+   ClickCounter cntr(-10, 10);
+
+   CC_CHECK(!cntr.begin(11));
+   CC_CHECK(!cntr.begin(-11));
+   CC_CHECK(cntr.begin(5));
+   CC_CHECK(!cntr.begin(0));   // Already begun
+   CC_CHECK_EQ(cntr.getCount(), 5);
+   CC_CHECK_EQ(cntr.getStartVal(), 5);
+   CC_CHECK_EQ(cntr.getMinCountVal(), -10);
+   CC_CHECK_EQ(cntr.getMaxCountVal(), 10);
+   CC_CHECK(cntr.end());
+   CC_CHECK(!cntr.end());
+   CC_CHECK_EQ(cntr.getCount(), 0);
+   CC_CHECK_EQ(cntr.getMaxCountVal(), 0);
+   CC_CHECK(!cntr.countUp());
+}
+
+CC_TEST(displayCtorTakesDisplayRange){
+   SevenSegDisplays dsply(4);
+   ClickCounter cntr(&dsply, true, true);
+
+   CC_CHECK(cntr.begin(12));
+   CC_CHECK_EQ(cntr.getMinCountVal(), -999);
+   CC_CHECK_EQ(cntr.getMaxCountVal(), 9999);
+   CC_CHECK_EQ(dsply.lastVal(), 12);
+   CC_CHECK(dsply.lastRgthAlgn());
+   CC_CHECK(dsply.lastZeroPad());
+   CC_CHECK(cntr.end());
+   CC_CHECK(dsply.lastTxt().empty());   // end() clears the display
+}
+//============================================>> Construction, begin, end END
+
+//================================================>> Counting methods BEGIN
+CC_TEST(countUpDownBounds){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(-5, 5);
+
+      CC_CHECK(cntr.setLockFree(lockFree));
+      CC_CHECK(cntr.begin());
+      CC_CHECK_EQ(cntr.getLockFree(), lockFree);
+      CC_CHECK(!cntr.setLockFree(!lockFree));   // Only before begin()
+      CC_CHECK(cntr.countUp(5));
+      CC_CHECK(!cntr.countUp());   // At the maximum
+      CC_CHECK_EQ(cntr.getCount(), 5);
+      CC_CHECK(!cntr.countDown(11));   // Would go below the minimum, the count is not modified
+      CC_CHECK_EQ(cntr.getCount(), 5);
+      CC_CHECK(cntr.countDown(10));
+      CC_CHECK_EQ(cntr.getCount(), -5);
+      CC_CHECK(!cntr.countDown());
+      CC_CHECK(!cntr.countUp(0));
+      CC_CHECK(!cntr.countDown(0));
+      CC_CHECK(cntr.countUp(-3));   // The quantity sign is ignored
+      CC_CHECK_EQ(cntr.getCount(), -2);
+      CC_CHECK(cntr.countDown(-1));
+      CC_CHECK_EQ(cntr.getCount(), -3);
+   }
+}
+
+CC_TEST(countInt32Overflow){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(INT32_MIN, INT32_MAX);
+
+      cntr.setLockFree(lockFree);
+      CC_CHECK(cntr.begin(INT32_MAX - 1));
+      CC_CHECK(!cntr.countUp(2));   // Doesn't wrap to negative values
+      CC_CHECK(cntr.countUp());
+      CC_CHECK_EQ(cntr.getCount(), INT32_MAX);
+      CC_CHECK(!cntr.countUp(INT32_MAX));
+      CC_CHECK(!cntr.countUp(INT32_MIN));   // |INT32_MIN| is taken as INT32_MAX
+      CC_CHECK(cntr.countDown(INT32_MIN));
+      CC_CHECK_EQ(cntr.getCount(), 0);
+      CC_CHECK(cntr.countDown(INT32_MAX));
+      CC_CHECK(cntr.countDown());
+      CC_CHECK_EQ(cntr.getCount(), INT32_MIN);
+      CC_CHECK(!cntr.countDown());
+      CC_CHECK(cntr.countToZero(INT32_MAX));
+      CC_CHECK_EQ(cntr.getCount(), -1);
+      CC_CHECK(!cntr.countToZero(2));
+      CC_CHECK(cntr.countRestart(INT32_MAX));
+      CC_CHECK(cntr.countToZero(INT32_MAX));
+      CC_CHECK(cntr.countIsZero());
+   }
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(INT32_MIN, INT32_MAX);
+      ClickEventJournal jrnl(4);
+      ccEvntRcrd_t rcrds[4]{};
+
+      cntr.setLockFree(lockFree);
+      CC_CHECK(cntr.setJournal(&jrnl));
+      CC_CHECK(cntr.begin(INT32_MAX));
+      CC_CHECK(cntr.countRestart(INT32_MIN));   // A delta of -(2^32 - 1)
+      CC_CHECK_EQ(cntr.getCount(), INT32_MIN);
+      CC_CHECK(cntr.countRestart(INT32_MAX));
+      CC_CHECK_EQ(jrnl.take(rcrds, 4), 3U);
+      CC_CHECK_EQ(rcrds[1].delta, INT32_MIN);   // Saturated in the record
+      CC_CHECK_EQ(rcrds[2].delta, INT32_MAX);
+      CC_CHECK(cntr.setJournal(nullptr));
+   }
+}
+
+CC_TEST(countToZeroStopsAtZero){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(-10, 10);
+
+      cntr.setLockFree(lockFree);
+      cntr.begin(5);
+      CC_CHECK(cntr.countToZero(3));
+      CC_CHECK_EQ(cntr.getCount(), 2);
+      CC_CHECK(!cntr.countToZero(3));   // Would pass over 0
+      CC_CHECK_EQ(cntr.getCount(), 2);
+      CC_CHECK(cntr.countToZero(2));
+      CC_CHECK(cntr.countIsZero());
+      CC_CHECK(!cntr.countToZero());   // Already 0
+      CC_CHECK(cntr.countRestart(-4));
+      CC_CHECK(!cntr.countIsZero());
+      CC_CHECK(cntr.countToZero(-4));
+      CC_CHECK(cntr.countIsZero());
+      CC_CHECK(!cntr.countToZero(0));
+   }
+}
+
+CC_TEST(countRestartAndReset){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(0, 100);
+
+      cntr.setLockFree(lockFree);
+      cntr.begin(7);
+      CC_CHECK(cntr.countUp(10));
+      CC_CHECK(cntr.countReset());
+      CC_CHECK_EQ(cntr.getCount(), 7);
+      CC_CHECK(!cntr.countRestart(101));
+      CC_CHECK(!cntr.countRestart(-1));
+      CC_CHECK_EQ(cntr.getCount(), 7);
+      CC_CHECK(cntr.countRestart(100));
+      CC_CHECK_EQ(cntr.getCount(), 100);
+      CC_CHECK(cntr.countRestart());
+      CC_CHECK(cntr.countIsZero());
+   }
+}
+
+CC_TEST(concurrentCountsAreExact){
+   const int thrdsQty{4};
+   const int32_t perThrd{20000};
+
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(INT32_MIN, INT32_MAX);
+      std::vector<std::thread> thrds;
+
+      cntr.setLockFree(lockFree);
+      cntr.begin();
+      for(int thrd{0}; thrd < thrdsQty; thrd++){
+         thrds.emplace_back([&cntr, thrd](){
+            for(int32_t i{0}; i < perThrd; i++){
+               if((thrd % 2) == 0)
+                  cntr.countUp(3);
+               else
+                  cntr.countDown();
+            }
+         });
+      }
+      for(std::thread &thrd : thrds)
+         thrd.join();
+      CC_CHECK_EQ(cntr.getCount(), (thrdsQty / 2) * perThrd * 2);
+   }
+}
+
+CC_TEST(concurrentCountsRespectMax){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(0, 10000);
+      std::atomic<int32_t> accptd{0};
+      std::vector<std::thread> thrds;
+
+      cntr.setLockFree(lockFree);
+      cntr.begin();
+      for(int thrd{0}; thrd < 4; thrd++){
+         thrds.emplace_back([&](){
+            while(cntr.countUp(7))
+               accptd.fetch_add(7);
+         });
+      }
+      for(std::thread &thrd : thrds)
+         thrd.join();
+      CC_CHECK_EQ(cntr.getCount(), accptd.load());
+      CC_CHECK(cntr.getCount() > (10000 - 7));
+   }
+}
+
+CC_TEST(countFromIsr){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply);
+   BaseType_t woken{pdFALSE};
+   uint32_t prnts{0};
+
+   cntr.begin();
+   prnts = dsply.prntsQty.load();
+   {
+      ShimIsrScope isr;   // The shim faults if the mutex is taken or the display printed here
+      CC_CHECK(cntr.countUpFromISR(5, &woken));
+      CC_CHECK(cntr.countDownFromISR(2, &woken));
+      CC_CHECK(!cntr.countUpFromISR(10000, &woken));
+      CC_CHECK(!cntr.countUpFromISR(0, &woken));
+   }
+   CC_CHECK_EQ(dsply.prntsQty.load(), prnts);
+   CC_CHECK_EQ(cntr.getCount(), 3);
+   CC_CHECK(cntr.pumpDisplay());   // The display update is deferred to a task
+   CC_CHECK_EQ(dsply.lastVal(), 3);
+   CC_CHECK_EQ(dsply.prntsQty.load(), prnts + 1);
+}
+//==================================================>> Counting methods END
+
+//=================================================>> Display methods BEGIN
+CC_TEST(displayFollowsCount){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply, false, false);
+
+   cntr.begin();
+   CC_CHECK(cntr.countUp(42));
+   CC_CHECK_EQ(dsply.lastVal(), 42);
+   CC_CHECK(!dsply.lastRgthAlgn());
+   CC_CHECK(cntr.countDown(50));
+   CC_CHECK_EQ(dsply.lastVal(), -8);
+   CC_CHECK(!cntr.countUp(10008));   // Out of the display range
+   CC_CHECK_EQ(dsply.lastVal(), -8);
+   dsply.failPrnt = true;
+   CC_CHECK(!cntr.countUp());   // The count is modified, the failed print is reported
+   CC_CHECK_EQ(cntr.getCount(), -7);
+   dsply.failPrnt = false;
+   CC_CHECK(cntr.updDisplay());
+   CC_CHECK_EQ(dsply.lastVal(), -7);
+   cntr.clear();
+   CC_CHECK_EQ(dsply.clrsQty.load(), 1U);
+}
+
+CC_TEST(blinkServices){
+   SevenSegDisplays dsply;
+   ClickCounter withDsp(&dsply);
+   ClickCounter noDsp(0, 10);
+
+   withDsp.begin();
+   noDsp.begin();
+   CC_CHECK(withDsp.blink());
+   CC_CHECK(dsply.isBlinking());
+   CC_CHECK(withDsp.noBlink());
+   CC_CHECK(!dsply.isBlinking());
+   CC_CHECK(withDsp.blink(200, 300));
+   CC_CHECK(!withDsp.blink(5, 5));   // Out of the display valid rates
+   CC_CHECK(withDsp.setBlinkRate(400));
+   CC_CHECK(!withDsp.setBlinkRate(50000));
+   CC_CHECK_EQ(withDsp.getMaxBlinkRate(), 2000);
+   CC_CHECK_EQ(withDsp.getMinBlinkRate(), 100);
+   CC_CHECK(noDsp.blink());   // Without a display they succeed doing nothing
+   CC_CHECK(noDsp.blink(1, 1));
+   CC_CHECK(noDsp.noBlink());
+   CC_CHECK(noDsp.setBlinkRate(1));
+   CC_CHECK_EQ(noDsp.getMaxBlinkRate(), 0);
+   CC_CHECK_EQ(noDsp.getMinBlinkRate(), 0);
+   noDsp.clear();
+}
+
+CC_TEST(deferredRefreshCoalesces){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply);
+   uint32_t prnts{0};
+
+   cntr.begin();
+   CC_CHECK(cntr.setDeferredRefresh(true));
+   prnts = dsply.prntsQty.load();
+   for(int i{0}; i < 100; i++)
+      cntr.countUp();
+   CC_CHECK_EQ(dsply.prntsQty.load(), prnts);
+   CC_CHECK(cntr.pumpDisplay());
+   CC_CHECK_EQ(dsply.prntsQty.load(), prnts + 1);
+   CC_CHECK_EQ(dsply.lastVal(), 100);
+   CC_CHECK(cntr.pumpDisplay());   // Nothing pending, nothing printed
+   CC_CHECK_EQ(dsply.prntsQty.load(), prnts + 1);
+   cntr.countUp();
+   CC_CHECK(cntr.setDeferredRefresh(false));   // Returning to immediate refresh prints the pending value
+   CC_CHECK_EQ(dsply.lastVal(), 101);
+}
+
+CC_TEST(refreshTask){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply);
+
+   cntr.begin();
+   CC_CHECK(cntr.startRefreshTask(100));
+   CC_CHECK(!cntr.startRefreshTask(100));   // Already running
+   for(int i{0}; i < 50; i++)
+      cntr.countUp();
+   CC_CHECK(waitFor([&](){return dsply.lastVal() == 50;}));
+   CC_CHECK(dsply.prntsQty.load() < 50);
+   CC_CHECK(cntr.stopRefreshTask());
+   CC_CHECK(!cntr.stopRefreshTask());
+   CC_CHECK(!cntr.startRefreshTask(0));
+}
+CC_TEST(refreshTaskStopRace){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply);
+   std::atomic<bool> stop{false};
+   std::vector<std::thread> thrds;
+
+   cntr.setLockFree(true);
+   cntr.begin();
+   shimSetJitter(200, 300);   // Widens the window between reading the task handle and notifying it
+   for(int thrd{0}; thrd < 2; thrd++){
+      thrds.emplace_back([&](){
+         while(!stop.load()){
+            cntr.countUp();
+            cntr.countDown();
+         }
+      });
+   }
+   for(int i{0}; i < 100; i++){
+      CC_CHECK(cntr.startRefreshTask(1000));
+      CC_CHECK(cntr.stopRefreshTask());
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+   CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+}
+//===================================================>> Display methods END
+
+//==========================================>> Watchpoints and waits BEGIN
+CC_TEST(watchpointsDispatch){
+   ClickCounter cntr(0, 20);
+   std::atomic<uint32_t> rchd{0}, crssUp{0}, crssDwn{0}, minHit{0}, maxHit{0}, zero{0};
+
+   CC_CHECK(!cntr.addWatchpoint(ccWpReached, 5, nullptr));
+   CC_CHECK(cntr.addWatchpoint(ccWpReached, 5, cntCall, &rchd));
+   CC_CHECK(cntr.addWatchpoint(ccWpCrossUp, 10, cntCall, &crssUp));
+   CC_CHECK(cntr.addWatchpoint(ccWpCrossDown, 3, cntCall, &crssDwn));
+   CC_CHECK(cntr.addWatchpoint(ccWpMinHit, 0, cntCall, &minHit));
+   CC_CHECK(cntr.addWatchpoint(ccWpMaxHit, 0, cntCall, &maxHit));
+   CC_CHECK(cntr.setFnWhnCntValZeroPtr(cntCall, &zero));
+   CC_CHECK(cntr.getFnWhnCntValZeroPtr() == cntCall);
+   CC_CHECK(cntr.startDispatchTask());
+   CC_CHECK(!cntr.startDispatchTask());
+   CC_CHECK(cntr.begin(1));
+   cntr.countUp(4);   // Reaches 5
+   cntr.countUp(7);   // Crosses 10 upwards
+   cntr.countUp(8);   // Hits the maximum
+   cntr.countDown(18);   // Crosses 3 downwards
+   cntr.countToZero(2);   // Hits the minimum and 0
+   CC_CHECK(waitFor([&](){return (rchd + crssUp + crssDwn + minHit + maxHit + zero) == 6;}));
+   CC_CHECK_EQ(rchd.load(), 1U);
+   CC_CHECK_EQ(crssUp.load(), 1U);
+   CC_CHECK_EQ(crssDwn.load(), 1U);
+   CC_CHECK_EQ(minHit.load(), 1U);
+   CC_CHECK_EQ(maxHit.load(), 1U);
+   CC_CHECK_EQ(zero.load(), 1U);
+   CC_CHECK(cntr.removeWatchpoint(ccWpReached, 5, cntCall));
+   CC_CHECK(!cntr.removeWatchpoint(ccWpReached, 5, cntCall));
+   CC_CHECK(cntr.removeWatchpoint(ccWpMaxHit, 1234, cntCall));   // The value of the bounds watchpoints is ignored
+   CC_CHECK(cntr.setFnWhnCntValZeroPtr(nullptr));
+   cntr.countUp(20);
+   cntr.countDown(15);
+   CC_CHECK(cntr.stopDispatchTask());
+   CC_CHECK(!cntr.stopDispatchTask());
+   CC_CHECK_EQ(rchd.load(), 1U);
+   CC_CHECK_EQ(maxHit.load(), 1U);
+   CC_CHECK_EQ(zero.load(), 1U);
+}
+
+CC_TEST(watchpointsLostWithoutDispatcher){
+   ClickCounter cntr(0, 10);
+   std::atomic<uint32_t> rchd{0};
+
+   CC_CHECK(cntr.addWatchpoint(ccWpReached, 5, cntCall, &rchd));
+   cntr.begin();
+   cntr.countUp(5);
+   CC_CHECK_EQ(cntr.getWatchpointLostQty(true), 1U);
+   CC_CHECK_EQ(cntr.getWatchpointLostQty(), 0U);
+   CC_CHECK_EQ(rchd.load(), 0U);
+}
+
+CC_TEST(dispatchTaskStopRace){
+   ClickCounter cntr(0, 1);
+   std::atomic<uint32_t> rchd{0};
+   std::atomic<uint32_t> trggrd{0};
+   std::atomic<bool> stop{false};
+   std::vector<std::thread> thrds;
+
+   CC_CHECK(cntr.addWatchpoint(ccWpReached, 1, cntCall, &rchd));
+   cntr.setLockFree(true);
+   cntr.begin();
+   shimSetJitter(200, 300);   // Widens the window between reading the queue handle and sending to it
+   for(int thrd{0}; thrd < 2; thrd++){
+      thrds.emplace_back([&](){
+         while(!stop.load()){
+            if(cntr.countUp())
+               trggrd++;
+            cntr.countDown();
+         }
+      });
+   }
+   for(int i{0}; i < 50; i++){
+      CC_CHECK(cntr.startDispatchTask(4));
+      CC_CHECK(cntr.stopDispatchTask());
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+   CC_CHECK_EQ(rchd.load() + cntr.getWatchpointLostQty(), trggrd.load());   // Every triggered call was executed or accounted as lost
+   CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+}
+
+/**
+ * @brief Task waiting once for the count to reach 1, deleted as soon as waitUntil() returns.
+ */
+static void wtOnceTsk(void* argp){
+   static_cast<ClickCounter*>(argp)->waitUntil(ccWpReached, 1, 1);
+   vTaskDelete(nullptr);
+}
+
+CC_TEST(waitUntilReturnRace){
+   ClickCounter cntr(0, 1);
+   std::atomic<bool> stop{false};
+   std::vector<std::thread> thrds;
+
+   cntr.setLockFree(true);
+   cntr.begin();
+   shimSetJitter(200, 300);   // Widens the window between flagging a waiting task and notifying it
+   for(int thrd{0}; thrd < 2; thrd++){
+      thrds.emplace_back([&](){
+         while(!stop.load()){
+            cntr.countUp();
+            cntr.countDown();
+         }
+      });
+   }
+   for(int i{0}; i < 200; i++){   // A task notified after its wait ended is already deleted, the shim aborts the test
+      CC_CHECK(xTaskCreate(wtOnceTsk, "wtOnce", 2048, &cntr, 1, nullptr) == pdPASS);
+      CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+}
+
+CC_TEST(waitUntilAndWaitForChange){
+   ClickCounter cntr(0, 1000);
+   int32_t trgt{300};
+
+   cntr.begin();
+   CC_CHECK(!cntr.waitUntil(ccWpReached, 10, 5));   // Times out
+   CC_CHECK(!cntr.waitForChange(5));
+   CC_CHECK(!cntr.waitUntil(nullptr, nullptr, 5));
+   std::thread prdcr([&cntr](){
+      for(int i{0}; i < 500; i++){
+         cntr.countUp();
+         if((i % 50) == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+   });
+   CC_CHECK(cntr.waitForChange(2000));
+   CC_CHECK(cntr.waitUntil(ccWpCrossUp, 100, 2000));
+   CC_CHECK(cntr.getCount() >= 100);
+   CC_CHECK(cntr.waitUntil(cntAtLeast, &trgt, 2000));
+   CC_CHECK(cntr.getCount() >= 300);
+   CC_CHECK(cntr.waitUntil(ccWpMaxHit, 0, 10) == false);
+   prdcr.join();
+   CC_CHECK(cntr.waitUntil(ccWpReached, 500, 0));   // Already satisfied
+   {
+      ShimIsrScope isr;
+      CC_CHECK(!cntr.waitForChange(0));   // Not available from an ISR
+   }
+}
+
+CC_TEST(changeWaitersNeverMissWakeups){
+   const uint8_t wtrsQty{8};
+   const int32_t roundsQty{200};
+   ClickCounter cntr(0, 1000);
+   std::atomic<uint32_t> ackdQty{0};
+   std::atomic<uint32_t> lateQty{0};
+   std::vector<std::thread> wtrs;
+
+   cntr.begin();
+   shimSetJitter(100, 1000);   // Widens the windows between checking the condition and waiting
+   for(uint8_t wtr{0}; wtr < wtrsQty; wtr++){
+      wtrs.emplace_back([&](){
+         for(int32_t trgt{1}; trgt <= roundsQty; trgt++){
+            if(!cntr.waitUntil(cntAtLeast, &trgt, 1000))
+               lateQty++;
+            ackdQty++;
+         }
+      });
+   }
+   for(int32_t round{1}; round <= roundsQty; round++){
+      std::chrono::steady_clock::time_point ddln{std::chrono::steady_clock::now() + std::chrono::milliseconds(500)};
+
+      cntr.countUp();   // Right after the last acknowledge, while the waiters are going back to wait
+      while(ackdQty.load() != static_cast<uint32_t>(round * wtrsQty)){
+         if(std::chrono::steady_clock::now() > ddln){   // A lost wake up keeps a waiter blocked up to its time out
+            lateQty++;
+            break;
+         }
+         std::this_thread::yield();
+      }
+   }
+   for(std::thread &wtr : wtrs)
+      wtr.join();
+   shimSetJitter(0);
+   CC_CHECK_EQ(lateQty.load(), 0U);
+}
+
+CC_TEST(changeWaitersLimit){
+   ClickCounter cntr(0, 1000);
+   std::atomic<uint32_t> wokenQty{0};
+   std::vector<std::thread> wtrs;
+   int32_t zero{0};
+
+   cntr.begin();
+   for(uint8_t wtr{0}; wtr < 24; wtr++){
+      wtrs.emplace_back([&](){
+         if(cntr.waitForChange(5000))
+            wokenQty++;
+      });
+   }
+   CC_CHECK(waitFor([&](){return !cntr.waitUntil(cntAtLeast, &zero, 0);}));   // Already satisfied, but no event group bit is free
+   cntr.countUp();
+   for(std::thread &wtr : wtrs)
+      wtr.join();
+   CC_CHECK_EQ(wokenQty.load(), 24U);
+   CC_CHECK(cntr.waitUntil(cntAtLeast, &zero, 0));   // The bits were released
+}
+//============================================>> Watchpoints and waits END
+
+//==============================================>> Batches, async BEGIN
+CC_TEST(applyBatch){
+   for(bool lockFree : {false, true}){
+      ClickCounter cntr(-10, 10);
+      ccBatchOp_t ops[]{{ccOpUp, 4}, {ccOpDown, 1}, {ccOpToZero, 2}, {ccOpUp, 100}, {ccOpRestart, -3}, {ccOpUp, 1}};
+      bool rslts[6]{};
+      ccBatchOp_t rstOps[]{{ccOpReset, 0}};
+
+      cntr.setLockFree(lockFree);
+      cntr.begin(2);
+      CC_CHECK(!cntr.apply(ops, 6, rslts));   // The out of range operation fails, the rest are applied
+      CC_CHECK(rslts[0] && rslts[1] && rslts[2] && !rslts[3] && rslts[4] && rslts[5]);
+      CC_CHECK_EQ(cntr.getCount(), -2);
+      CC_CHECK(cntr.apply(rstOps, 1));
+      CC_CHECK_EQ(cntr.getCount(), 2);
+      CC_CHECK(!cntr.apply(nullptr, 1));
+      CC_CHECK(!cntr.apply(ops, 0));
+   }
+}
+
+CC_TEST(applyUnchangedBatchIsSilent){
+   for(bool lockFree : {false, true}){
+      SevenSegDisplays dsply;
+      ClickCounter cntr(&dsply);
+      ClickEventJournal jrnl(8);
+      ccEvntRcrd_t rcrds[8]{};
+      ccBatchOp_t failOps[]{{ccOpUp, 10000}, {ccOpDown, 10000}, {ccOpRestart, 100000}};
+      bool rslts[3]{};
+      uint32_t prntsQty{0};
+
+      cntr.setLockFree(lockFree);
+      cntr.setJournal(&jrnl);
+      cntr.begin();
+      jrnl.take(rcrds, 8);
+      prntsQty = dsply.prntsQty.load();
+      CC_CHECK(!cntr.apply(failOps, 3, rslts));   // Every operation fails
+      CC_CHECK(!rslts[0] && !rslts[1] && !rslts[2]);
+      CC_CHECK_EQ(dsply.prntsQty.load(), prntsQty);
+      CC_CHECK_EQ(jrnl.take(rcrds, 8), 0U);
+      cntr.setJournal(nullptr);
+   }
+}
+
+CC_TEST(asyncQueue){
+   ClickCounter cntr(0, 100);
+   ccAsyncRslt_t rslt{ccAsyncDone, 0, xTaskGetCurrentTaskHandle()};
+   ccAsyncRslt_t failRslt{ccAsyncDone, 0, nullptr};
+   ccAsyncStats_t stats{};
+
+   cntr.begin();
+   CC_CHECK(!cntr.countUpAsync(1, &rslt));   // No asynchronous task
+   CC_CHECK(rslt.status != ccAsyncPndng);
+   CC_CHECK(!cntr.getAsyncStats(stats));
+   CC_CHECK(cntr.startAsyncTask(8));
+   CC_CHECK(!cntr.startAsyncTask(8));
+   CC_CHECK(!cntr.applyAsync(ccBatchOp_t{ccOpBatch, 0}));   // Reserved
+   CC_CHECK(cntr.countUpAsync(10, &rslt, portMAX_DELAY));
+   CC_CHECK(ulTaskNotifyTake(pdTRUE, 2000) > 0);
+   CC_CHECK(rslt.status == ccAsyncDone);
+   CC_CHECK_EQ(rslt.count, 10);
+   CC_CHECK(cntr.countDownAsync(20, &failRslt, portMAX_DELAY));
+   CC_CHECK(waitFor([&](){return failRslt.status != ccAsyncPndng;}));
+   CC_CHECK(failRslt.status == ccAsyncFailed);
+   CC_CHECK(cntr.applyAsync(ccBatchOp_t{ccOpRestart, 50}, nullptr, portMAX_DELAY));
+   CC_CHECK(waitFor([&](){return cntr.getCount() == 50;}));
+   CC_CHECK(cntr.getAsyncStats(stats, true));
+   CC_CHECK_EQ(stats.postedQty, 3U);
+   CC_CHECK_EQ(stats.appliedQty, 3U);
+   CC_CHECK_EQ(stats.rjctdQty, 0U);   // A command failing when applied is not a rejected command
+   CC_CHECK(stats.drainsQty >= 1U);
+   CC_CHECK(cntr.getAsyncStats(stats));
+   CC_CHECK_EQ(stats.postedQty, 0U);
+   CC_CHECK(cntr.stopAsyncTask());
+   CC_CHECK(!cntr.stopAsyncTask());
+   CC_CHECK(!cntr.countUpAsync());
+}
+
+CC_TEST(asyncStopRace){
+   ClickCounter cntr(-1000000, 1000000);
+   std::atomic<bool> stop{false};
+   std::atomic<uint32_t> doneQty{0};
+   std::atomic<uint32_t> failedQty{0};
+   std::atomic<uint32_t> stuckQty{0};
+   std::vector<std::thread> thrds;
+
+   CC_CHECK(cntr.begin());
+   shimSetJitter(200, 300);   // Widens the window between reading the queue handle and sending to it
+   for(int thrd{0}; thrd < 3; thrd++){
+      thrds.emplace_back([&](){
+         ccAsyncRslt_t rslt{ccAsyncDone, 0, nullptr};
+         std::chrono::steady_clock::time_point ddln;
+
+         while(!stop.load()){
+            if(cntr.countUpAsync(1, &rslt, 1)){
+               ddln = std::chrono::steady_clock::now() + std::chrono::milliseconds(2000);
+               while((rslt.status == ccAsyncPndng) && (std::chrono::steady_clock::now() < ddln))
+                  std::this_thread::yield();
+               if(rslt.status == ccAsyncDone)
+                  doneQty++;
+               else if(rslt.status == ccAsyncFailed)
+                  failedQty++;
+               else
+                  stuckQty++;
+            }
+         }
+      });
+   }
+   for(int i{0}; i < 50; i++){
+      CC_CHECK(cntr.startAsyncTask(4));
+      vTaskDelay(1);
+      CC_CHECK(cntr.stopAsyncTask());
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+   CC_CHECK_EQ(stuckQty.load(), 0u);   // Every operation queued was applied or failed, none was left pending in a deleted queue
+   CC_CHECK_EQ(failedQty.load(), 0u);
+   CC_CHECK_EQ(cntr.getCount(), static_cast<int32_t>(doneQty.load()));
+   CC_CHECK(doneQty.load() > 0);
+   CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+}
+
+CC_TEST(snapshotTracksGenerations){
+   ClickCounter cntr(-5, 50);
+   ccCntSnap_t snap{cntr.snapshot()};
+
+   CC_CHECK(!snap.begun);
+   CC_CHECK(cntr.begin(3));
+   snap = cntr.snapshot();
+   CC_CHECK(snap.begun);
+   CC_CHECK_EQ(snap.count, 3);
+   CC_CHECK_EQ(snap.countMin, -5);
+   CC_CHECK_EQ(snap.countMax, 50);
+   CC_CHECK_EQ(snap.startVal, 3);
+   cntr.countUp(4);
+   CC_CHECK_EQ(cntr.snapshot().count, 7);
+   CC_CHECK_EQ(cntr.snapshot().gen, snap.gen);   // Counting doesn't change the configuration
+   cntr.end();
+   CC_CHECK(cntr.snapshot().gen > snap.gen);
+   CC_CHECK(!cntr.snapshot().begun);
+}
+
+CC_TEST(snapshotNeverSeesBeginHalfDone){
+   SevenSegDisplays dsply(4);
+   ClickCounter cntr(&dsply);
+   std::atomic<bool> stop{false};
+   std::atomic<uint32_t> tornQty{0};
+   std::atomic<uint32_t> begunQty{0};
+   std::thread rdr;
+
+   rdr = std::thread([&](){
+      ccCntSnap_t snap{};
+
+      while(!stop.load()){
+         snap = cntr.snapshot();
+         if(snap.begun){
+            begunQty++;
+            if((snap.countMin != -999) || (snap.countMax != 9999) || (snap.startVal != 25) || (snap.count != 25))
+               tornQty++;
+         }
+         else if((snap.countMin != 0) || (snap.countMax != 0))   // The range of an object not begun is published with the begun state
+            tornQty++;
+      }
+   });
+   shimSetJitter(200, 500);   // Widens the windows between the writes made by begin() and end()
+   for(int i{0}; i < 200; i++){
+      begunQty = 0;
+      CC_CHECK(cntr.begin(25));
+      CC_CHECK(waitFor([&](){return begunQty.load() > 0;}));
+      CC_CHECK(cntr.end());
+   }
+   stop = true;
+   rdr.join();
+   shimSetJitter(0);
+   CC_CHECK_EQ(tornQty.load(), 0u);
+}
+//================================================>> Batches, async END
+
+//======================================>> Rates, rollover, formats BEGIN
+CC_TEST(rateStats){
+   SevenSegDisplays dsply;
+   ClickCounter cntr(&dsply);
+
+   CC_CHECK(!cntr.setDisplayRate(true));   // The statistics are not enabled
+   CC_CHECK(!cntr.setRateStats(7));   // Not a divisor of a minute
+   CC_CHECK(!cntr.setRateStats(100, 0));
+   CC_CHECK(!cntr.setRateStats(100, 16));
+   CC_CHECK_EQ(cntr.getRate(), 0U);
+   CC_CHECK(cntr.setRateStats(3000));
+   cntr.begin();
+   cntr.countUp(5);
+   shimAdvanceTime(3000000);   // The 5 clicks bucket is closed
+   CC_CHECK_EQ(cntr.getRate(), 10U);   // 5 clicks in a 10 buckets, 30 seconds window
+   CC_CHECK_EQ(cntr.getRatePeak(true), 100U);
+   CC_CHECK_EQ(cntr.getRatePeak(), 0U);
+   CC_CHECK_EQ(cntr.getRateEwma(), 12U);   // 100 / 2^3
+   CC_CHECK(cntr.setDisplayRate(true));
+   CC_CHECK_EQ(dsply.lastVal(), 10);
+   CC_CHECK(cntr.setDisplayRate(false));
+   CC_CHECK_EQ(dsply.lastVal(), 5);
+   CC_CHECK(cntr.setRateStats(0));
+   CC_CHECK_EQ(cntr.getRate(), 0U);
+}
+
+CC_TEST(rateStatsLongIdleClears){
+   ClickCounter cntr(0, 100000);
+
+   CC_CHECK(cntr.setRateStats(1000, 15));   // The slowest EWMA, that keeps a residue after 64 empty buckets
+   cntr.begin();
+   cntr.countUp(50000);
+   shimAdvanceTime(1000000);
+   CC_CHECK(cntr.getRateEwma() > 0);
+   shimAdvanceTime(30000000);   // Fewer than 64 idle buckets, the EWMA decays
+   CC_CHECK(cntr.getRateEwma() > 0);
+   CC_CHECK_EQ(cntr.getRate(), 0U);
+   shimAdvanceTime(100000000);   // More than 64 idle buckets, everything is cleared
+   CC_CHECK_EQ(cntr.getRate(), 0U);
+   CC_CHECK_EQ(cntr.getRateEwma(), 0U);
+   cntr.countUp(10);
+   shimAdvanceTime(1000000);
+   CC_CHECK_EQ(cntr.getRate(), 60U);   // 10 clicks in a 10 buckets, 10 seconds window
+}
+
+CC_TEST(rolloverAndCarry){
+   ClickCounter lo(0, 9);
+   ClickCounter hi(0, 9);
+   ClickCounter odo(0, 99);
+
+   CC_CHECK(odo.setRollover(true));
+   CC_CHECK(odo.getRollover());
+   odo.begin(95);
+   CC_CHECK(odo.countUp(10));
+   CC_CHECK_EQ(odo.getCount(), 5);
+   CC_CHECK_EQ(odo.getCarryQty(), 1);
+   CC_CHECK_EQ(odo.getTotal(), 105);
+   CC_CHECK(odo.countDown(306));   // Four wraps downwards
+   CC_CHECK_EQ(odo.getCount(), 99);
+   CC_CHECK_EQ(odo.getCarryQty(true), -3);
+   CC_CHECK_EQ(odo.getCarryQty(), 0);
+   CC_CHECK_EQ(odo.getTotal(), -201);
+   CC_CHECK(!odo.setRollover(false));   // Only before begin()
+
+   CC_CHECK(!lo.setCarryCounter(&lo));
+   CC_CHECK(lo.setCarryCounter(&hi));
+   CC_CHECK(lo.getCarryCounter() == &hi);
+   CC_CHECK(!hi.setCarryCounter(&lo));   // Loops are rejected
+   CC_CHECK(lo.setRollover(true));
+   lo.begin();
+   hi.begin();
+   CC_CHECK(lo.countUp(25));
+   CC_CHECK_EQ(lo.getCount(), 5);
+   CC_CHECK_EQ(hi.getCount(), 2);
+   CC_CHECK(!lo.countUp(80));   // The carry would overflow the last stage, nothing is modified
+   CC_CHECK_EQ(lo.getCount(), 5);
+   CC_CHECK_EQ(hi.getCount(), 2);
+   CC_CHECK(!lo.setCarryCounter(nullptr));   // Only before begin()
+}
+
+CC_TEST(rolloverBatchesWrapAndCarry){
+   ClickCounter odo(0, 99);
+   ClickCounter lo(0, 9);
+   ClickCounter hi(0, 9);
+   ClickCounter other(0, 9);
+   ClickCounter cntr(-100, 100);
+   ccBatchOp_t wrapOps[3]{{ccOpUp, 10}, {ccOpDown, 1}, {ccOpUp, 200}};
+   ccBatchOp_t rstrtOps[2]{{ccOpUp, 20}, {ccOpRestart, 50}};
+   bool rslts[3]{};
+
+   odo.setRollover(true);
+   odo.begin(95);
+   CC_CHECK(odo.apply(wrapOps, 3, rslts));
+   CC_CHECK(rslts[0] && rslts[1] && rslts[2]);
+   CC_CHECK_EQ(odo.getCount(), 4);
+   CC_CHECK_EQ(odo.getCarryQty(), 3);
+   CC_CHECK_EQ(odo.getTotal(), 304);
+   CC_CHECK(odo.apply(rstrtOps, 2));   // The restart clears the total
+   CC_CHECK_EQ(odo.getCount(), 50);
+   CC_CHECK_EQ(odo.getTotal(), 50);
+   CC_CHECK(odo.startAsyncTask(4));
+   CC_CHECK(odo.countUpAsync(60, nullptr, portMAX_DELAY));
+   CC_CHECK(waitFor([&](){return odo.getCount() == 10;}));
+   CC_CHECK_EQ(odo.getTotal(), 110);
+   CC_CHECK(odo.stopAsyncTask());
+
+   CC_CHECK(lo.setCarryCounter(&hi));
+   CC_CHECK(!other.setCarryCounter(&hi));   // hi already receives the carries of lo
+   CC_CHECK(lo.setCarryCounter(&hi));
+   CC_CHECK(lo.setCarryCounter(nullptr));
+   CC_CHECK(other.setCarryCounter(&hi));   // Released by lo
+   CC_CHECK(other.setCarryCounter(nullptr));
+   CC_CHECK(lo.setCarryCounter(&hi));
+   lo.setRollover(true);
+   lo.begin();
+   hi.begin();
+   CC_CHECK(lo.apply(wrapOps, 2));
+   CC_CHECK_EQ(lo.getCount(), 9);
+   CC_CHECK_EQ(hi.getCount(), 0);   // Up 10 carried 1, down 1 borrowed it back
+   CC_CHECK(!lo.apply(&wrapOps[2], 1));   // The carries would overflow the last stage
+   CC_CHECK_EQ(lo.getCount(), 9);
+
+   CC_CHECK(cntr.setScaler(3));
+   cntr.begin();
+   CC_CHECK(cntr.countPulses(2));
+   CC_CHECK(cntr.apply(&rstrtOps[1], 1));   // The restart discards the scaled pulses remainder
+   CC_CHECK(cntr.countPulses(2));
+   CC_CHECK_EQ(cntr.getCount(), 50);
+}
+
+CC_TEST(displayFormats){
+   SevenSegDisplays dsply(4);
+   ClickCounter lowWnd(&dsply, true, false);
+
+   CC_CHECK(lowWnd.setDisplayFormat(ccFmtLowWindow));
+   lowWnd.begin(12345);
+   CC_CHECK_EQ(lowWnd.getMaxCountVal(), INT32_MAX);
+   CC_CHECK_EQ(dsply.lastVal(), 2345);
+   CC_CHECK(dsply.lastZeroPad());
+   lowWnd.countUp(7);
+   CC_CHECK_EQ(dsply.lastVal(), 2352);
+   CC_CHECK(!lowWnd.setDisplayFormat(ccFmtCount));   // Only before begin()
+   lowWnd.end();
+
+   ClickCounter scld(&dsply, true, false);
+   CC_CHECK(scld.setDisplayFormat(ccFmtScaled));
+   scld.begin(9999);
+   CC_CHECK_EQ(dsply.lastVal(), 9999);
+   scld.countUp(2346);
+   CC_CHECK(dsply.lastTxt() == " 12k");
+   scld.countRestart(-12345);
+   CC_CHECK(dsply.lastTxt() == "-12k");
+   scld.countRestart(INT32_MAX);
+   CC_CHECK(dsply.lastTxt() == "----");   // Can't be shown in 4 digits
+   scld.end();
+
+   ClickCounter pgs(&dsply, true, false);
+   CC_CHECK(pgs.setDisplayFormat(ccFmtPages, 1000));
+   pgs.begin(123456);
+   CC_CHECK_EQ(dsply.lastVal(), 3456);   // Low order page first
+   shimAdvanceTime(1000000);
+   CC_CHECK(pgs.pumpDisplay());
+   CC_CHECK(dsply.lastTxt() == "  12.");   // High order page, marked by the decimal point
+   pgs.end();
+
+   ClickCounter bigPgs(&dsply, true, false);
+   CC_CHECK(bigPgs.setDisplayFormat(ccFmtPages, 1000));
+   CC_CHECK(bigPgs.setRollover(true));
+   bigPgs.begin();
+   for(int carry{0}; carry < 6000; carry++){   // Past 2^31 pages of 4 digits, the page index is a 64 bits value
+      bigPgs.countUp(INT32_MAX);
+      bigPgs.countUp(1);
+   }
+   CC_CHECK_EQ(bigPgs.getTotal(), 6000 * (static_cast<int64_t>(INT32_MAX) + 1));
+   shimAdvanceTime(1000000);
+   CC_CHECK(bigPgs.pumpDisplay());
+   CC_CHECK(dsply.lastTxt() == "----.");   // Too many digits for the display, never a truncated page index
+   bigPgs.end();
+}
+
+CC_TEST(displayTextMatchesDisplay){
+   SevenSegDisplays dsply(4);
+   ClickCounter scld(&dsply, true, false);
+   ClickCounter pgs(0, 1000000);
+   SevenSegDisplays padDsply(4);
+   ClickCounter zeroPad(&padDsply, true, true);
+   char txt[8]{};
+
+   CC_CHECK(scld.setDisplayFormat(ccFmtScaled));
+   CC_CHECK(!scld.getDisplayText(txt, sizeof(txt), 4));   // Not begun
+   CC_CHECK(strcmp(txt, "----") == 0);
+   scld.begin(-12345);
+   CC_CHECK(scld.getDisplayText(txt, sizeof(txt), 4));
+   CC_CHECK(dsply.lastTxt() == txt);   // The same text the counter shows in its own display
+   CC_CHECK(scld.getDisplayText(txt, sizeof(txt), 6));
+   CC_CHECK(strcmp(txt, "-12345") == 0);
+   CC_CHECK(!scld.getDisplayText(txt, 6, 5));   // No room for the decimal point and the terminator
+   CC_CHECK(!scld.getDisplayText(nullptr, sizeof(txt), 4));
+   CC_CHECK(!scld.getDisplayText(txt, sizeof(txt), 2));
+   CC_CHECK(strcmp(txt, "--") == 0);
+   CC_CHECK(pgs.setDisplayFormat(ccFmtPages));
+   pgs.begin(123456);
+   CC_CHECK(pgs.getDisplayText(txt, sizeof(txt), 4));
+   CC_CHECK(strcmp(txt, "3456") == 0);
+   CC_CHECK(pgs.getDisplayText(txt, sizeof(txt), 4, 1));
+   CC_CHECK(strcmp(txt, "  12.") == 0);
+   CC_CHECK(!pgs.getDisplayText(txt, sizeof(txt), 2, 1));   // The page index 1234 doesn't fit
+   CC_CHECK(strcmp(txt, "--.") == 0);
+   zeroPad.begin(-7);
+   CC_CHECK(zeroPad.getDisplayText(txt, sizeof(txt), 4));
+   CC_CHECK(strcmp(txt, "-007") == 0);   // The zeros are padded after the sign
+}
+
+CC_TEST(scalerAndPulses){
+   ClickCounter cntr(-100, 100);
+   SimPulseSource src;
+
+   CC_CHECK(!cntr.setScaler(0));
+   CC_CHECK(!cntr.setScaler(3, 0));
+   CC_CHECK(cntr.setScaler(6, 2));   // 3 pulses a unit
+   cntr.begin();
+   CC_CHECK(!cntr.setScaler(1));
+   CC_CHECK(cntr.countPulses(2));
+   CC_CHECK_EQ(cntr.getCount(), 0);
+   CC_CHECK(cntr.countPulses(2));
+   CC_CHECK_EQ(cntr.getCount(), 1);   // The remainder is kept between calls
+   CC_CHECK(cntr.countPulses(-7));
+   CC_CHECK_EQ(cntr.getCount(), -1);
+   {
+      ShimIsrScope isr;
+      CC_CHECK(cntr.countPulsesFromISR(6));
+   }
+   CC_CHECK_EQ(cntr.getCount(), 1);
+   CC_CHECK(!cntr.pollPulseSource());   // No source set
+   CC_CHECK(cntr.setPulseSource(&src));
+   CC_CHECK(cntr.getPulseSource() == &src);
+   src.addPulses(9);
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 4);
+}
+
+CC_TEST(scalerPrintsOnUnitChange){
+   SevenSegDisplays dsply(4);
+   ClickCounter cntr(&dsply);
+   uint32_t prntsQty{0};
+
+   CC_CHECK(cntr.setScaler(60));   // 60 pulses a unit, i.e. teeth per revolution
+   CC_CHECK(cntr.begin());
+   prntsQty = dsply.prntsQty.load();
+   for(int pls{0}; pls < 6000; pls++)
+      CC_CHECK(cntr.countPulses(1));
+   CC_CHECK_EQ(cntr.getCount(), 100);
+   CC_CHECK_EQ(dsply.prntsQty.load() - prntsQty, 100U);   // Printed once a unit, not once a pulse
+   CC_CHECK_EQ(dsply.lastVal(), 100);
+   CC_CHECK(cntr.countPulses(-59));
+   CC_CHECK_EQ(cntr.getCount(), 99);   // The floor of the pulses kept, 5941 / 60
+   CC_CHECK(cntr.countRestart(10));
+   CC_CHECK(cntr.countPulses(59));
+   CC_CHECK_EQ(cntr.getCount(), 10);   // The restart cleared the remainder
+   CC_CHECK(cntr.countPulses(1));
+   CC_CHECK_EQ(cntr.getCount(), 11);
+}
+
+CC_TEST(pollKeepsPulsesOutOfRange){
+   ClickCounter cntr(-5, 10);
+   SimPulseSource src;
+
+   cntr.setPulseSource(&src);
+   cntr.begin();
+   src.addPulses(15);
+   CC_CHECK(!cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 10);   // Clamped to the range limit
+   CC_CHECK_EQ(cntr.getPendingUnits(), 5);
+   cntr.countDown(3);
+   CC_CHECK(!cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 10);
+   CC_CHECK_EQ(cntr.getPendingUnits(), 2);
+   cntr.countDown(4);
+   src.addPulses(1);
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 9);
+   CC_CHECK_EQ(cntr.getPendingUnits(), 0);
+   src.addPulses(-20);
+   CC_CHECK(!cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), -5);
+   CC_CHECK_EQ(cntr.getPendingUnits(), -6);
+   CC_CHECK(cntr.countReset());   // Discards the pending units
+   CC_CHECK_EQ(cntr.getPendingUnits(), 0);
+   src.addPulses(2);
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 2);
+}
+//========================================>> Rates, rollover, formats END
+
+//====================================>> Journal, persistence, others BEGIN
+CC_TEST(journalRecords){
+   ClickCounter cntr(0, 10);
+   ClickEventJournal jrnl(8);
+   ccEvntRcrd_t rcrds[8]{};
+
+   CC_CHECK(cntr.setJournal(&jrnl));
+   CC_CHECK(cntr.getJournal() == &jrnl);
+   cntr.begin();
+   cntr.countUp(3);
+   cntr.countDown();
+   CC_CHECK_EQ(jrnl.take(rcrds, 8), 3U);   // The begin() restart and the two modifications
+   CC_CHECK_EQ(rcrds[1].count, 3);
+   CC_CHECK_EQ(rcrds[1].delta, 3);
+   CC_CHECK_EQ(rcrds[1].opType, static_cast<uint8_t>(ccOpUp));
+   CC_CHECK_EQ(rcrds[2].count, 2);
+   CC_CHECK_EQ(rcrds[2].delta, -1);
+   CC_CHECK(cntr.setJournal(nullptr));
+}
+
+CC_TEST(journalFullDropsRecords){
+   ccJrnlSlot_t slots[6];
+   ClickEventJournal jrnl(slots, 6);   // Only 4 slots are used, the biggest power of 2
+   ClickCounter cntr(0, 100);
+   ccEvntRcrd_t rcrds[8]{};
+
+   CC_CHECK_EQ(jrnl.getCapacity(), 4U);
+   for(int32_t i{0}; i < 4; i++)
+      CC_CHECK(jrnl.push({0, i, 1, ccOpUp}));
+   CC_CHECK(!jrnl.push({0, 4, 1, ccOpUp}));
+   CC_CHECK(!jrnl.push({0, 5, 1, ccOpUp}));
+   CC_CHECK_EQ(jrnl.getLostQty(), 2U);
+   CC_CHECK_EQ(jrnl.take(rcrds, 3), 3U);
+   CC_CHECK_EQ(rcrds[2].count, 2);
+   CC_CHECK(jrnl.push({0, 6, 1, ccOpUp}));   // Drained slots are accepted again
+   CC_CHECK_EQ(jrnl.take(rcrds, 8), 2U);
+   CC_CHECK_EQ(rcrds[0].count, 3);
+   CC_CHECK_EQ(rcrds[1].count, 6);
+   CC_CHECK_EQ(jrnl.take(rcrds, 8), 0U);
+   CC_CHECK_EQ(jrnl.getLostQty(true), 2U);
+   CC_CHECK_EQ(jrnl.getLostQty(), 0U);
+   CC_CHECK(cntr.setJournal(&jrnl));
+   cntr.begin();
+   for(int i{0}; i < 10; i++)
+      CC_CHECK(cntr.countUp());   // A full journal never fails nor delays the counting
+   CC_CHECK_EQ(cntr.getCount(), 10);
+   CC_CHECK_EQ(jrnl.getLostQty(), 7U);   // The begin() restart and 3 modifications were registered
+   CC_CHECK_EQ(jrnl.take(rcrds, 8), 4U);
+   CC_CHECK_EQ(rcrds[3].count, 3);
+   CC_CHECK(cntr.setJournal(nullptr));
+}
+
+CC_TEST(journalConcurrentProducers){
+   const int prdcrsQty{4};
+   const int32_t perPrdcr{20000};
+   ClickEventJournal jrnl(256);   // Smaller than the records produced, the consumer drains while the producers push
+   std::atomic<int> prdcrsDone{0};
+   std::atomic<uint32_t> accptd{0};
+   std::vector<std::thread> thrds;
+   int32_t nxtSeq[prdcrsQty]{};
+   uint32_t drnd{0};
+   bool inOrder{true};
+   ccEvntRcrd_t rcrds[32]{};
+   size_t qty{0};
+   bool prdcrsEnded{false};
+
+   for(int prdcr{0}; prdcr < prdcrsQty; prdcr++){
+      thrds.emplace_back([&, prdcr](){
+         for(int32_t i{0}; i < perPrdcr; i++){
+            if(jrnl.push({0, i, prdcr, ccOpUp}))   // The delta field identifies the producer, the count field its sequence
+               accptd.fetch_add(1);
+         }
+         prdcrsDone.fetch_add(1);
+      });
+   }
+   do{
+      prdcrsEnded = (prdcrsDone.load() == prdcrsQty);   // Read before draining, the records pushed meanwhile are drained in the next pass
+      qty = jrnl.take(rcrds, 32);
+      for(size_t i{0}; i < qty; i++){
+         if(rcrds[i].count < nxtSeq[rcrds[i].delta])   // Each producer records are drained in its pushing order, never twice
+            inOrder = false;
+         nxtSeq[rcrds[i].delta] = rcrds[i].count + 1;
+      }
+      drnd += qty;
+   }while((qty > 0) || !prdcrsEnded);
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   CC_CHECK(inOrder);
+   CC_CHECK_EQ(drnd, accptd.load());
+   CC_CHECK_EQ(drnd + jrnl.getLostQty(), static_cast<uint32_t>(prdcrsQty * perPrdcr));
+}
+
+CC_TEST(journalConcurrentCounting){
+   ClickCounter cntr(0, 100000);
+   ClickEventJournal jrnl(65536);   // Holds every record, none is lost
+   std::vector<std::thread> thrds;
+   ccEvntRcrd_t rcrds[64]{};
+   size_t qty{0};
+   int64_t deltasSum{0};
+
+   cntr.setLockFree(true);
+   CC_CHECK(cntr.setJournal(&jrnl));
+   cntr.begin();
+   jrnl.take(rcrds, 1);   // The begin() restart record
+   for(int thrd{0}; thrd < 4; thrd++){
+      thrds.emplace_back([&cntr, thrd](){
+         for(int i{0}; i < 10000; i++){
+            if((thrd % 2) == 0)
+               cntr.countUp(2);
+            else
+               cntr.countUp();
+         }
+      });
+   }
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   while((qty = jrnl.take(rcrds, 64)) > 0){
+      for(size_t i{0}; i < qty; i++)
+         deltasSum += rcrds[i].delta;
+   }
+   CC_CHECK_EQ(jrnl.getLostQty(), 0U);
+   CC_CHECK_EQ(cntr.getCount(), 60000);
+   CC_CHECK_EQ(deltasSum, static_cast<int64_t>(cntr.getCount()));
+   CC_CHECK(cntr.setJournal(nullptr));
+}
+
+CC_TEST(persistenceRestoresTotal){
+   shimPartitionAdd("cctest", 4 * SPI_FLASH_SEC_SIZE);
+   PartitionStorage strg("cctest");
+   {
+      ClickCountPersist prst(&strg, 10);
+      ClickCounter cntr(0, 1000);
+
+      CC_CHECK(cntr.setPersistence(&prst));
+      CC_CHECK(cntr.getPersistence() == &prst);
+      CC_CHECK(cntr.begin());
+      CC_CHECK(!cntr.setPersistence(nullptr));
+      cntr.countUp(77);
+      CC_CHECK(cntr.end());   // Commits the pending clicks
+   }
+   {
+      ClickCountPersist prst(&strg, 10);
+      ClickCounter cntr(0, 1000);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      CC_CHECK_EQ(cntr.getCount(), 77);
+      CC_CHECK_EQ(cntr.getTotal(), 77);
+   }
+   {
+      ClickCountPersist prst(&strg, 10);
+      ClickCounter cntr(0, 50);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(!cntr.begin(5));   // The restored total doesn't fit the range, it's not replaced by the start value
+      CC_CHECK(cntr.setPersistence(nullptr));
+      CC_CHECK(cntr.begin(5));
+      CC_CHECK_EQ(cntr.getCount(), 5);
+   }
+}
+
+CC_TEST(persistenceStopRace){
+   FileStorage strg("ccPrstRace.bin", 512, 4);
+   ClickCountPersist prst(&strg, 1000, 1);   // Every click crosses the threshold and notifies the commit task
+   ClickCounter cntr(-1000000, 1000000);
+   std::atomic<bool> stop{false};
+   std::vector<std::thread> thrds;
+
+   CC_CHECK(cntr.setPersistence(&prst));
+   CC_CHECK(cntr.begin());
+   shimSetJitter(200, 300);   // Widens the window between reading the task handle and notifying it
+   for(int thrd{0}; thrd < 2; thrd++){
+      thrds.emplace_back([&](){
+         while(!stop.load()){
+            prst.notify(1);
+            prst.flush();
+         }
+      });
+   }
+   for(int i{0}; i < 50; i++){
+      CC_CHECK(prst.end());
+      CC_CHECK(prst.begin(&cntr));
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+   CC_CHECK(cntr.end());
+   CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+   remove("ccPrstRace.bin");
+}
+
+CC_TEST(persistenceTornRecord){
+   uint32_t sctr{0};
+   uint32_t rcrdOffs{0};
+   int64_t total{0};
+
+   remove("ccPrstTorn.bin");
+   {
+      FileStorage strg("ccPrstTorn.bin", 256, 4);
+      ClickCountPersist prst(&strg, 100000);   // Commits only when stopped
+      ClickCounter cntr(0, 1000);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      cntr.countUp(5);
+      CC_CHECK(prst.end());
+      CC_CHECK(prst.begin(&cntr));
+      cntr.countUp(7);
+      CC_CHECK(cntr.end());
+      sctr = prstLastSctr(strg);
+      rcrdOffs = prstLastRcrd(strg, sctr);
+      CC_CHECK(rcrdOffs != 0);   // The +7 record
+      strgFlip(strg, rcrdOffs, 0x10);   // The same bit of the delta and of the check value, a tear a plain XOR check misses
+      strgFlip(strg, rcrdOffs + 4, 0x10);
+   }
+   {
+      FileStorage strg("ccPrstTorn.bin", 256, 4);
+      ClickCountPersist prst(&strg, 100000);
+      ClickCounter cntr(0, 1000);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      CC_CHECK_EQ(cntr.getCount(), 5);   // The torn record is discarded
+      CC_CHECK(cntr.end());
+      CC_CHECK_EQ(prstLastSctr(strg), (sctr + 1) % 4);   // The sector holding the torn record is not written again, a checkpoint is forced
+      CC_CHECK_EQ(prstLastRcrd(strg, (sctr + 1) % 4), 0U);
+   }
+   {
+      FileStorage strg("ccPrstTorn.bin", 256, 4);
+      ClickCountPersist prst(&strg, 100000);
+      ClickCounter cntr(0, 1000);
+
+      CC_CHECK(prst.restore(total));
+      CC_CHECK_EQ(total, 5);
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      cntr.countUp(3);
+      CC_CHECK(cntr.end());
+      CC_CHECK(prstLastRcrd(strg, (sctr + 1) % 4) != 0);   // Records are appended after the new checkpoint
+      CC_CHECK(prst.restore(total));
+      CC_CHECK_EQ(total, 8);
+   }
+   remove("ccPrstTorn.bin");
+}
+
+CC_TEST(persistenceTornCheckpoint){
+   const uint8_t erased[16]{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+   uint32_t sctr{0};
+   int64_t total{0};
+
+   remove("ccPrstCkpt.bin");
+   {
+      FileStorage strg("ccPrstCkpt.bin", 256, 4);
+      ClickCountPersist prst(&strg, 100000);
+      ClickCounter cntr(0, 1000);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      cntr.countUp(10);
+      CC_CHECK(prst.end());
+      sctr = prstLastSctr(strg);
+      CC_CHECK(prst.begin(&cntr));
+      cntr.countUp(5);
+      CC_CHECK(prst.flush(true));
+      CC_CHECK(cntr.end());
+      CC_CHECK_EQ(prstLastSctr(strg), (sctr + 1) % 4);   // The checkpoint started the next sector
+      strg.write(((sctr + 1) % 4) * 256 + 8, erased, sizeof(erased));   // The checkpoint write was cut after the magic and the generation
+   }
+   {
+      FileStorage strg("ccPrstCkpt.bin", 256, 4);
+      ClickCountPersist prst(&strg, 100000);
+      ClickCounter cntr(0, 1000);
+
+      cntr.setPersistence(&prst);
+      CC_CHECK(cntr.begin());
+      CC_CHECK_EQ(cntr.getCount(), 10);   // The previous generation, kept until the new checkpoint was complete
+      cntr.countUp(1);
+      CC_CHECK(cntr.end());
+      CC_CHECK(prst.restore(total));
+      CC_CHECK_EQ(total, 11);
+   }
+   remove("ccPrstCkpt.bin");
+}
+
+CC_TEST(persistenceSectorsWrap){
+   const uint32_t sctrSz{64};   // A checkpoint and 5 records
+   const uint32_t sctrsQty{3};
+   RdCntStorage strg("ccPrstWrap.bin", sctrSz, sctrsQty);
+   int32_t expctd{0};
+   uint32_t rdBytes{0};
+   uint32_t lastSctr{0};
+   uint32_t sctrChngs{0};
+
+   for(int32_t sssn{0}; sssn < 60; sssn++){
+      ClickCountPersist prst(&strg, 100000);
+      ClickCounter cntr(0, 100000);
+
+      cntr.setPersistence(&prst);
+      rdBytes = strg.rdBytes;
+      CC_CHECK(cntr.begin());
+      CC_CHECK((strg.rdBytes - rdBytes) <= ((sctrsQty * prstHdrSz) + (sctrSz - prstHdrSz)));   // The restore reads the headers and one sector, however long the history is
+      CC_CHECK_EQ(cntr.getCount(), expctd);
+      cntr.countUp(sssn + 1);
+      expctd += sssn + 1;
+      if((sssn % 7) == 6)
+         CC_CHECK(prst.flush(true));
+      CC_CHECK(cntr.end());
+      CC_CHECK_EQ(prst.getWriteErrQty(), 0U);
+      if(prstLastSctr(strg) != lastSctr){
+         lastSctr = prstLastSctr(strg);
+         sctrChngs++;
+      }
+   }
+   CC_CHECK(sctrChngs > (3 * sctrsQty));   // The sectors were used round the storage several times
+   remove("ccPrstWrap.bin");
+}
+
+CC_TEST(telemetryBinding){
+   ClickCounter cntr(0, 10);
+   ClickTelemetryEncoder enc(2);
+
+   CC_CHECK(!cntr.setTelemetry(&enc, 2));
+   CC_CHECK(cntr.setTelemetry(&enc, 1));
+   CC_CHECK(cntr.getTelemetry() == &enc);
+   cntr.begin();
+   CC_CHECK(!cntr.setTelemetry(nullptr));
+}
+
+CC_TEST(instrumentationDisabledByDefault){
+   ClickCounter cntr(0, 10);
+   ccInstrData_t instr{};
+   ccInstrSnap_t snap{};
+
+   CC_CHECK(cntr.getInstrumentation() == nullptr);
+   CC_CHECK_EQ(cntr.setInstrumentation(&instr), static_cast<bool>(CC_INSTR_ENABLED));
+   CC_CHECK(cntr.setInstrumentation(nullptr) == static_cast<bool>(CC_INSTR_ENABLED));
+   cntr.begin();
+   cntr.countUp();
+   CC_CHECK(!cntr.getInstrSnapshot(snap));   // No data block associated
+   CC_CHECK(!cntr.setInstrumentation(&instr));   // Already begun
+   CC_CHECK_EQ(snap.opsQty[ccOpUp], 0U);
+}
+
+size_t ccInstrOnSize();
+int32_t ccInstrOnCount(const int32_t &qty, ccInstrData_t* instrPtr);
+
+CC_TEST(instrumentationFlagKeepsLayout){
+   ccInstrData_t instr{};
+
+   CC_CHECK_EQ(ccInstrOnSize(), sizeof(ClickCounter));   // ccInstrLayout.cpp is built with CC_INSTR_ENABLED=1
+   CC_CHECK_EQ(ccInstrOnCount(7, nullptr), 7);
+   CC_CHECK_EQ(ccInstrOnCount(7, &instr), 7);
+}
+//======================================>> Journal, persistence, others END
+
+CC_TEST_MAIN()
@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ * @file ClickDisplayMux_test.cpp
+ *
+ * @brief Host unit tests of the ClickDisplayMux class
+ *
+ * @details The multiplexer task shows several counters in a single SevenSegDisplays mock, the texts printed are checked for the pages labels, the paging, the counters display formats and the values that don't fit. The task stop is exercised while other tasks keep asking for pages.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include <ClickDisplayMux_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+/**
+ * @brief Waits for the display to show a text, the multiplexer prints from its own task.
+ */
+static bool shows(SevenSegDisplays &dsply, const char* txtPtr){
+
+   return waitFor([&](){return dsply.lastTxt() == txtPtr;});
+}
+//================================================>> Test helpers END
+
+CC_TEST(muxPagesAndLabels){
+   SevenSegDisplays dsply(4);
+   ClickDisplayMux mux(&dsply, 0, true, 5);   // No automatic paging
+   ClickCounter cntrA(-99, 999);
+   ClickCounter cntrB(0, 999);
+   uint32_t prntsQty{0};
+
+   CC_CHECK(!mux.begin());   // No counters
+   CC_CHECK(!mux.addCounter(nullptr));
+   CC_CHECK(mux.addCounter(&cntrA, 'A'));
+   CC_CHECK(mux.addCounter(&cntrB));
+   CC_CHECK_EQ(mux.getPagesQty(), 2);
+   CC_CHECK(!mux.showPage(0));   // Not started
+   CC_CHECK(mux.begin());
+   CC_CHECK(!mux.begin());
+   CC_CHECK(!mux.addCounter(&cntrA));
+   CC_CHECK(shows(dsply, "A---"));   // Not begun
+   cntrA.begin(5);
+   CC_CHECK(shows(dsply, "A  5"));
+   cntrA.countDown(12);
+   CC_CHECK(shows(dsply, "A -7"));
+   prntsQty = dsply.prntsQty.load();
+   vTaskDelay(pdMS_TO_TICKS(50));
+   CC_CHECK_EQ(dsply.prntsQty.load(), prntsQty);   // Printed only when the text changes
+   cntrB.begin(42);
+   CC_CHECK(!mux.showPage(2));
+   CC_CHECK(mux.showPage(1));
+   CC_CHECK(shows(dsply, "1 42"));   // The default label is the page index
+   CC_CHECK_EQ(mux.getCurPage(), 1);
+   CC_CHECK(mux.end());
+   CC_CHECK(!mux.end());
+   CC_CHECK(!mux.showPage(0));
+}
+
+CC_TEST(muxAutomaticPaging){
+   SevenSegDisplays dsply(4);
+   ClickDisplayMux mux(&dsply, 30, false, 5);
+   ClickCounter cntrA(0, 9999);
+   ClickCounter cntrB(0, 9999);
+
+   cntrA.begin(1111);
+   cntrB.begin(2222);
+   CC_CHECK(mux.addCounter(&cntrA));
+   CC_CHECK(mux.addCounter(&cntrB));
+   CC_CHECK(mux.begin());
+   CC_CHECK(shows(dsply, "1111"));
+   CC_CHECK(shows(dsply, "2222"));
+   CC_CHECK(shows(dsply, "1111"));
+   CC_CHECK(mux.end());
+}
+
+CC_TEST(muxCountersFormats){
+   SevenSegDisplays dsply(4);
+   ClickDisplayMux mux(&dsply, 0, false, 5);
+   ClickCounter cntrCnt(-100000, 100000);
+   ClickCounter cntrLow(-100000, 100000);
+   ClickCounter cntrScld(-10000000, 10000000);
+   ClickCounter cntrPgs(0, 100000);
+
+   CC_CHECK(cntrLow.setDisplayFormat(ccFmtLowWindow));
+   CC_CHECK(cntrScld.setDisplayFormat(ccFmtScaled));
+   CC_CHECK(cntrPgs.setDisplayFormat(ccFmtPages, 40));
+   CC_CHECK_EQ(cntrPgs.getDisplayFormat(), ccFmtPages);
+   CC_CHECK_EQ(cntrPgs.getDisplayPageMs(), 40U);
+   for(ClickCounter* cntrPtr : {&cntrCnt, &cntrLow, &cntrScld, &cntrPgs}){
+      cntrPtr->begin(12345);
+      CC_CHECK(mux.addCounter(cntrPtr));
+   }
+   CC_CHECK(mux.begin());
+   CC_CHECK(shows(dsply, "----"));   // The count doesn't fit in the display
+   cntrCnt.countRestart(-999);
+   CC_CHECK(shows(dsply, "-999"));
+   CC_CHECK(mux.showPage(1));
+   CC_CHECK(shows(dsply, "2345"));
+   cntrLow.countRestart(10007);
+   CC_CHECK(shows(dsply, "0007"));   // Zero padded, as an odometer
+   cntrLow.countRestart(-3);
+   CC_CHECK(shows(dsply, "9997"));
+   CC_CHECK(mux.showPage(2));
+   CC_CHECK(shows(dsply, " 12k"));
+   cntrScld.countRestart(-1234567);
+   CC_CHECK(shows(dsply, " -1M"));
+   cntrScld.countRestart(-999);
+   CC_CHECK(shows(dsply, "-999"));
+   CC_CHECK(mux.showPage(3));
+   CC_CHECK(shows(dsply, "2345"));   // The low order page first
+   CC_CHECK(shows(dsply, "   1."));
+   CC_CHECK(shows(dsply, "2345"));
+   CC_CHECK(mux.end());
+}
+
+CC_TEST(muxStopRace){
+   SevenSegDisplays dsply(4);
+   ClickDisplayMux mux(&dsply, 0, true, 1);
+   ClickCounter cntrA(0, 999);
+   ClickCounter cntrB(0, 999);
+   std::atomic<bool> stop{false};
+   std::vector<std::thread> thrds;
+
+   cntrA.begin();
+   cntrB.begin();
+   CC_CHECK(mux.addCounter(&cntrA));
+   CC_CHECK(mux.addCounter(&cntrB));
+   shimSetJitter(200, 300);   // Widens the window between reading the task handle and notifying it
+   for(int thrd{0}; thrd < 2; thrd++){
+      thrds.emplace_back([&, thrd](){
+         while(!stop.load())
+            mux.showPage(thrd);
+      });
+   }
+   for(int i{0}; i < 50; i++){
+      CC_CHECK(mux.begin());
+      CC_CHECK(mux.end());
+   }
+   stop = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   shimSetJitter(0);
+   CC_CHECK(waitFor([](){return shimTasksAlive() == 0;}));
+}
+
+CC_TEST_MAIN()
@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource_bench.cpp
+ *
+ * @brief Host benchmark of the QuadraturePulseSource decoding at MHz equivalent edge rates
+ *
+ * @details A simulated encoder moving forward and backward is decoded edge by edge, for each resolution:
+ * - pushState: the lookup table decoding of every phase edge, as the phases interrupt does, in nanoseconds per edge and the equivalent edge rate in MHz.
+ * - pushState + poll: the same decoding with the net pulses delivered to a ClickCounter by pollPulseSource() every 256 edges.
+ * - countUp/Down per edge: a ClickCounter modified edge by edge after decoding the direction with branches, the approach the source replaces.
+ *
+ * The decoded count is checked against the encoder position, the benchmark fails if they differ. Run it with --quick for a short run, as ctest does.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include "ccBench.h"
+
+static const uint8_t grayStates[4]{0, 2, 3, 1};   // Phases states of a forward moving encoder, phase A leading phase B
+static const char* const resNames[3]{"x1", "x2", "x4"};
+
+/**
+ * @brief Encoder position after the edge number iter: it moves 768 quarter steps forward and 256 backward every 1024 edges.
+ */
+static int64_t encPos(const uint32_t &iter){
+   int64_t blck{iter / 1024};
+   int64_t edge{iter % 1024 + 1};
+
+   return blck * 512 + ((edge <= 768)?(edge):(768 - (edge - 768)));
+}
+
+static bool benchRes(const ccQdrtrRes_t &res, const uint32_t &iters){
+   bool result{true};
+   QuadraturePulseSource src(res);
+   QuadraturePulseSource pollSrc(res);
+   ClickCounter pollCntr(INT32_MIN, INT32_MAX);
+   ClickCounter edgeCntr(INT32_MIN, INT32_MAX);
+   int64_t pulses{0};
+   int64_t expctd{encPos(iters - 1) >> (2 - static_cast<uint8_t>(res))};
+   uint8_t prevState{0};
+   double nsPerEdge{0};
+
+   pollCntr.setPulseSource(&pollSrc);
+   pollCntr.begin();
+   edgeCntr.begin();
+   printf("%s\n", resNames[res]);
+   nsPerEdge = ccBenchNsPerOp(iters, [&src](uint32_t iter){
+      src.pushState(grayStates[encPos(iter) & 0x03]);
+   });
+   pulses = src.takePulses();
+   printf("   %-26s %8.2f ns/edge %9.1f MHz\n", "pushState", nsPerEdge, 1000.0 / nsPerEdge);
+   nsPerEdge = ccBenchNsPerOp(iters, [&pollSrc, &pollCntr](uint32_t iter){
+      pollSrc.pushState(grayStates[encPos(iter) & 0x03]);
+      if((iter & 0xFF) == 0xFF)
+         pollCntr.pollPulseSource();
+   });
+   pollCntr.pollPulseSource();
+   printf("   %-26s %8.2f ns/edge %9.1f MHz\n", "pushState + poll", nsPerEdge, 1000.0 / nsPerEdge);
+   nsPerEdge = ccBenchNsPerOp(iters, [&edgeCntr, &prevState](uint32_t iter){
+      uint8_t curState{grayStates[encPos(iter) & 0x03]};
+
+      if(curState == grayStates[(prevState + 1) & 0x03])   // prevState holds the position, modulo 4
+         edgeCntr.countUp();
+      else if(curState != grayStates[prevState])
+         edgeCntr.countDown();
+      prevState = encPos(iter) & 0x03;
+   });
+   printf("   %-26s %8.2f ns/edge %9.1f MHz\n", "countUp/Down per edge", nsPerEdge, 1000.0 / nsPerEdge);
+   if((pulses != expctd) || (pollCntr.getCount() != expctd) || (edgeCntr.getCount() != encPos(iters - 1)) || (src.getErrorQty() != 0)){
+      printf("   decoding MISMATCH: expected %lld, decoded %lld, polled %ld, errors %u\n", static_cast<long long>(expctd), static_cast<long long>(pulses), static_cast<long>(pollCntr.getCount()), src.getErrorQty());
+      result = false;
+   }
+
+   return result;
+}
+
+int main(int argc, char* argv[]){
+   uint32_t iters{ccBenchIters(argc, argv, 20000000, 65536)};
+   bool rslt{true};
+
+   printf("Quadrature decoding, %u phase edges per measure\n", iters);
+   for(ccQdrtrRes_t res : {ccQdrtrX1, ccQdrtrX2, ccQdrtrX4}){
+      if(!benchRes(res, iters))
+         rslt = false;
+   }
+
+   return rslt?(0):(1);
+}
@@ -0,0 +1,273 @@
+/**
+ ******************************************************************************
+ * @file ClickPulseSource_test.cpp
+ *
+ * @brief Host tests of the ClickCounter_ESP32 library pulse sources
+ *
+ * @details The DebouncedPulseSource is fed with synthetic edges streams, built as a contact would produce them (bouncing presses and releases, glitches), and with a recorded stream, replayed through pushEdge() as an ISR or a sampling task would. The same streams are fed through the shimmed input pin interrupt, and through a ClickCounter polling the source.
+ * The QuadraturePulseSource is fed with the phases states of a simulated encoder, checking the decoding at every resolution, the remainders kept between polls and the undecodable transitions counting.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+/**
+ * @brief Appends to the stream a level change of a bouncing contact: bncsQty short pulses of the new level, 50 microseconds each, before it settles.
+ */
+static void bncChng(std::vector<ccEdgeRcrd_t> &edges, uint32_t &tm, const bool &level, const uint8_t &bncsQty){
+   for(uint8_t bnc{0}; bnc < bncsQty; bnc++){
+      edges.push_back({tm, level});
+      tm += 50;
+      edges.push_back({tm, !level});
+      tm += 50;
+   }
+   edges.push_back({tm, level});
+
+   return;
+}
+
+/**
+ * @brief Appends to the stream pressesQty bouncing presses, each one held holdUs microseconds and followed by gapUs microseconds released.
+ */
+static void presses(std::vector<ccEdgeRcrd_t> &edges, uint32_t &tm, const uint32_t &pressesQty, const uint32_t &holdUs = 5000, const uint32_t &gapUs = 5000){
+   for(uint32_t prss{0}; prss < pressesQty; prss++){
+      bncChng(edges, tm, true, 1 + prss % 4);
+      tm += holdUs;
+      bncChng(edges, tm, false, prss % 3);
+      tm += gapUs;
+   }
+
+   return;
+}
+
+/**
+ * @brief Replays an edges stream into the source, debouncing it every chunkQty edges. Returns the clicks accepted, with the last pending level confirmed at nowUs.
+ */
+static int32_t replay(DebouncedPulseSource &src, const std::vector<ccEdgeRcrd_t> &edges, const uint32_t &nowUs, const size_t &chunkQty = 32){
+   int32_t result{0};
+
+   for(size_t edge{0}; edge < edges.size(); edge++){
+      CC_CHECK(src.pushEdge(edges[edge].tmStmp, edges[edge].level));
+      if(((edge + 1) % chunkQty) == 0)
+         result += src.processEdges(edges[edge].tmStmp);
+   }
+   result += src.processEdges(nowUs);
+
+   return result;
+}
+//================================================>> Test helpers END
+
+CC_TEST(debounceBouncingPresses){
+   DebouncedPulseSource src(64, 1000);
+   std::vector<ccEdgeRcrd_t> edges;
+   uint32_t tm{1000};
+
+   presses(edges, tm, 100);
+   CC_CHECK_EQ(replay(src, edges, tm), 100);
+   CC_CHECK_EQ(src.getLostQty(), 0U);
+   CC_CHECK_EQ(src.processEdges(tm + 10000), 0);   // Nothing left pending
+}
+
+CC_TEST(debounceDiscardsGlitches){
+   DebouncedPulseSource src(64, 1000);
+   std::vector<ccEdgeRcrd_t> edges{
+      {1000, true}, {1400, false},   // Glitches shorter than the stable time
+      {3000, true}, {3999, false},
+      {6000, true}, {9000, false},   // A press
+      {9500, true}, {9600, false},   // Contact chatter at the release
+   };
+
+   CC_CHECK_EQ(replay(src, edges, 20000), 1);
+
+   DebouncedPulseSource lowSrc(64, 1000, 0, false);   // Active low input, idle high
+   std::vector<ccEdgeRcrd_t> lowEdges{{1000, true}, {2000, false}, {2100, true}, {2200, false}, {8000, true}, {9000, false}};
+
+   CC_CHECK_EQ(replay(lowSrc, lowEdges, 20000), 2);   // The first edge repeats the idle level, the last press is confirmed by nowUs
+}
+
+CC_TEST(debouncePendingLevelNeedsStableTime){
+   DebouncedPulseSource src(64, 1000);
+
+   CC_CHECK(src.pushEdge(1000, true));
+   CC_CHECK_EQ(src.processEdges(1500), 0);   // Not stable long enough yet
+   CC_CHECK_EQ(src.processEdges(2000), 1);
+   CC_CHECK(src.pushEdge(2500, false));
+   CC_CHECK(src.pushEdge(2600, true));   // A release shorter than the stable time
+   CC_CHECK_EQ(src.processEdges(10000), 0);
+}
+
+CC_TEST(debounceLockout){
+   DebouncedPulseSource src(64, 0, 10000);   // Lockout only: the first edge of each press is counted, the bounces are locked out
+   std::vector<ccEdgeRcrd_t> edges;
+   uint32_t tm{1000};
+
+   presses(edges, tm, 20, 5000, 15000);
+   CC_CHECK_EQ(replay(src, edges, tm), 20);
+   edges.clear();
+   presses(edges, tm, 4, 1000, 1000);   // Presses closer than the lockout time, only the first one of each 10 milliseconds counts
+   CC_CHECK_EQ(replay(src, edges, tm), 1);
+}
+
+CC_TEST(debounceTimestampsWrap){
+   DebouncedPulseSource src(64, 1000);
+   std::vector<ccEdgeRcrd_t> edges;
+   uint32_t tm{0xFFFF0000};
+
+   presses(edges, tm, 20);   // The 32 bits microseconds timestamps wrap in the middle of the stream
+   CC_CHECK(tm < 0xFFFF0000);
+   CC_CHECK_EQ(replay(src, edges, tm), 20);
+}
+
+CC_TEST(debounceRecordedStream){
+   DebouncedPulseSource src(16, 2000, 30000);
+   const ccEdgeRcrd_t rcrdd[]{   // A snap action switch pressed 4 times, recorded at the input pin
+      {120350, true}, {120391, false}, {120433, true}, {120517, false}, {120602, true},
+      {185004, false}, {185090, true}, {185160, false},
+      {240877, true}, {240912, false}, {240990, true},
+      {242110, false}, {242180, true},   // Contact chatter while held, shorter than the stable time
+      {301455, false},
+      {305320, true}, {305600, false},   // A glitch shorter than the stable time
+      {390118, true}, {390160, false}, {390201, true},
+      {452006, false}, {452040, true}, {452073, false},
+      {470100, true}, {480100, false}   // A press 80 milliseconds after the previous one, out of its lockout time
+   };
+   std::vector<ccEdgeRcrd_t> edges(std::begin(rcrdd), std::end(rcrdd));
+
+   CC_CHECK_EQ(replay(src, edges, 500000, 8), 4);
+}
+
+CC_TEST(debounceRingOverflowIsCounted){
+   DebouncedPulseSource src(3, 1000);   // Rounded up to 4 edges
+   uint32_t tm{1000};
+
+   for(uint8_t edge{0}; edge < 4; edge++){
+      CC_CHECK(src.pushEdge(tm, (edge & 1) == 0));
+      tm += 10;
+   }
+   CC_CHECK(!src.pushEdge(tm, true));
+   CC_CHECK_EQ(src.getLostQty(), 1U);
+   CC_CHECK_EQ(src.processEdges(tm), 0);   // The edges are glitches
+   CC_CHECK(src.pushEdge(tm, true));   // Room again after processing
+   CC_CHECK_EQ(src.getLostQty(true), 1U);
+   CC_CHECK_EQ(src.getLostQty(), 0U);
+}
+
+CC_TEST(debounceHighRateStream){
+   DebouncedPulseSource src(1024, 20);   // 20 microseconds of stable time, a 10 kHz clean signal
+   std::vector<ccEdgeRcrd_t> edges;
+   uint32_t tm{1000};
+   const uint32_t pulsesQty{200000};
+
+   edges.reserve(2 * pulsesQty);
+   for(uint32_t pls{0}; pls < pulsesQty; pls++){
+      edges.push_back({tm, true});
+      edges.push_back({tm + 50, false});
+      tm += 100;
+   }
+   CC_CHECK_EQ(replay(src, edges, tm, 512), static_cast<int32_t>(pulsesQty));
+   CC_CHECK_EQ(src.getLostQty(), 0U);
+}
+
+CC_TEST(debounceFeedsCounter){
+   DebouncedPulseSource src(1024, 1000);
+   ClickCounter cntr(0, 1000);
+   std::vector<ccEdgeRcrd_t> edges;
+   uint32_t strtTm{static_cast<uint32_t>(esp_timer_get_time())};
+   uint32_t tm{strtTm};
+
+   CC_CHECK(cntr.setPulseSource(&src));
+   CC_CHECK(cntr.begin());
+   presses(edges, tm, 40);
+   for(const ccEdgeRcrd_t &edge : edges)
+      CC_CHECK(src.pushEdge(edge.tmStmp, edge.level));
+   shimAdvanceTime(tm - strtTm + 2000);   // The recorded time elapses, the last release gets stable
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 40);   // A single count modification for the whole stream
+}
+
+CC_TEST(debounceFromPinInterrupt){
+   DebouncedPulseSource src(64, 1000);
+   ClickCounter cntr(0, 1000);
+
+   shimPinSet(7, false);
+   CC_CHECK(src.begin(7));
+   CC_CHECK(!src.begin(7));
+   cntr.setPulseSource(&src);
+   cntr.begin();
+   for(uint8_t prss{0}; prss < 10; prss++){
+      for(uint8_t bnc{0}; bnc < 3; bnc++){   // Bounces microseconds apart
+         shimPinSet(7, true);
+         shimPinSet(7, false);
+      }
+      shimPinSet(7, true);
+      shimAdvanceTime(5000);
+      shimPinSet(7, false);
+      shimPinSet(7, true);
+      shimPinSet(7, false);
+      shimAdvanceTime(5000);
+      CC_CHECK(cntr.pollPulseSource());
+   }
+   CC_CHECK_EQ(cntr.getCount(), 10);
+   CC_CHECK_EQ(src.getLostQty(), 0U);
+}
+
+CC_TEST(quadratureResolutions){
+   const uint8_t fwdStates[4]{2, 3, 1, 0};   // Phase A leading phase B, from the 00 state
+   const int32_t qrtrsQty{4 * 25 + 3};
+
+   for(ccQdrtrRes_t res : {ccQdrtrX1, ccQdrtrX2, ccQdrtrX4}){
+      QuadraturePulseSource src(res);
+      int32_t pulses{0};
+
+      for(int32_t qrtr{0}; qrtr < qrtrsQty; qrtr++){
+         src.pushState(fwdStates[qrtr & 0x03]);
+         src.pushState(fwdStates[qrtr & 0x03]);   // Repeated samples produce no step
+         if((qrtr % 7) == 0)
+            pulses += src.takePulses();   // The pulse fractions are kept between polls
+      }
+      pulses += src.takePulses();
+      CC_CHECK_EQ(pulses, qrtrsQty >> (2 - static_cast<uint8_t>(res)));
+      for(int32_t qrtr{qrtrsQty - 2}; qrtr >= -1; qrtr--)   // Back to the starting position
+         src.pushState(fwdStates[qrtr & 0x03]);
+      pulses += src.takePulses();
+      CC_CHECK_EQ(pulses, 0);
+      CC_CHECK_EQ(src.getErrorQty(), 0U);
+   }
+}
+
+CC_TEST(quadratureErrorsAndCounter){
+   QuadraturePulseSource src;
+   ClickCounter cntr(-100, 100);
+
+   cntr.setPulseSource(&src);
+   cntr.begin();
+   src.pushState(2);
+   src.pushState(3);
+   src.pushState(0);   // Both phases changed, an edge was missed
+   src.pushState(1);   // Backwards from 00
+   CC_CHECK_EQ(src.getErrorQty(true), 1U);
+   CC_CHECK_EQ(src.getErrorQty(), 0U);
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), 1);   // +1 +1 (undecodable) -1
+   for(uint8_t cycl{0}; cycl < 10; cycl++){
+      for(uint8_t state : {3, 2, 0, 1})   // Phase B leading phase A
+         src.pushState(state);
+   }
+   CC_CHECK(cntr.pollPulseSource());
+   CC_CHECK_EQ(cntr.getCount(), -39);
+}
+
+CC_TEST_MAIN()
@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file ClickTelemetry_test.cpp
+ *
+ * @brief Host unit tests of the ClickTelemetryEncoder and ClickTelemetryDecoder classes
+ *
+ * @details The frames built by the encoder are fed to the decoder, whole or in chunks of random sizes, and the decoded values are checked against the encoded ones: random deltas, delta frames carrying only the changed channels, key frames, a decoder started in the middle of the stream, the resynchronization after corrupted bytes and the zigzag encoding of the int32_t range limits.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <random>
+#include <vector>
+#include <ClickTelemetry_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+/**
+ * @brief Encoder and channels values of a test, the channels are bound when built.
+ */
+struct TlmSrc{
+   std::vector<std::atomic<int32_t>> vals;
+   ClickTelemetryEncoder enc;
+   std::vector<uint8_t> frmBuf;
+
+   TlmSrc(const size_t &chnlsQty, const uint16_t &keyFrmIntvl = 0)
+   :vals(chnlsQty), enc(chnlsQty, keyFrmIntvl)
+   {
+      for(size_t chnl{0}; chnl < chnlsQty; chnl++)
+         enc.bindChannel(chnl, &vals[chnl]);
+      frmBuf.resize(enc.getMaxFrameSize());
+   }
+   void set(const size_t &chnl, const int32_t &val){
+      vals[chnl].store(val);
+      enc.markChanged(chnl);
+
+      return;
+   }
+   std::vector<uint8_t> frame(){
+      size_t frmLen{enc.buildFrame(frmBuf.data(), frmBuf.size())};
+
+      return std::vector<uint8_t>(frmBuf.begin(), frmBuf.begin() + frmLen);
+   }
+};
+
+/**
+ * @brief Checks every decoded value equals its encoded value.
+ */
+static bool sameVals(TlmSrc &src, ClickTelemetryDecoder &dec){
+   bool result{true};
+
+   for(size_t chnl{0}; chnl < src.vals.size(); chnl++){
+      if(dec.getValue(chnl) != src.vals[chnl].load())
+         result = false;
+   }
+
+   return result;
+}
+//================================================>> Test helpers END
+
+CC_TEST(tlmRoundTripRandomDeltas){
+   const size_t chnlsQty{40};
+   TlmSrc src(chnlsQty);
+   ClickTelemetryDecoder dec(chnlsQty);
+   std::minstd_rand rng(7);
+   std::vector<uint8_t> strm;
+   std::vector<uint8_t> frm;
+   size_t frmsQty{0};
+   size_t pos{0};
+   size_t chnkSz{0};
+   size_t applied{0};
+
+   for(int round{0}; round < 200; round++){
+      for(int chng{0}; chng < 5; chng++)
+         src.set(rng() % chnlsQty, static_cast<int32_t>((rng() % 2)?(rng() % 200):(rng() << 1)) - 100);   // Short and full width deltas
+      frm = src.frame();
+      if(!frm.empty()){
+         CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+         CC_CHECK(sameVals(src, dec));
+         strm.insert(strm.end(), frm.begin(), frm.end());
+         frmsQty++;
+      }
+   }
+   CC_CHECK_EQ(dec.getFrameErrQty(), 0U);
+   CC_CHECK_EQ(dec.getLostQty(), 0U);
+
+   ClickTelemetryDecoder strmDec(chnlsQty);   // The same stream, received in chunks of random sizes
+
+   while(pos < strm.size()){
+      chnkSz = 1 + (rng() % 23);
+      if(chnkSz > (strm.size() - pos))
+         chnkSz = strm.size() - pos;
+      applied += strmDec.feed(strm.data() + pos, chnkSz);
+      pos += chnkSz;
+   }
+   CC_CHECK_EQ(applied, frmsQty);
+   CC_CHECK(sameVals(src, strmDec));
+   CC_CHECK_EQ(strmDec.getFrameErrQty(), 0U);
+}
+
+CC_TEST(tlmChangedOnlyChannels){
+   const size_t chnlsQty{100};
+   TlmSrc src(chnlsQty);
+   ClickTelemetryDecoder dec(chnlsQty);
+   std::vector<uint8_t> frm{src.frame()};
+
+   CC_CHECK_EQ(frm.size(), 5U + (chnlsQty * 2) + 2);   // The first frame is a key frame, all the values are 0
+   CC_CHECK_EQ(frm[4], 1);
+   CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+   CC_CHECK(src.frame().empty());   // Nothing changed
+   src.enc.markChanged(10);
+   CC_CHECK(src.frame().empty());   // Marked with the same value, nothing to send
+   src.set(3, 1);
+   src.set(4, -1);
+   src.set(99, 64);
+   frm = src.frame();
+   CC_CHECK_EQ(frm[4], 0);   // A delta frame
+   CC_CHECK_EQ(frm.size(), 5U + 2 + 2 + 3 + 2);   // Channel 4 follows 3, channel 99 takes a two bytes gap and a two bytes delta
+   CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+   CC_CHECK(sameVals(src, dec));
+   CC_CHECK(!src.enc.bindChannel(chnlsQty, &src.vals[0]));
+   CC_CHECK(!src.enc.bindChannel(chnlsQty, nullptr));
+}
+
+CC_TEST(tlmKeyFrames){
+   TlmSrc src(4, 3);
+   ClickTelemetryDecoder dec(4);
+   std::vector<uint8_t> frm;
+   uint8_t frmTypes[8]{};
+
+   for(int i{0}; i < 8; i++){
+      src.set(i % 4, i + 1);
+      frm = src.frame();
+      frmTypes[i] = frm[4];
+      if(i != 5)   // One delta frame lost
+         dec.decodeFrame(frm.data(), frm.size());
+      if(i == 6){
+         CC_CHECK(!dec.isSynced());   // The values are kept until the next key frame
+         CC_CHECK_EQ(dec.getLostQty(), 1U);
+         CC_CHECK_EQ(dec.getValue(1), 6 - 4);
+      }
+   }
+   CC_CHECK_EQ(frmTypes[0], 1);   // Key frame, delta frames, key frame every 3 delta frames
+   CC_CHECK_EQ(frmTypes[1], 0);
+   CC_CHECK_EQ(frmTypes[3], 0);
+   CC_CHECK_EQ(frmTypes[4], 1);
+   CC_CHECK_EQ(frmTypes[7], 0);
+   CC_CHECK(!dec.isSynced());
+   src.enc.requestKeyFrame();
+   src.set(0, 50);
+   frm = src.frame();
+   CC_CHECK_EQ(frm[4], 1);
+   CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+   CC_CHECK(dec.isSynced());
+   CC_CHECK(sameVals(src, dec));
+   src.vals[2].store(0);   // A key frame carries the channels values unmarked too, the decoder clears the values not sent
+   src.enc.bindChannel(2, nullptr);
+   frm = src.frame();
+   CC_CHECK_EQ(frm[4], 1);
+   CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+   CC_CHECK_EQ(dec.getValue(2), 0);
+   CC_CHECK(sameVals(src, dec));
+}
+
+CC_TEST(tlmDecoderStartsMidStream){
+   TlmSrc src(8, 10);
+   std::vector<uint8_t> strm;
+   std::vector<uint8_t> frm;
+   size_t keyPos{0};
+
+   for(int i{0}; i < 30; i++){
+      src.set(i % 8, (i % 2)?(0x5A5A5A00 + i):(-i * 0xA5A5));   // Values that put sync bytes in the payloads
+      frm = src.frame();
+      if((i == 11) && (frm[4] == 1))
+         keyPos = strm.size();
+      strm.insert(strm.end(), frm.begin(), frm.end());
+   }
+   CC_CHECK(keyPos != 0);
+   for(size_t strt{1}; strt < keyPos; strt += 3){   // Any starting byte before the key frame ends synchronized
+      ClickTelemetryDecoder dec(8);
+
+      dec.feed(strm.data() + strt, strm.size() - strt);
+      CC_CHECK(dec.isSynced());
+      CC_CHECK(sameVals(src, dec));
+   }
+}
+
+CC_TEST(tlmResyncAfterCorruption){
+   TlmSrc src(6);
+   ClickTelemetryDecoder dec(6);
+   std::vector<uint8_t> strm{0xA5, 0x05, 0x00, 0x11};   // A false sync byte with a valid length, it takes the key frame bytes
+   std::vector<uint8_t> frm;
+   std::vector<uint8_t> crptdFrm;
+
+   src.set(0, 1000);
+   frm = src.frame();
+   strm.insert(strm.end(), frm.begin(), frm.end());
+   CC_CHECK_EQ(dec.feed(strm.data(), strm.size()), 1U);   // The key frame is found after the false frame fails its CRC
+   CC_CHECK(dec.isSynced());
+   CC_CHECK_EQ(dec.getValue(0), 1000);
+   CC_CHECK(dec.getFrameErrQty(true) >= 1);
+   src.set(1, -7);
+   crptdFrm = src.frame();
+   crptdFrm[crptdFrm.size() - 3] ^= 0x01;
+   src.enc.requestKeyFrame();
+   src.set(2, 0xA5);
+   frm = src.frame();
+   strm = crptdFrm;
+   strm.insert(strm.end(), frm.begin(), frm.end());
+   CC_CHECK_EQ(dec.feed(strm.data(), strm.size()), 1U);   // The corrupted delta frame is dropped, the key frame following it is applied
+   CC_CHECK_EQ(dec.getFrameErrQty(), 1U);
+   CC_CHECK(dec.isSynced());
+   CC_CHECK(sameVals(src, dec));
+   strm = {0xA5, 0xFF, 0xFF, 0xA5};   // A length no frame has, the search resumes in the next byte
+   src.set(3, 3);
+   frm = src.frame();
+   strm.insert(strm.end(), frm.begin(), frm.end());
+   CC_CHECK_EQ(dec.feed(strm.data(), strm.size()), 1U);
+   CC_CHECK(sameVals(src, dec));
+   CC_CHECK(!dec.decodeFrame(frm.data(), frm.size() - 1));   // Truncated
+   CC_CHECK(!dec.decodeFrame(nullptr, frm.size()));
+}
+
+CC_TEST(tlmZigzagLimits){
+   TlmSrc src(3);
+   ClickTelemetryDecoder dec(3);
+   std::vector<uint8_t> frm;
+   const int32_t vals[]{INT32_MAX, INT32_MIN, -1, INT32_MAX, 0, INT32_MIN};
+
+   src.set(0, INT32_MIN);
+   src.set(1, INT32_MAX);
+   frm = src.frame();
+   CC_CHECK_EQ(frm[4], 1);
+   CC_CHECK_EQ(frm.size(), 5U + (1 + 5) + (1 + 5) + (1 + 1) + 2);   // The limits zigzag values take the five bytes varints
+   CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+   CC_CHECK_EQ(dec.getValue(0), INT32_MIN);
+   CC_CHECK_EQ(dec.getValue(1), INT32_MAX);
+   for(int32_t val : vals){   // Deltas wrapping around the int32_t range
+      src.set(0, val);
+      src.set(1, -val - 1);
+      frm = src.frame();
+      CC_CHECK_EQ(frm[4], 0);
+      CC_CHECK(dec.decodeFrame(frm.data(), frm.size()));
+      CC_CHECK(sameVals(src, dec));
+   }
+   CC_CHECK_EQ(dec.getFrameErrQty(), 0U);
+}
+
+CC_TEST_MAIN()
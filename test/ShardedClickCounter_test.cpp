@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @file ShardedClickCounter_test.cpp
+ *
+ * @brief Host unit tests of the ShardedClickCounter class
+ *
+ * @details The shards allowances reservation, return and fold are exercised with threads mapped to each of the shim cores: the counting operations must fail only when the real count would get out of the valid range, the count must be exact after concurrent counting up and down, and getCount() must never see a shard fold half done.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <random>
+#include <thread>
+#include <vector>
+#include <ShardedClickCounter_Esp32.h>
+#include "ccTest.h"
+
+//==============================================>> Test helpers BEGIN
+/**
+ * @brief Runs a function in a thread the shim maps to the core provided.
+ *
+ * The shim maps the threads to the cores by their id, and the id of a joined thread is reused by the next one: the threads mapped to other cores are kept waiting until one mapped to the core provided is found.
+ */
+template <typename F>
+static void runInCore(const BaseType_t &core, F fn){
+   std::atomic<bool> rls{false};
+   std::atomic<int> found{-1};
+   std::vector<std::thread> thrds;
+
+   while(found.load() != 1){
+      found = -1;
+      thrds.emplace_back([&](){
+         if(xPortGetCoreID() == core){
+            fn();
+            found = 1;
+         }
+         else{
+            found = 0;
+            while(!rls.load())
+               std::this_thread::yield();
+         }
+      });
+      while(found.load() == -1)
+         std::this_thread::yield();
+   }
+   rls = true;
+   for(std::thread &thrd : thrds)
+      thrd.join();
+
+   return;
+}
+//================================================>> Test helpers END
+
+CC_TEST(shardedBeginEnd){
+   ShardedClickCounter cntr(-10, 10, 4);
+   ShardedClickCounter emptyCntr(5, 5);
+
+   CC_CHECK(!emptyCntr.begin(5));
+   CC_CHECK(!cntr.countUp());   // Not begun
+   CC_CHECK(!cntr.begin(11));
+   CC_CHECK(cntr.begin(-3));
+   CC_CHECK(!cntr.begin());
+   CC_CHECK_EQ(cntr.getCount(), -3);
+   CC_CHECK_EQ(cntr.getStartVal(), -3);
+   CC_CHECK_EQ(cntr.getMinCountVal(), -10);
+   CC_CHECK_EQ(cntr.getMaxCountVal(), 10);
+   CC_CHECK(!cntr.countUp(0));
+   CC_CHECK(cntr.countUp(-5));   // The absolute value is used
+   CC_CHECK_EQ(cntr.getCount(), 2);
+   CC_CHECK(!cntr.countRestart(-11));
+   CC_CHECK(cntr.countRestart(7));
+   CC_CHECK_EQ(cntr.getCount(), 7);
+   CC_CHECK(cntr.countReset());
+   CC_CHECK_EQ(cntr.getCount(), -3);
+   CC_CHECK(cntr.end());
+   CC_CHECK(!cntr.end());
+   CC_CHECK(!cntr.countUp());
+}
+
+CC_TEST(shardedFailsOnlyOutOfRange){
+   ShardedClickCounter cntr(0, 100, 64);
+
+   cntr.begin(50);
+   runInCore(0, [&](){
+      CC_CHECK(cntr.countUp(10));   // The shard reserves all the up allowance left
+   });
+   runInCore(1, [&](){
+      CC_CHECK(cntr.countUp(40));   // Served by returning the allowance held by the other shard
+      CC_CHECK(!cntr.countUp());
+      CC_CHECK_EQ(cntr.getCount(), 100);
+   });
+   runInCore(0, [&](){
+      CC_CHECK(!cntr.countUp());
+      CC_CHECK(cntr.countDown(70));
+   });
+   runInCore(1, [&](){
+      CC_CHECK(cntr.countDown(30));
+      CC_CHECK(!cntr.countDown());
+   });
+   runInCore(0, [&](){
+      CC_CHECK(!cntr.countDown());
+      CC_CHECK(!cntr.countDown(101));
+      CC_CHECK(cntr.countUp(100));
+      CC_CHECK(!cntr.countUp());
+   });
+   CC_CHECK_EQ(cntr.getCount(), 100);
+}
+
+CC_TEST(shardedFullRangeDoesntOverflow){
+   ShardedClickCounter cntr(INT32_MIN, INT32_MAX, 64);
+
+   cntr.begin(INT32_MAX - 5);
+   runInCore(0, [&](){
+      CC_CHECK(cntr.countUp(5));
+      CC_CHECK(!cntr.countUp());
+      CC_CHECK(cntr.countDown(INT32_MAX));
+   });
+   runInCore(1, [&](){
+      CC_CHECK(cntr.countDown(INT32_MAX));
+      CC_CHECK(!cntr.countDown(2));
+      CC_CHECK(cntr.countDown());
+      CC_CHECK_EQ(cntr.getCount(), INT32_MIN);
+   });
+   CC_CHECK(cntr.countRestart(INT32_MIN));
+   runInCore(0, [&](){
+      for(int i{0}; i < 3; i++)
+         CC_CHECK(cntr.countUp(1 << 30));   // The shard contribution grows past INT32_MAX before the pool runs dry and folds it
+      CC_CHECK_EQ(cntr.getCount(), 1 << 30);   // INT32_MIN + 3 * 2^30
+      CC_CHECK(cntr.countUp(INT32_MAX - cntr.getCount()));
+      CC_CHECK(!cntr.countUp());
+   });
+   CC_CHECK_EQ(cntr.getCount(), INT32_MAX);
+}
+
+CC_TEST(shardedConcurrentCountsAreExact){
+   const int thrdsQty{4};
+   const int32_t opsPerThrd{50000};
+   ShardedClickCounter cntr(-1000, 1000, 8);   // A narrow range and a small slack force frequent reservations and folds
+   std::atomic<int64_t> accptd{0};
+   std::vector<std::thread> thrds;
+
+   cntr.begin(0);
+   for(int thrd{0}; thrd < thrdsQty; thrd++){
+      thrds.emplace_back([&, thrd](){
+         std::minstd_rand rng(thrd + 1);
+         int64_t locAccptd{0};
+         int32_t qty{0};
+
+         for(int32_t op{0}; op < opsPerThrd; op++){
+            qty = static_cast<int32_t>(rng() % 50) + 1;
+            if(((rng() >> 4) % 2) == 0){
+               if(cntr.countUp(qty))
+                  locAccptd += qty;
+            }
+            else{
+               if(cntr.countDown(qty))
+                  locAccptd -= qty;
+            }
+         }
+         accptd.fetch_add(locAccptd);
+      });
+   }
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   CC_CHECK_EQ(static_cast<int64_t>(cntr.getCount()), accptd.load());
+   CC_CHECK(cntr.countRestart(1000));   // The allowances are rebuilt from the new count
+   CC_CHECK(!cntr.countUp());
+   CC_CHECK(cntr.countDown(2000));
+   CC_CHECK(!cntr.countDown());
+}
+
+CC_TEST(shardedReadsDuringFolds){
+   const int32_t cntMax{2000000};
+   ShardedClickCounter cntr(0, cntMax, 100000);   // Each reservation takes a big slice of the pool, the shards run it dry and get folded often
+   std::atomic<bool> stop{false};
+   std::atomic<uint32_t> badReads{0};
+   std::vector<std::thread> thrds;
+   std::thread rdr;
+
+   cntr.begin(0);
+   rdr = std::thread([&](){
+      int32_t lastCnt{0};
+      int32_t cnt{0};
+
+      while(!stop.load()){
+         cnt = cntr.getCount();
+         if((cnt < lastCnt) || (cnt > cntMax))   // Counting only up, a fold seen half done reads a lower or a doubled count
+            badReads.fetch_add(1);
+         lastCnt = cnt;
+      }
+   });
+   for(int thrd{0}; thrd < 4; thrd++){
+      thrds.emplace_back([&](){
+         while(cntr.countUp(3))
+            ;
+      });
+   }
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   stop = true;
+   rdr.join();
+   CC_CHECK_EQ(badReads.load(), 0U);
+   CC_CHECK(cntr.getCount() > (cntMax - 3));
+   if(cntr.getCount() < cntMax)
+      CC_CHECK(cntr.countUp(cntMax - cntr.getCount()));
+   CC_CHECK_EQ(cntr.getCount(), cntMax);
+}
+
+CC_TEST_MAIN()
@@ -0,0 +1,123 @@
+/**
+ ******************************************************************************
+ * @file ccAllocHook.h
+ *
+ * @brief Heap allocations counter for the ClickCounter_ESP32 library host tests and benchmarks
+ *
+ * @details Replaces the global operator new and operator delete variants with versions that count the allocations and the bytes requested by each thread, so a test can check that a code path allocates no memory, and a benchmark can measure the heap footprint of the objects it builds. The library allocates its memory only with operator new (the shimmed FreeRTOS services too), so no malloc() hook is needed.
+ * The replacements are definitions: the file must be included by a single translation unit of each executable.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#ifndef _CCALLOCHOOK_H_
+#define _CCALLOCHOOK_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"   // The replacements pair operator new and delete over malloc() and free()
+
+/**
+ * @brief Allocations made by a thread, see ccAllocs()
+ */
+struct ccAllocs_t{
+   uint64_t qty;  /*!< Quantity of allocations */
+   uint64_t bytes;   /*!< Bytes requested by the allocations */
+};
+
+/**
+ * @brief Returns the allocations counters of the invoking thread, never decremented by the deallocations.
+ */
+inline ccAllocs_t& ccAllocs(){
+   static thread_local ccAllocs_t allocs{0, 0};
+
+   return allocs;
+}
+
+static void* ccAllocCnt(const size_t &sz){
+   void* result{malloc((sz > 0)?(sz):(1))};
+
+   if(result != nullptr){
+      ccAllocs().qty++;
+      ccAllocs().bytes += sz;
+   }
+
+   return result;
+}
+
+void* operator new(size_t sz){
+   void* result{ccAllocCnt(sz)};
+
+   if(result == nullptr)
+      throw std::bad_alloc();
+
+   return result;
+}
+
+void* operator new[](size_t sz){
+
+   return operator new(sz);
+}
+
+void* operator new(size_t sz, const std::nothrow_t&) noexcept{
+
+   return ccAllocCnt(sz);
+}
+
+void* operator new[](size_t sz, const std::nothrow_t&) noexcept{
+
+   return ccAllocCnt(sz);
+}
+
+void operator delete(void* ptr) noexcept{
+   free(ptr);
+
+   return;
+}
+
+void operator delete[](void* ptr) noexcept{
+   free(ptr);
+
+   return;
+}
+
+void operator delete(void* ptr, size_t) noexcept{
+   free(ptr);
+
+   return;
+}
+
+void operator delete[](void* ptr, size_t) noexcept{
+   free(ptr);
+
+   return;
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept{
+   free(ptr);
+
+   return;
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept{
+   free(ptr);
+
+   return;
+}
+
+#pragma GCC diagnostic pop
+
+#endif   // _CCALLOCHOOK_H_
@@ -0,0 +1,111 @@
+/**
+ ******************************************************************************
+ * @file ccBench.h
+ *
+ * @brief Minimal benchmarking support for the ClickCounter_ESP32 library host benchmarks
+ *
+ * @details Provides the per operation latency and the multi thread throughput measurements used by the benchmarks. The figures are host figures: they compare the library modes and spot regressions, they are not the ESP32 figures, that depend on the core clock, the flash cache and the FreeRTOS scheduler.
+ * Every benchmark executable accepts the --quick argument, used by ctest to run it with a small iterations quantity.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#ifndef _CCBENCH_H_
+#define _CCBENCH_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Returns the iterations quantity to use, the quick one if the benchmark was run with the --quick argument.
+ */
+inline uint32_t ccBenchIters(int argc, char* argv[], const uint32_t &fullIters, const uint32_t &quickIters){
+   uint32_t result{fullIters};
+
+   for(int arg{1}; arg < argc; arg++){
+      if(strcmp(argv[arg], "--quick") == 0)
+         result = quickIters;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Measures the mean latency of an operation.
+ *
+ * @param iters Quantity of times the operation is executed.
+ * @param opFn Operation to measure, invoked with the iteration number.
+ *
+ * @return The mean time of each operation, in nanoseconds.
+ */
+template <typename F>
+double ccBenchNsPerOp(const uint32_t &iters, F opFn){
+   std::chrono::steady_clock::time_point strt{std::chrono::steady_clock::now()};
+
+   for(uint32_t iter{0}; iter < iters; iter++)
+      opFn(iter);
+
+   return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - strt).count()) / iters;
+}
+
+/**
+ * @brief Measures the throughput of an operation executed concurrently by several threads.
+ *
+ * @param thrdsQty Quantity of threads executing the operation.
+ * @param itersPerThrd Quantity of times each thread executes the operation.
+ * @param opFn Operation to measure, invoked with the thread number and the iteration number.
+ *
+ * @return The operations executed per second by all the threads, in millions.
+ */
+template <typename F>
+double ccBenchMops(const uint8_t &thrdsQty, const uint32_t &itersPerThrd, F opFn){
+   std::atomic<uint8_t> rdyQty{0};
+   std::atomic<bool> go{false};
+   std::vector<std::thread> thrds;
+   std::chrono::steady_clock::time_point strt{};
+   double elpsdNs{0};
+
+   for(uint8_t thrd{0}; thrd < thrdsQty; thrd++){
+      thrds.emplace_back([&, thrd](){
+         rdyQty.fetch_add(1);
+         while(!go.load())
+            std::this_thread::yield();
+         for(uint32_t iter{0}; iter < itersPerThrd; iter++)
+            opFn(thrd, iter);
+      });
+   }
+   while(rdyQty.load() < thrdsQty)
+      std::this_thread::yield();
+   strt = std::chrono::steady_clock::now();
+   go.store(true);
+   for(std::thread &thrd : thrds)
+      thrd.join();
+   elpsdNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - strt).count());
+
+   return (static_cast<double>(thrdsQty) * itersPerThrd * 1000.0) / elpsdNs;
+}
+
+/**
+ * @brief Keeps the compiler from optimizing away a computed value.
+ */
+template <typename T>
+inline void ccBenchKeep(const T &val){
+   asm volatile("" : : "g"(val) : "memory");
+}
+
+#endif   // _CCBENCH_H_
@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * @file ccInstrLayout.cpp
+ *
+ * @brief Translation unit of the ClickCounter_test executable built with the instrumentation flag set
+ *
+ * @details The library and the rest of the tests are built with CC_INSTR_ENABLED unset (0), this file is built with it set to 1 (see CMakeLists.txt), so the test can check that a ClickCounter declared by an application built with a different flag value than the library has the same layout and works.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <ClickCounter_Esp32.h>
+
+static_assert(CC_INSTR_ENABLED == 1, "ccInstrLayout.cpp must be built with CC_INSTR_ENABLED=1");
+
+size_t ccInstrOnSize(){
+
+   return sizeof(ClickCounter);
+}
+
+int32_t ccInstrOnCount(const int32_t &qty, ccInstrData_t* instrPtr){
+   ClickCounter cntr(0, 100);
+
+   cntr.setInstrumentation(instrPtr);
+   cntr.begin();
+   cntr.countUp(qty);
+   cntr.countUp(100);   // Rejected, out of range
+
+   return cntr.getCount();
+}
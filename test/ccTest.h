@@ -0,0 +1,126 @@
+/**
+ ******************************************************************************
+ * @file ccTest.h
+ *
+ * @brief Minimal unit test support for the ClickCounter_ESP32 library host tests
+ *
+ * @details Each test is declared with CC_TEST(name), checks its conditions with CC_CHECK() and CC_CHECK_EQ(), and is run by the main function defined by CC_TEST_MAIN(). A failed check is reported with its file and line, and the test keeps running. The test executable returns 0 only if every check passed, as ctest expects.
+ * Running the executable with a test name as argument runs only the tests whose names contain it.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#ifndef _CCTEST_H_
+#define _CCTEST_H_
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct ccTestCase_t{
+   const char* name;
+   void (*fn)();
+};
+
+inline std::vector<ccTestCase_t>& ccTests(){
+   static std::vector<ccTestCase_t> tests;
+
+   return tests;
+}
+
+inline unsigned long& ccTestFails(){
+   static unsigned long fails{0};
+
+   return fails;
+}
+
+struct ccTestReg{
+   ccTestReg(const char* name, void (*fn)()){
+      ccTests().push_back({name, fn});
+   }
+};
+
+#define CC_TEST(testName) \
+   static void testName(); \
+   static ccTestReg testName##Reg(#testName, testName); \
+   static void testName()
+
+#define CC_CHECK(cond) \
+   do{ \
+      if(!(cond)){ \
+         ccTestFails()++; \
+         printf("   FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      } \
+   }while(0)
+
+#define CC_CHECK_EQ(actual, expected) \
+   do{ \
+      auto ccActVal = (actual); \
+      auto ccExpVal = (expected); \
+      if(!(ccActVal == ccExpVal)){ \
+         ccTestFails()++; \
+         printf("   FAILED %s:%d: %s == %s (%s vs %s)\n", __FILE__, __LINE__, #actual, #expected, std::to_string(ccActVal).c_str(), std::to_string(ccExpVal).c_str()); \
+      } \
+   }while(0)
+
+/**
+ * @brief Waits until a condition is met, as the results of the library tasks are asynchronous.
+ *
+ * @return The last condition evaluation, false if the time out expired before it was met.
+ */
+template <typename P>
+inline bool waitFor(P pred, const uint32_t &ms = 2000){
+   bool result{pred()};
+
+   for(uint32_t elpsd{0}; !result && (elpsd < ms); elpsd++){
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      result = pred();
+   }
+
+   return result;
+}
+
+/**
+ * @brief Callback that counts its executions in the std::atomic<uint32_t> pointed by its argument.
+ */
+inline void cntCall(void* argPtr){
+   static_cast<std::atomic<uint32_t>*>(argPtr)->fetch_add(1);
+
+   return;
+}
+
+#define CC_TEST_MAIN() \
+   int main(int argc, char* argv[]){ \
+      unsigned long testsRun{0}; \
+      unsigned long testsFailed{0}; \
+      for(const ccTestCase_t &tst : ccTests()){ \
+         if((argc < 2) || (strstr(tst.name, argv[1]) != nullptr)){ \
+            unsigned long prevFails{ccTestFails()}; \
+            printf("[ RUN  ] %s\n", tst.name); \
+            fflush(stdout); \
+            tst.fn(); \
+            testsRun++; \
+            if(ccTestFails() != prevFails) \
+               testsFailed++; \
+            printf("[ %s ] %s\n", (ccTestFails() != prevFails)?("FAIL"):(" OK "), tst.name); \
+         } \
+      } \
+      printf("%lu tests run, %lu failed\n", testsRun, testsFailed); \
+      return (testsFailed == 0)?(0):(1); \
+   }
+
+#endif   // _CCTEST_H_
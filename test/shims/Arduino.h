@@ -0,0 +1,11 @@
+/**
+ * @file Arduino.h
+ *
+ * @brief Host build stand-in of the Arduino framework header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_ARDUINO_H_
+#define _CCSHIM_ARDUINO_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_ARDUINO_H_
@@ -0,0 +1,124 @@
+/**
+ * @file SevenSegDisplays.h
+ *
+ * @brief Host build mock of the SevenSegDisplays library display class
+ *
+ * @details The mock keeps the display digits quantity, records every print, and can be made to fail or to take a time to print, to test the ClickCounter display paths without hardware.
+ */
+#ifndef _CCSHIM_SEVENSEGDISPLAYS_H_
+#define _CCSHIM_SEVENSEGDISPLAYS_H_
+
+#include <ccHostShim.h>
+#include <chrono>
+#include <thread>
+
+class SevenSegDisplays{
+private:
+   uint8_t _dgtsQty;
+   mutable std::mutex _mtx;
+   std::string _lastTxt{};
+   int32_t _lastVal{0};
+   bool _lastRgthAlgn{false};
+   bool _lastZeroPad{false};
+   bool _lastWasVal{false};
+   bool _blinking{false};
+   unsigned long _blnkOnRate{500};
+   unsigned long _blnkOffRate{500};
+
+public:
+   std::atomic<uint32_t> prntsQty{0};
+   std::atomic<uint32_t> clrsQty{0};
+   std::atomic<uint32_t> prntDlyUs{0};
+   std::atomic<bool> failPrnt{false};
+
+   SevenSegDisplays(const uint8_t &dgtsQty = 4)
+   :_dgtsQty{dgtsQty}
+   {
+   }
+   bool begin(){return true;}
+   int32_t getDspValMax() const{
+      int32_t result{1};
+
+      for(uint8_t dgt{0}; dgt < _dgtsQty; dgt++)
+         result *= 10;
+
+      return result - 1;
+   }
+   int32_t getDspValMin() const{
+
+      return (_dgtsQty > 1)?(-(getDspValMax() / 10)):(0);
+   }
+   bool print(const int32_t &val, bool rgthAlgn = false, bool zeroPad = false){
+      bool result{false};
+
+      if(prntDlyUs.load() > 0)
+         std::this_thread::sleep_for(std::chrono::microseconds(prntDlyUs.load()));
+      if(!failPrnt.load() && (val >= getDspValMin()) && (val <= getDspValMax())){
+         std::lock_guard<std::mutex> lck(_mtx);
+         _lastVal = val;
+         _lastRgthAlgn = rgthAlgn;
+         _lastZeroPad = zeroPad;
+         _lastWasVal = true;
+         _lastTxt = std::to_string(val);
+         prntsQty.fetch_add(1);
+         result = true;
+      }
+
+      return result;
+   }
+   bool print(const String &txt){
+      bool result{false};
+
+      if(prntDlyUs.load() > 0)
+         std::this_thread::sleep_for(std::chrono::microseconds(prntDlyUs.load()));
+      if(!failPrnt.load()){
+         std::lock_guard<std::mutex> lck(_mtx);
+         _lastTxt = txt.c_str();
+         _lastWasVal = false;
+         prntsQty.fetch_add(1);
+         result = true;
+      }
+
+      return result;
+   }
+   void clear(){
+      std::lock_guard<std::mutex> lck(_mtx);
+
+      _lastTxt.clear();
+      clrsQty.fetch_add(1);
+
+      return;
+   }
+   bool blink(){_blinking = true; return true;}
+   bool blink(const unsigned long &onRate, const unsigned long &offRate = 0){
+      bool result{setBlinkRate(onRate, offRate)};
+
+      if(result)
+         _blinking = true;
+
+      return result;
+   }
+   bool noBlink(){_blinking = false; return true;}
+   bool setBlinkRate(const unsigned long &onRate, const unsigned long &offRate = 0){
+      bool result{false};
+      unsigned long offVal{(offRate == 0)?(onRate):(offRate)};
+
+      if((onRate >= getMinBlinkRate()) && (onRate <= getMaxBlinkRate()) && (offVal >= getMinBlinkRate()) && (offVal <= getMaxBlinkRate())){
+         _blnkOnRate = onRate;
+         _blnkOffRate = offVal;
+         result = true;
+      }
+
+      return result;
+   }
+   unsigned long getMaxBlinkRate(){return 2000;}
+   unsigned long getMinBlinkRate(){return 100;}
+   bool isBlinking() const{return _blinking;}
+   std::string lastTxt() const{std::lock_guard<std::mutex> lck(_mtx); return _lastTxt;}
+   int32_t lastVal() const{std::lock_guard<std::mutex> lck(_mtx); return _lastVal;}
+   bool lastWasVal() const{std::lock_guard<std::mutex> lck(_mtx); return _lastWasVal;}
+   bool lastRgthAlgn() const{std::lock_guard<std::mutex> lck(_mtx); return _lastRgthAlgn;}
+   bool lastZeroPad() const{std::lock_guard<std::mutex> lck(_mtx); return _lastZeroPad;}
+};
+
+#endif   // _CCSHIM_SEVENSEGDISPLAYS_H_
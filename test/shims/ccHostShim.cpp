@@ -0,0 +1,903 @@
+/**
+ ******************************************************************************
+ * @file ccHostShim.cpp
+ *
+ * @brief Code file of the host stand-in of the FreeRTOS, ESP-IDF and Arduino services, see ccHostShim.h
+ *
+ * @details The tasks, queues and event groups objects are never freed: once deleted they are kept flagged as dead, so a later use of their handle is reported instead of corrupting the memory.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#include <stdlib.h>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+#include <ccHostShim.h>
+
+namespace{
+   std::atomic<int64_t> gTmOffsUs{0};
+   std::atomic<uint32_t> gJtrMaxUs{0};
+   std::atomic<uint32_t> gJtrPermille{0};
+   std::atomic<uint32_t> gTskCrtFailQty{0};
+   std::atomic<uint32_t> gTsksAlive{0};
+   thread_local bool tInIsr{false};
+   thread_local uint32_t tCritNstng{0};
+   thread_local ShimTask* tCurTsk{nullptr};
+
+   struct ShimTaskExit{};
+
+   std::chrono::steady_clock::time_point shimT0(){
+      static const std::chrono::steady_clock::time_point t0{std::chrono::steady_clock::now()};
+
+      return t0;
+   }
+
+   std::minstd_rand& shimRng(){
+      static thread_local std::minstd_rand rng{static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()))};
+
+      return rng;
+   }
+
+   void shimJitter(){
+      uint32_t maxUs{gJtrMaxUs.load(std::memory_order_relaxed)};
+
+      if((maxUs > 0) && ((shimRng()() % 1000) < gJtrPermille.load(std::memory_order_relaxed)))
+         std::this_thread::sleep_for(std::chrono::microseconds(shimRng()() % maxUs));
+
+      return;
+   }
+
+   void shimChkCrit(const char* svcPtr){
+      char msg[128];
+
+      if(tCritNstng > 0){
+         snprintf(msg, sizeof(msg), "%s invoked inside a critical section", svcPtr);
+         shimFault(msg);
+      }
+
+      return;
+   }
+
+   void shimChkBlck(const char* svcPtr){
+      char msg[128];
+
+      if(tInIsr){
+         snprintf(msg, sizeof(msg), "%s invoked from an ISR", svcPtr);
+         shimFault(msg);
+      }
+      shimChkCrit(svcPtr);
+
+      return;
+   }
+
+   template <typename T>
+   void shimChkAlive(T* objPtr, const char* svcPtr){
+      char msg[128];
+
+      if(objPtr == nullptr){
+         snprintf(msg, sizeof(msg), "%s invoked with a null handle", svcPtr);
+         shimFault(msg);
+      }
+      if(objPtr->dead.load()){
+         snprintf(msg, sizeof(msg), "%s invoked with the handle of a deleted object", svcPtr);
+         shimFault(msg);
+      }
+
+      return;
+   }
+
+   // Waits on a condition variable for a FreeRTOS ticks quantity, returns the predicate value
+   template <typename P>
+   bool shimWait(std::condition_variable &cv, std::unique_lock<std::mutex> &lck, const TickType_t &tcks, P pred){
+      bool result{false};
+
+      if(tcks == portMAX_DELAY){
+         cv.wait(lck, pred);
+         result = true;
+      }
+      else
+         result = cv.wait_for(lck, std::chrono::milliseconds(tcks), pred);
+
+      return result;
+   }
+}
+
+struct ShimSem{
+   std::timed_mutex mtx;
+   std::atomic<std::thread::id> ownr{};
+   std::atomic<bool> dead{false};
+   bool isStatic{false};
+};
+static_assert(sizeof(ShimSem) <= sizeof(StaticSemaphore_t), "StaticSemaphore_t too small for the shim mutex");
+
+struct ShimTask{
+   std::mutex mtx;
+   std::condition_variable cv;
+   uint32_t ntfVal{0};
+   bool ntfPndng{false};
+   bool wtng{false};
+   std::atomic<bool> dead{false};
+   std::string name;
+};
+
+struct ShimQueue{
+   std::mutex mtx;
+   std::condition_variable cv;
+   std::vector<uint8_t> strg;
+   UBaseType_t len{0};
+   UBaseType_t itemSz{0};
+   UBaseType_t head{0};
+   UBaseType_t qty{0};
+   uint32_t rcvWtrs{0};
+   uint32_t sndWtrs{0};
+   std::atomic<bool> dead{false};
+};
+
+struct ShimEvWtr{
+   EventBits_t bits;
+   bool waitAll;
+   bool clrOnExit;
+   bool rlsd;
+   EventBits_t rsltBits;
+};
+
+struct ShimEvGrp{
+   std::mutex mtx;
+   std::condition_variable cv;
+   EventBits_t bits{0};
+   std::list<ShimEvWtr*> wtrs;
+   std::atomic<bool> dead{false};
+};
+
+//=================================================>> Shim controls BEGIN
+void shimFault(const char* msgPtr){
+   fprintf(stderr, "\n*** Host shim fault: %s\n", msgPtr);
+   fflush(stderr);
+   abort();
+}
+
+void shimSetJitter(const uint32_t &maxUs, const uint32_t &permille){
+   gJtrPermille.store(permille);
+   gJtrMaxUs.store(maxUs);
+
+   return;
+}
+
+void shimAdvanceTime(const int64_t &us){
+   gTmOffsUs.fetch_add(us);
+
+   return;
+}
+
+void shimFailTaskCreate(const uint32_t &qty){
+   gTskCrtFailQty.store(qty);
+
+   return;
+}
+
+uint32_t shimTasksAlive(){
+
+   return gTsksAlive.load();
+}
+
+ShimIsrScope::ShimIsrScope(){
+   if(tInIsr)
+      shimFault("nested ShimIsrScope");
+   tInIsr = true;
+}
+
+ShimIsrScope::~ShimIsrScope(){
+   tInIsr = false;
+}
+//===================================================>> Shim controls END
+
+//===========================================>> Critical sections BEGIN
+void vPortEnterCritical(portMUX_TYPE* muxPtr){
+   if(muxPtr == nullptr)
+      shimFault("portENTER_CRITICAL invoked with a null spinlock");
+   muxPtr->mtx.lock();
+   tCritNstng++;
+
+   return;
+}
+
+void vPortExitCritical(portMUX_TYPE* muxPtr){
+   if((muxPtr == nullptr) || (tCritNstng == 0))
+      shimFault("portEXIT_CRITICAL invoked with no critical section entered");
+   tCritNstng--;
+   muxPtr->mtx.unlock();
+
+   return;
+}
+
+BaseType_t xPortInIsrContext(){
+
+   return tInIsr?pdTRUE:pdFALSE;
+}
+
+BaseType_t xPortGetCoreID(){
+
+   return static_cast<BaseType_t>(std::hash<std::thread::id>()(std::this_thread::get_id()) % portNUM_PROCESSORS);
+}
+//=============================================>> Critical sections END
+
+//=====================================================>> Semaphores BEGIN
+SemaphoreHandle_t xSemaphoreCreateMutex(){
+   shimChkBlck("xSemaphoreCreateMutex");
+
+   return new(std::nothrow) ShimSem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* bufPtr){
+   ShimSem* result{nullptr};
+
+   shimChkBlck("xSemaphoreCreateMutexStatic");
+   if(bufPtr != nullptr){
+      result = new(bufPtr->strg) ShimSem;
+      result->isStatic = true;
+   }
+
+   return result;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem){
+   shimChkBlck("vSemaphoreDelete");
+   shimChkAlive(sem, "vSemaphoreDelete");
+   if(!sem->mtx.try_lock())
+      shimFault("vSemaphoreDelete invoked on a taken mutex");
+   sem->mtx.unlock();
+   sem->dead.store(true);
+   if(sem->isStatic)
+      sem->~ShimSem();
+
+   return;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t tcksToWait){
+   BaseType_t result{pdFALSE};
+
+   shimChkBlck("xSemaphoreTake");
+   shimJitter();
+   shimChkAlive(sem, "xSemaphoreTake");
+   if(sem->ownr.load() == std::this_thread::get_id())
+      shimFault("xSemaphoreTake invoked by the task already holding the mutex");
+   if(tcksToWait == portMAX_DELAY){
+      sem->mtx.lock();
+      result = pdTRUE;
+   }
+   else if(sem->mtx.try_lock_for(std::chrono::milliseconds(tcksToWait)))
+      result = pdTRUE;
+   if(result == pdTRUE)
+      sem->ownr.store(std::this_thread::get_id());
+
+   return result;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem){
+   shimChkBlck("xSemaphoreGive");
+   shimChkAlive(sem, "xSemaphoreGive");
+   if(sem->ownr.load() != std::this_thread::get_id())
+      shimFault("xSemaphoreGive invoked by a task not holding the mutex");
+   sem->ownr.store(std::thread::id{});
+   sem->mtx.unlock();
+
+   return pdTRUE;
+}
+//=======================================================>> Semaphores END
+
+//==========================================================>> Tasks BEGIN
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t tskFn, const char* namePtr, const uint32_t stckDepth, void* prmPtr, UBaseType_t prrty, TaskHandle_t* hndlPtr, const BaseType_t coreId){
+   BaseType_t result{pdFAIL};
+   uint32_t failQty{gTskCrtFailQty.load()};
+   ShimTask* tskPtr{nullptr};
+
+   (void)stckDepth;
+   (void)prrty;
+   (void)coreId;
+   shimChkBlck("xTaskCreate");
+   while((failQty > 0) && !gTskCrtFailQty.compare_exchange_weak(failQty, failQty - 1)){
+   }
+   if(failQty == 0){
+      tskPtr = new ShimTask;
+      tskPtr->name = (namePtr != nullptr)?(namePtr):("");
+      if(hndlPtr != nullptr)
+         *hndlPtr = tskPtr;   // Set before the task runs, as FreeRTOS does
+      gTsksAlive.fetch_add(1);
+      std::thread([tskFn, prmPtr, tskPtr](){
+         tCurTsk = tskPtr;
+         try{
+            tskFn(prmPtr);
+            shimFault("task function returned without invoking vTaskDelete(NULL)");
+         }
+         catch(const ShimTaskExit &){
+         }
+      }).detach();
+      result = pdPASS;
+   }
+
+   return result;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t tskFn, const char* namePtr, const uint32_t stckDepth, void* prmPtr, UBaseType_t prrty, TaskHandle_t* hndlPtr){
+
+   return xTaskCreatePinnedToCore(tskFn, namePtr, stckDepth, prmPtr, prrty, hndlPtr, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t tsk){
+   shimChkBlck("vTaskDelete");
+   if((tsk != nullptr) && (tsk != tCurTsk))
+      shimFault("vTaskDelete of other tasks is not supported by the host shim");
+   if(tCurTsk == nullptr)
+      shimFault("vTaskDelete(NULL) invoked from a thread that is not a task");
+   tCurTsk->dead.store(true);
+   gTsksAlive.fetch_sub(1);
+   throw ShimTaskExit{};
+}
+
+void vTaskDelay(const TickType_t tcks){
+   shimChkBlck("vTaskDelay");
+   if(tcks == 0)
+      std::this_thread::yield();
+   else
+      std::this_thread::sleep_for(std::chrono::milliseconds(tcks));
+
+   return;
+}
+
+TickType_t xTaskGetTickCount(){
+
+   return static_cast<TickType_t>(esp_timer_get_time() / 1000);
+}
+
+TickType_t xTaskGetTickCountFromISR(){
+
+   return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(){
+   if(tCurTsk == nullptr)
+      tCurTsk = new ShimTask;   // Threads not created by xTaskCreate(), as the tests main thread, get a handle when first needed
+
+   return tCurTsk;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t tsk){
+   shimChkBlck("xTaskNotifyGive");
+   shimJitter();
+   shimChkAlive(tsk, "xTaskNotifyGive");
+   {
+      std::lock_guard<std::mutex> lck(tsk->mtx);
+      tsk->ntfVal++;
+      tsk->ntfPndng = true;
+   }
+   tsk->cv.notify_all();
+
+   return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t tsk, BaseType_t* wokenPtr){
+   bool wtng{false};
+
+   shimChkCrit("vTaskNotifyGiveFromISR");
+   shimJitter();
+   shimChkAlive(tsk, "vTaskNotifyGiveFromISR");
+   {
+      std::lock_guard<std::mutex> lck(tsk->mtx);
+      tsk->ntfVal++;
+      tsk->ntfPndng = true;
+      wtng = tsk->wtng;
+   }
+   tsk->cv.notify_all();
+   if(wtng && (wokenPtr != nullptr))
+      *wokenPtr = pdTRUE;
+
+   return;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clrOnExit, TickType_t tcksToWait){
+   uint32_t result{0};
+   ShimTask* tskPtr{xTaskGetCurrentTaskHandle()};
+
+   shimChkBlck("ulTaskNotifyTake");
+   std::unique_lock<std::mutex> lck(tskPtr->mtx);
+   tskPtr->wtng = true;
+   shimWait(tskPtr->cv, lck, tcksToWait, [tskPtr](){return tskPtr->ntfVal != 0;});
+   tskPtr->wtng = false;
+   result = tskPtr->ntfVal;
+   if(result != 0)
+      tskPtr->ntfVal = (clrOnExit == pdFALSE)?(result - 1):(0);
+   tskPtr->ntfPndng = false;
+
+   return result;
+}
+
+static BaseType_t shimTaskNotify(TaskHandle_t tsk, uint32_t val, eNotifyAction actn, BaseType_t* wokenPtr){
+   BaseType_t result{pdPASS};
+   bool wtng{false};
+
+   {
+      std::lock_guard<std::mutex> lck(tsk->mtx);
+      switch(actn){
+         case eSetBits:
+            tsk->ntfVal |= val;
+            break;
+         case eIncrement:
+            tsk->ntfVal++;
+            break;
+         case eSetValueWithOverwrite:
+            tsk->ntfVal = val;
+            break;
+         case eSetValueWithoutOverwrite:
+            if(tsk->ntfPndng)
+               result = pdFAIL;
+            else
+               tsk->ntfVal = val;
+            break;
+         default:
+            break;
+      }
+      tsk->ntfPndng = true;
+      wtng = tsk->wtng;
+   }
+   tsk->cv.notify_all();
+   if(wtng && (wokenPtr != nullptr))
+      *wokenPtr = pdTRUE;
+
+   return result;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t tsk, uint32_t val, eNotifyAction actn){
+   shimChkBlck("xTaskNotify");
+   shimJitter();
+   shimChkAlive(tsk, "xTaskNotify");
+
+   return shimTaskNotify(tsk, val, actn, nullptr);
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t tsk, uint32_t val, eNotifyAction actn, BaseType_t* wokenPtr){
+   shimChkCrit("xTaskNotifyFromISR");
+   shimJitter();
+   shimChkAlive(tsk, "xTaskNotifyFromISR");
+
+   return shimTaskNotify(tsk, val, actn, wokenPtr);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clrOnEntry, uint32_t clrOnExit, uint32_t* valPtr, TickType_t tcksToWait){
+   BaseType_t result{pdFALSE};
+   ShimTask* tskPtr{xTaskGetCurrentTaskHandle()};
+
+   shimChkBlck("xTaskNotifyWait");
+   std::unique_lock<std::mutex> lck(tskPtr->mtx);
+   if(!tskPtr->ntfPndng)
+      tskPtr->ntfVal &= ~clrOnEntry;
+   tskPtr->wtng = true;
+   shimWait(tskPtr->cv, lck, tcksToWait, [tskPtr](){return tskPtr->ntfPndng;});
+   tskPtr->wtng = false;
+   if(valPtr != nullptr)
+      *valPtr = tskPtr->ntfVal;
+   if(tskPtr->ntfPndng){
+      tskPtr->ntfVal &= ~clrOnExit;
+      tskPtr->ntfPndng = false;
+      result = pdTRUE;
+   }
+
+   return result;
+}
+//============================================================>> Tasks END
+
+//=========================================================>> Queues BEGIN
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t itemSz){
+   ShimQueue* result{nullptr};
+
+   shimChkBlck("xQueueCreate");
+   if((len > 0) && (itemSz > 0)){
+      result = new ShimQueue;
+      result->len = len;
+      result->itemSz = itemSz;
+      result->strg.resize(static_cast<size_t>(len) * itemSz);
+   }
+
+   return result;
+}
+
+void vQueueDelete(QueueHandle_t queue){
+   shimChkBlck("vQueueDelete");
+   shimChkAlive(queue, "vQueueDelete");
+   {
+      std::lock_guard<std::mutex> lck(queue->mtx);
+      if((queue->rcvWtrs != 0) || (queue->sndWtrs != 0))
+         shimFault("vQueueDelete invoked while tasks are blocked on the queue");
+      queue->dead.store(true);
+   }
+
+   return;
+}
+
+static void shimQueuePut(QueueHandle_t queue, const void* itemPtr){
+   memcpy(&queue->strg[((queue->head + queue->qty) % queue->len) * queue->itemSz], itemPtr, queue->itemSz);
+   queue->qty++;
+
+   return;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* itemPtr, TickType_t tcksToWait){
+   BaseType_t result{pdFALSE};
+
+   shimChkBlck("xQueueSend");
+   shimJitter();
+   shimChkAlive(queue, "xQueueSend");
+   {
+      std::unique_lock<std::mutex> lck(queue->mtx);
+      queue->sndWtrs++;
+      shimWait(queue->cv, lck, tcksToWait, [queue](){return (queue->qty < queue->len) || queue->dead.load();});
+      queue->sndWtrs--;
+      if(queue->dead.load())
+         shimFault("queue deleted while a task was blocked sending to it");
+      if(queue->qty < queue->len){
+         shimQueuePut(queue, itemPtr);
+         result = pdTRUE;
+      }
+   }
+   queue->cv.notify_all();
+
+   return result;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* itemPtr, BaseType_t* wokenPtr){
+   BaseType_t result{pdFALSE};
+   bool wtng{false};
+
+   shimChkCrit("xQueueSendFromISR");
+   shimJitter();
+   shimChkAlive(queue, "xQueueSendFromISR");
+   {
+      std::lock_guard<std::mutex> lck(queue->mtx);
+      if(queue->qty < queue->len){
+         shimQueuePut(queue, itemPtr);
+         wtng = (queue->rcvWtrs > 0);
+         result = pdTRUE;
+      }
+   }
+   queue->cv.notify_all();
+   if(wtng && (wokenPtr != nullptr))
+      *wokenPtr = pdTRUE;
+
+   return result;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* bufPtr, TickType_t tcksToWait){
+   BaseType_t result{pdFALSE};
+
+   shimChkBlck("xQueueReceive");
+   shimChkAlive(queue, "xQueueReceive");
+   {
+      std::unique_lock<std::mutex> lck(queue->mtx);
+      queue->rcvWtrs++;
+      shimWait(queue->cv, lck, tcksToWait, [queue](){return (queue->qty > 0) || queue->dead.load();});
+      queue->rcvWtrs--;
+      if(queue->dead.load())
+         shimFault("queue deleted while a task was blocked receiving from it");
+      if(queue->qty > 0){
+         memcpy(bufPtr, &queue->strg[queue->head * queue->itemSz], queue->itemSz);
+         queue->head = (queue->head + 1) % queue->len;
+         queue->qty--;
+         result = pdTRUE;
+      }
+   }
+   queue->cv.notify_all();
+
+   return result;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue){
+   UBaseType_t result{0};
+
+   shimChkAlive(queue, "uxQueueMessagesWaiting");
+   {
+      std::lock_guard<std::mutex> lck(queue->mtx);
+      result = queue->qty;
+   }
+
+   return result;
+}
+//===========================================================>> Queues END
+
+//===================================================>> Event groups BEGIN
+EventGroupHandle_t xEventGroupCreate(){
+   shimChkBlck("xEventGroupCreate");
+
+   return new ShimEvGrp;
+}
+
+void vEventGroupDelete(EventGroupHandle_t evGrp){
+   shimChkBlck("vEventGroupDelete");
+   shimChkAlive(evGrp, "vEventGroupDelete");
+   {
+      std::lock_guard<std::mutex> lck(evGrp->mtx);
+      if(!evGrp->wtrs.empty())
+         shimFault("vEventGroupDelete invoked while tasks are blocked on the event group");
+      evGrp->dead.store(true);
+   }
+
+   return;
+}
+
+// Releases every waiter whose condition is met by the bits set, and clears the bits of the waiters that requested it, as xEventGroupSetBits() does
+static bool shimEvSet(EventGroupHandle_t evGrp, const EventBits_t bits){
+   bool result{false};
+   EventBits_t clrBits{0};
+
+   {
+      std::lock_guard<std::mutex> lck(evGrp->mtx);
+      evGrp->bits |= bits;
+      for(ShimEvWtr* wtrPtr : evGrp->wtrs){
+         if(!wtrPtr->rlsd && (wtrPtr->waitAll?((evGrp->bits & wtrPtr->bits) == wtrPtr->bits):((evGrp->bits & wtrPtr->bits) != 0))){
+            wtrPtr->rlsd = true;
+            wtrPtr->rsltBits = evGrp->bits;
+            if(wtrPtr->clrOnExit)
+               clrBits |= wtrPtr->bits;
+            result = true;
+         }
+      }
+      evGrp->bits &= ~clrBits;
+   }
+   evGrp->cv.notify_all();
+
+   return result;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t evGrp, const EventBits_t bits){
+   shimChkBlck("xEventGroupSetBits");
+   shimJitter();
+   shimChkAlive(evGrp, "xEventGroupSetBits");
+   shimEvSet(evGrp, bits);
+
+   return xEventGroupGetBits(evGrp);
+}
+
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t evGrp, const EventBits_t bits, BaseType_t* wokenPtr){
+   shimChkCrit("xEventGroupSetBitsFromISR");
+   shimJitter();
+   shimChkAlive(evGrp, "xEventGroupSetBitsFromISR");
+   if(shimEvSet(evGrp, bits) && (wokenPtr != nullptr))
+      *wokenPtr = pdTRUE;
+
+   return pdPASS;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t evGrp, const EventBits_t bits){
+   EventBits_t result{0};
+
+   shimChkCrit("xEventGroupClearBits");
+   shimChkAlive(evGrp, "xEventGroupClearBits");
+   {
+      std::lock_guard<std::mutex> lck(evGrp->mtx);
+      result = evGrp->bits;
+      evGrp->bits &= ~bits;
+   }
+
+   return result;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t evGrp){
+   EventBits_t result{0};
+
+   shimChkAlive(evGrp, "xEventGroupGetBits");
+   {
+      std::lock_guard<std::mutex> lck(evGrp->mtx);
+      result = evGrp->bits;
+   }
+
+   return result;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t evGrp, const EventBits_t bits, const BaseType_t clrOnExit, const BaseType_t waitAll, TickType_t tcksToWait){
+   EventBits_t result{0};
+   ShimEvWtr wtr{bits, waitAll != pdFALSE, clrOnExit != pdFALSE, false, 0};
+
+   shimChkBlck("xEventGroupWaitBits");
+   shimJitter();   // Widens the window between the caller checking its condition and blocking
+   shimChkAlive(evGrp, "xEventGroupWaitBits");
+   std::unique_lock<std::mutex> lck(evGrp->mtx);
+   if(wtr.waitAll?((evGrp->bits & bits) == bits):((evGrp->bits & bits) != 0)){
+      result = evGrp->bits;
+      if(wtr.clrOnExit)
+         evGrp->bits &= ~bits;
+   }
+   else{
+      evGrp->wtrs.push_back(&wtr);
+      shimWait(evGrp->cv, lck, tcksToWait, [&wtr](){return wtr.rlsd;});
+      evGrp->wtrs.remove(&wtr);
+      result = wtr.rlsd?(wtr.rsltBits):(evGrp->bits);
+   }
+
+   return result;
+}
+//=====================================================>> Event groups END
+
+//=====================================================>> Time, GPIO BEGIN
+namespace{
+   const uint8_t shimPinsQty{64};
+   struct ShimPin_t{
+      bool level;
+      void (*isrFn)(void*);
+      void* argPtr;
+      int mode;
+   };
+   std::mutex gPinsMtx;
+   ShimPin_t gPins[shimPinsQty]{};
+}
+
+int64_t esp_timer_get_time(){
+
+   return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - shimT0()).count() + gTmOffsUs.load(std::memory_order_relaxed);
+}
+
+uint32_t esp_random(){
+
+   return static_cast<uint32_t>(shimRng()());
+}
+
+unsigned long millis(){
+
+   return static_cast<unsigned long>(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros(){
+
+   return static_cast<unsigned long>(esp_timer_get_time());
+}
+
+void delay(uint32_t ms){
+   vTaskDelay(pdMS_TO_TICKS(ms));
+
+   return;
+}
+
+void delayMicroseconds(uint32_t us){
+   std::this_thread::sleep_for(std::chrono::microseconds(us));
+
+   return;
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+   (void)pin;
+   (void)mode;
+
+   return;
+}
+
+int digitalRead(uint8_t pin){
+   std::lock_guard<std::mutex> lck(gPinsMtx);
+
+   return ((pin < shimPinsQty) && gPins[pin].level)?HIGH:LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+   shimPinSet(pin, val != LOW);
+
+   return;
+}
+
+int digitalPinToInterrupt(uint8_t pin){
+
+   return pin;
+}
+
+void attachInterruptArg(uint8_t pin, void (*isrFn)(void*), void* argPtr, int mode){
+   std::lock_guard<std::mutex> lck(gPinsMtx);
+
+   if(pin < shimPinsQty){
+      gPins[pin].isrFn = isrFn;
+      gPins[pin].argPtr = argPtr;
+      gPins[pin].mode = mode;
+   }
+
+   return;
+}
+
+void detachInterrupt(uint8_t pin){
+   std::lock_guard<std::mutex> lck(gPinsMtx);
+
+   if(pin < shimPinsQty){
+      gPins[pin].isrFn = nullptr;
+      gPins[pin].argPtr = nullptr;
+   }
+
+   return;
+}
+
+int gpio_get_level(gpio_num_t pin){
+
+   return digitalRead(static_cast<uint8_t>(pin));
+}
+
+void shimPinSet(const uint8_t &pin, const bool &level){
+   bool prevLvl{false};
+   ShimPin_t pinCopy{};
+
+   if(pin < shimPinsQty){
+      {
+         std::lock_guard<std::mutex> lck(gPinsMtx);
+         prevLvl = gPins[pin].level;
+         gPins[pin].level = level;
+         pinCopy = gPins[pin];
+      }
+      if((pinCopy.isrFn != nullptr) && ((pinCopy.mode == CHANGE)?(prevLvl != level):((pinCopy.mode == RISING)?(!prevLvl && level):(prevLvl && !level)))){
+         ShimIsrScope isrScp;
+         pinCopy.isrFn(pinCopy.argPtr);
+      }
+   }
+
+   return;
+}
+//=======================================================>> Time, GPIO END
+
+//=========================================================>> String BEGIN
+String::String(const char* cstrPtr)
+:_str{(cstrPtr != nullptr)?(cstrPtr):("")}
+{
+   _toHeap();
+}
+
+String::String(const std::string &str)
+:_str{str}
+{
+   _toHeap();
+}
+
+String::String(const int32_t &val)
+:_str{std::to_string(val)}
+{
+   _toHeap();
+}
+
+void String::_toHeap(){
+   if(!_str.empty())
+      _str.reserve(sizeof(std::string));   // Past the short texts inner storage: as the Arduino String does, a non empty text is kept in heap memory, so the allocation tests see every String built
+
+   return;
+}
+
+const char* String::c_str() const{
+
+   return _str.c_str();
+}
+
+unsigned int String::length() const{
+
+   return static_cast<unsigned int>(_str.length());
+}
+
+unsigned char String::reserve(unsigned int size){
+   _str.reserve(size);
+
+   return 1;
+}
+
+String& String::operator=(const char* cstrPtr){
+   _str.assign((cstrPtr != nullptr)?(cstrPtr):(""));   // Reuses the storage, as the Arduino String does when the text fits in its capacity
+
+   return *this;
+}
+
+bool String::operator==(const char* cstrPtr) const{
+
+   return (cstrPtr != nullptr) && (_str == cstrPtr);
+}
+//===========================================================>> String END
@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @file ccHostShim.h
+ *
+ * @brief Host stand-in of the FreeRTOS, ESP-IDF and Arduino services used by the ClickCounter_Esp32 library
+ *
+ * @details The shim lets the library be built and tested in a Linux host. FreeRTOS tasks run as threads, mutexes, queues, task notifications and event groups are built over the standard C++ threading services, and the critical sections are recursive mutexes, as the ESP-IDF spinlocks are.
+ * The shim is stricter than the target where it helps to find bugs: using a deleted task, queue or event group, calling a blocking service from an ISR or inside a critical section, or giving a mutex not owned by the caller, are reported by shimFault() and abort the test.
+ * The code run as an ISR is marked by a ShimIsrScope object, so the xPortInIsrContext() paths are exercised.
+ *
+ * Repository: https://github.com/GabyGold67/ClickCounter_ESP32
+ *
+ * Framework: None
+ * Platform: Linux, or any C++17 host
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @date First release: 17/10/2026
+ *       Last update:   17/10/2026 12:00 GMT+0200 DST
+ *******************************************************************************
+ */
+#ifndef _CCHOSTSHIM_H_
+#define _CCHOSTSHIM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <cstddef>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+//======================================>> Basic types and constants BEGIN
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t EventBits_t;
+typedef uint8_t StackType_t;
+typedef int esp_err_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(xTimeInMs) (static_cast<TickType_t>(xTimeInMs))
+#define portNUM_PROCESSORS 2
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portYIELD_FROM_ISR(...) ((void)0)
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+//========================================>> Basic types and constants END
+
+//=================================================>> Shim controls BEGIN
+/**
+ * @brief Reports a misuse of the shimmed services and aborts the program.
+ */
+[[noreturn]] void shimFault(const char* msgPtr);
+/**
+ * @brief Makes the shimmed services sleep a random time before acting, to widen the race windows of the code under test.
+ *
+ * @param maxUs Longest sleep, in microseconds. A value of 0 disables the jitter.
+ * @param permille Probability of sleeping in each service call, in thousandths.
+ */
+void shimSetJitter(const uint32_t &maxUs, const uint32_t &permille = 100);
+/**
+ * @brief Advances the ticks and the esp_timer clocks, without waiting.
+ */
+void shimAdvanceTime(const int64_t &us);
+/**
+ * @brief Makes the next task creations fail.
+ */
+void shimFailTaskCreate(const uint32_t &qty = 1);
+/**
+ * @brief Quantity of tasks alive, created by xTaskCreate() and not deleted yet.
+ */
+uint32_t shimTasksAlive();
+
+/**
+ * @brief Marks the code run in its scope as executed from an ISR.
+ */
+class ShimIsrScope{
+public:
+   ShimIsrScope();
+   ~ShimIsrScope();
+   ShimIsrScope(const ShimIsrScope&) = delete;
+   ShimIsrScope& operator=(const ShimIsrScope&) = delete;
+};
+//===================================================>> Shim controls END
+
+//===========================================>> Critical sections BEGIN
+struct portMUX_TYPE{
+   std::recursive_mutex mtx;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portMUX_INITIALIZE(mux) ((void)(mux))
+
+void vPortEnterCritical(portMUX_TYPE* muxPtr);
+void vPortExitCritical(portMUX_TYPE* muxPtr);
+BaseType_t xPortInIsrContext();
+BaseType_t xPortGetCoreID();
+
+#define portENTER_CRITICAL(mux) vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux) vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux) vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux) vPortExitCritical(mux)
+#define portENTER_CRITICAL_SAFE(mux) vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_SAFE(mux) vPortExitCritical(mux)
+//=============================================>> Critical sections END
+
+//=====================================================>> Semaphores BEGIN
+struct ShimSem;
+typedef ShimSem* SemaphoreHandle_t;
+struct StaticSemaphore_t{
+   alignas(std::max_align_t) unsigned char strg[128];
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* bufPtr);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t tcksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+//=======================================================>> Semaphores END
+
+//==========================================================>> Tasks BEGIN
+struct ShimTask;
+typedef ShimTask* TaskHandle_t;
+enum eNotifyAction{
+   eNoAction,
+   eSetBits,
+   eIncrement,
+   eSetValueWithOverwrite,
+   eSetValueWithoutOverwrite
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t tskFn, const char* namePtr, const uint32_t stckDepth, void* prmPtr, UBaseType_t prrty, TaskHandle_t* hndlPtr, const BaseType_t coreId);
+BaseType_t xTaskCreate(TaskFunction_t tskFn, const char* namePtr, const uint32_t stckDepth, void* prmPtr, UBaseType_t prrty, TaskHandle_t* hndlPtr);
+void vTaskDelete(TaskHandle_t tsk);
+void vTaskDelay(const TickType_t tcks);
+TickType_t xTaskGetTickCount();
+TickType_t xTaskGetTickCountFromISR();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xTaskNotifyGive(TaskHandle_t tsk);
+void vTaskNotifyGiveFromISR(TaskHandle_t tsk, BaseType_t* wokenPtr);
+uint32_t ulTaskNotifyTake(BaseType_t clrOnExit, TickType_t tcksToWait);
+BaseType_t xTaskNotify(TaskHandle_t tsk, uint32_t val, eNotifyAction actn);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t tsk, uint32_t val, eNotifyAction actn, BaseType_t* wokenPtr);
+BaseType_t xTaskNotifyWait(uint32_t clrOnEntry, uint32_t clrOnExit, uint32_t* valPtr, TickType_t tcksToWait);
+//============================================================>> Tasks END
+
+//=========================================================>> Queues BEGIN
+struct ShimQueue;
+typedef ShimQueue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t itemSz);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* itemPtr, TickType_t tcksToWait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* itemPtr, BaseType_t* wokenPtr);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* bufPtr, TickType_t tcksToWait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+//===========================================================>> Queues END
+
+//===================================================>> Event groups BEGIN
+struct ShimEvGrp;
+typedef ShimEvGrp* EventGroupHandle_t;
+
+EventGroupHandle_t xEventGroupCreate();
+void vEventGroupDelete(EventGroupHandle_t evGrp);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t evGrp, const EventBits_t bits);
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t evGrp, const EventBits_t bits, BaseType_t* wokenPtr);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t evGrp, const EventBits_t bits);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t evGrp);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t evGrp, const EventBits_t bits, const BaseType_t clrOnExit, const BaseType_t waitAll, TickType_t tcksToWait);
+//=====================================================>> Event groups END
+
+//=====================================================>> Time, GPIO BEGIN
+int64_t esp_timer_get_time();
+uint32_t esp_random();
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+typedef int gpio_num_t;
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalPinToInterrupt(uint8_t pin);
+void attachInterruptArg(uint8_t pin, void (*isrFn)(void*), void* argPtr, int mode);
+void detachInterrupt(uint8_t pin);
+int gpio_get_level(gpio_num_t pin);
+/**
+ * @brief Sets a pin input level, running its attached interrupt as an ISR if the change matches the interrupt mode.
+ */
+void shimPinSet(const uint8_t &pin, const bool &level);
+//=======================================================>> Time, GPIO END
+
+//=========================================================>> String BEGIN
+/**
+ * @brief Minimal Arduino String stand-in
+ */
+class String{
+private:
+   std::string _str;
+   void _toHeap();
+
+public:
+   String(const char* cstrPtr = "");
+   String(const std::string &str);
+   String(const int32_t &val);
+   const char* c_str() const;
+   unsigned int length() const;
+   unsigned char reserve(unsigned int size);
+   String& operator=(const char* cstrPtr);
+   bool operator==(const char* cstrPtr) const;
+};
+//===========================================================>> String END
+
+#endif   // _CCHOSTSHIM_H_
@@ -0,0 +1,11 @@
+/**
+ * @file driver/gpio.h
+ *
+ * @brief Host build stand-in of the ESP-IDF GPIO driver header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_GPIO_H_
+#define _CCSHIM_GPIO_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_GPIO_H_
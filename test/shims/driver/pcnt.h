@@ -0,0 +1,79 @@
+/**
+ * @file driver/pcnt.h
+ *
+ * @brief Host build stand-in of the ESP-IDF legacy Pulse Counter driver
+ *
+ * @details Each unit keeps a counter set by the tests with shimPcntSet(), restarting from 0 when it reaches its configured upper limit, as the PCNT peripheral does.
+ */
+#ifndef _CCSHIM_PCNT_H_
+#define _CCSHIM_PCNT_H_
+
+#include <ccHostShim.h>
+
+typedef enum{PCNT_UNIT_0, PCNT_UNIT_1, PCNT_UNIT_2, PCNT_UNIT_3, PCNT_UNIT_MAX} pcnt_unit_t;
+typedef enum{PCNT_CHANNEL_0, PCNT_CHANNEL_1} pcnt_channel_t;
+typedef enum{PCNT_MODE_KEEP, PCNT_MODE_REVERSE, PCNT_MODE_DISABLE} pcnt_ctrl_mode_t;
+typedef enum{PCNT_COUNT_DIS, PCNT_COUNT_INC, PCNT_COUNT_DEC} pcnt_count_mode_t;
+#define PCNT_PIN_NOT_USED (-1)
+
+typedef struct{
+   int pulse_gpio_num;
+   int ctrl_gpio_num;
+   pcnt_ctrl_mode_t lctrl_mode;
+   pcnt_ctrl_mode_t hctrl_mode;
+   pcnt_count_mode_t pos_mode;
+   pcnt_count_mode_t neg_mode;
+   int16_t counter_h_lim;
+   int16_t counter_l_lim;
+   pcnt_unit_t unit;
+   pcnt_channel_t channel;
+} pcnt_config_t;
+
+struct ShimPcnt_t{
+   bool cnfgd;
+   bool running;
+   int16_t hLim;
+   int16_t val;
+};
+inline ShimPcnt_t shimPcntUnits[PCNT_UNIT_MAX]{};
+
+inline esp_err_t pcnt_unit_config(const pcnt_config_t* cnfgPtr){
+   esp_err_t result{ESP_FAIL};
+
+   if((cnfgPtr != nullptr) && (cnfgPtr->unit < PCNT_UNIT_MAX) && (cnfgPtr->counter_h_lim > 0)){
+      shimPcntUnits[cnfgPtr->unit] = {true, true, cnfgPtr->counter_h_lim, 0};
+      result = ESP_OK;
+   }
+
+   return result;
+}
+inline esp_err_t pcnt_set_filter_value(pcnt_unit_t unit, uint16_t val){(void)val; return (unit < PCNT_UNIT_MAX)?ESP_OK:ESP_FAIL;}
+inline esp_err_t pcnt_filter_enable(pcnt_unit_t unit){return (unit < PCNT_UNIT_MAX)?ESP_OK:ESP_FAIL;}
+inline esp_err_t pcnt_filter_disable(pcnt_unit_t unit){return (unit < PCNT_UNIT_MAX)?ESP_OK:ESP_FAIL;}
+inline esp_err_t pcnt_counter_pause(pcnt_unit_t unit){shimPcntUnits[unit].running = false; return ESP_OK;}
+inline esp_err_t pcnt_counter_resume(pcnt_unit_t unit){shimPcntUnits[unit].running = true; return ESP_OK;}
+inline esp_err_t pcnt_counter_clear(pcnt_unit_t unit){shimPcntUnits[unit].val = 0; return ESP_OK;}
+inline esp_err_t pcnt_get_counter_value(pcnt_unit_t unit, int16_t* valPtr){
+   esp_err_t result{ESP_FAIL};
+
+   if((unit < PCNT_UNIT_MAX) && shimPcntUnits[unit].cnfgd && (valPtr != nullptr)){
+      *valPtr = shimPcntUnits[unit].val;
+      result = ESP_OK;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Counts pulses in a running unit, restarting from 0 at the upper limit.
+ */
+inline void shimPcntPulses(const pcnt_unit_t &unit, uint32_t qty){
+   ShimPcnt_t &pcnt{shimPcntUnits[unit]};
+
+   if(pcnt.cnfgd && pcnt.running)
+      pcnt.val = static_cast<int16_t>((pcnt.val + qty) % static_cast<uint32_t>(pcnt.hLim));
+
+   return;
+}
+
+#endif   // _CCSHIM_PCNT_H_
@@ -0,0 +1,11 @@
+/**
+ * @file esp_attr.h
+ *
+ * @brief Host build stand-in of the ESP-IDF attributes header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_ESP_ATTR_H_
+#define _CCSHIM_ESP_ATTR_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_ESP_ATTR_H_
@@ -0,0 +1,125 @@
+/**
+ * @file esp_partition.h
+ *
+ * @brief Host build stand-in of the ESP-IDF partitions API
+ *
+ * @details The partitions are kept in memory and registered by the tests with shimPartitionAdd(). They behave as NOR flash: an erase sets the bytes to 0xFF, and a write can only clear bits, as the ESP32 flash does.
+ */
+#ifndef _CCSHIM_ESP_PARTITION_H_
+#define _CCSHIM_ESP_PARTITION_H_
+
+#include <ccHostShim.h>
+#include <list>
+#include <vector>
+
+#define SPI_FLASH_SEC_SIZE 4096
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+typedef enum{ESP_PARTITION_TYPE_APP = 0x00, ESP_PARTITION_TYPE_DATA = 0x01} esp_partition_type_t;
+typedef enum{ESP_PARTITION_SUBTYPE_ANY = 0xff} esp_partition_subtype_t;
+
+typedef struct{
+   esp_partition_type_t type;
+   esp_partition_subtype_t subtype;
+   uint32_t address;
+   uint32_t size;
+   char label[17];
+   bool encrypted;
+} esp_partition_t;
+
+struct ShimPrttn_t{
+   esp_partition_t prttn;
+   std::vector<uint8_t> flash;
+   uint32_t wrtQty;
+   uint32_t erseQty;
+};
+inline std::list<ShimPrttn_t> shimPrttns;
+
+/**
+ * @brief Registers an erased data partition, returns its flash stand-in to let the tests inspect it.
+ */
+inline ShimPrttn_t& shimPartitionAdd(const char* label, const uint32_t &size){
+   ShimPrttn_t &result{shimPrttns.emplace_back()};
+
+   result.prttn.type = ESP_PARTITION_TYPE_DATA;
+   result.prttn.subtype = ESP_PARTITION_SUBTYPE_ANY;
+   result.prttn.size = size;
+   strncpy(result.prttn.label, label, sizeof(result.prttn.label) - 1);
+   result.flash.assign(size, 0xFF);
+
+   return result;
+}
+
+inline ShimPrttn_t* shimPartitionOf(const esp_partition_t* prttnPtr){
+   ShimPrttn_t* result{nullptr};
+
+   for(ShimPrttn_t &prttn : shimPrttns){
+      if(&prttn.prttn == prttnPtr)
+         result = &prttn;
+   }
+
+   return result;
+}
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label){
+   const esp_partition_t* result{nullptr};
+
+   (void)subtype;
+   for(ShimPrttn_t &prttn : shimPrttns){
+      if((result == nullptr) && (prttn.prttn.type == type) && ((label == nullptr) || (strcmp(label, prttn.prttn.label) == 0)))
+         result = &prttn.prttn;
+   }
+
+   return result;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t* prttnPtr, size_t offset, size_t len){
+   esp_err_t result{ESP_ERR_INVALID_ARG};
+   ShimPrttn_t* shimPtr{shimPartitionOf(prttnPtr)};
+
+   if((shimPtr != nullptr) && ((offset % SPI_FLASH_SEC_SIZE) == 0) && ((len % SPI_FLASH_SEC_SIZE) == 0)){
+      result = ESP_ERR_INVALID_SIZE;
+      if((offset + len) <= shimPtr->flash.size()){
+         memset(&shimPtr->flash[offset], 0xFF, len);
+         shimPtr->erseQty++;
+         result = ESP_OK;
+      }
+   }
+
+   return result;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t* prttnPtr, size_t offset, void* dstPtr, size_t len){
+   esp_err_t result{ESP_ERR_INVALID_ARG};
+   ShimPrttn_t* shimPtr{shimPartitionOf(prttnPtr)};
+
+   if((shimPtr != nullptr) && (dstPtr != nullptr)){
+      result = ESP_ERR_INVALID_SIZE;
+      if((offset + len) <= shimPtr->flash.size()){
+         memcpy(dstPtr, &shimPtr->flash[offset], len);
+         result = ESP_OK;
+      }
+   }
+
+   return result;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t* prttnPtr, size_t offset, const void* srcPtr, size_t len){
+   esp_err_t result{ESP_ERR_INVALID_ARG};
+   ShimPrttn_t* shimPtr{shimPartitionOf(prttnPtr)};
+
+   if((shimPtr != nullptr) && (srcPtr != nullptr)){
+      result = ESP_ERR_INVALID_SIZE;
+      if((offset + len) <= shimPtr->flash.size()){
+         for(size_t pos{0}; pos < len; pos++)
+            shimPtr->flash[offset + pos] &= static_cast<const uint8_t*>(srcPtr)[pos];   // NOR flash: writing only clears bits
+         shimPtr->wrtQty++;
+         result = ESP_OK;
+      }
+   }
+
+   return result;
+}
+
+#endif   // _CCSHIM_ESP_PARTITION_H_
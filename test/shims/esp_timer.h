@@ -0,0 +1,11 @@
+/**
+ * @file esp_timer.h
+ *
+ * @brief Host build stand-in of the ESP-IDF esp_timer header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_ESP_TIMER_H_
+#define _CCSHIM_ESP_TIMER_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_ESP_TIMER_H_
@@ -0,0 +1,11 @@
+/**
+ * @file freertos/FreeRTOS.h
+ *
+ * @brief Host build stand-in of the FreeRTOS header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_FREERTOS_H_
+#define _CCSHIM_FREERTOS_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_FREERTOS_H_
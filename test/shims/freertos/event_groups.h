@@ -0,0 +1,11 @@
+/**
+ * @file freertos/event_groups.h
+ *
+ * @brief Host build stand-in of the FreeRTOS event groups header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_EVENT_GROUPS_H_
+#define _CCSHIM_EVENT_GROUPS_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_EVENT_GROUPS_H_
@@ -0,0 +1,11 @@
+/**
+ * @file freertos/queue.h
+ *
+ * @brief Host build stand-in of the FreeRTOS queues header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_QUEUE_H_
+#define _CCSHIM_QUEUE_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_QUEUE_H_
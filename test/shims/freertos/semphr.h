@@ -0,0 +1,11 @@
+/**
+ * @file freertos/semphr.h
+ *
+ * @brief Host build stand-in of the FreeRTOS semaphores header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_SEMPHR_H_
+#define _CCSHIM_SEMPHR_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_SEMPHR_H_
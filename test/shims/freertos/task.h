@@ -0,0 +1,11 @@
+/**
+ * @file freertos/task.h
+ *
+ * @brief Host build stand-in of the FreeRTOS tasks header, see ccHostShim.h
+ */
+#ifndef _CCSHIM_TASK_H_
+#define _CCSHIM_TASK_H_
+
+#include <ccHostShim.h>
+
+#endif   // _CCSHIM_TASK_H_